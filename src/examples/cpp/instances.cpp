@@ -0,0 +1,128 @@
+/*
+** Output:
+**
+**  x86-64: no ECX expression, model EAX = 0x12345668
+**  x86   : ECX expression, model EAX = 0x12345669
+**
+*/
+
+
+#include <iostream>
+
+#include <triton/api.hpp>
+#include <triton/ast.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+struct op {
+  unsigned int    addr;
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op trace[] = {
+  {0x400000, (unsigned char *)"\xb9\x01\x00\x00\x00", 5}, /* mov ecx, 1 */
+  {0x400005, (unsigned char *)"\x31\xc3",             2}, /* xor ebx, eax */
+  {0x400007, (unsigned char *)"\x83\xc3\x10",         3}, /* add ebx, 0x10 */
+  {0x0,      nullptr,                                 0}
+};
+
+
+/* Processes an instruction of the trace */
+void process(triton::API& ctx, unsigned int index) {
+  Instruction inst;
+  inst.setOpcodes(trace[index].inst, trace[index].size);
+  inst.setAddress(trace[index].addr);
+  ctx.processing(inst);
+}
+
+
+/* Solves ((eax ^ key) + 0x10) == 0x12345678 */
+bool check(triton::API& ctx, const char* name, unsigned int key) {
+  triton::ApiBinding binding(ctx);
+
+  auto ebx        = ctx.getFullAst(ctx.buildSymbolicRegister(TRITON_X86_REG_EBX));
+  auto constraint = ast::assert_(ast::equal(ebx, ast::bv(0x12345678, 32)));
+  auto model      = ctx.getModel(constraint);
+
+  /* Only the x86-64 API has the ONLY_ON_SYMBOLIZED mode, thus `mov ecx, 1` has no expression */
+  bool concrete = (ctx.getSymbolicRegisterId(TRITON_X86_REG_ECX) == triton::engines::symbolic::UNSET);
+  std::cout << name << ": " << (concrete ? "no ECX expression" : "ECX expression") << ", ";
+  if (concrete != ctx.isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED)) {
+    std::cout << "bad mode" << std::endl;
+    return false;
+  }
+
+  if (model.size() != 1 || model.begin()->second.getValue() != ((0x12345678 - 0x10) ^ key)) {
+    std::cout << "bad model" << std::endl;
+    return false;
+  }
+
+  std::cout << "model EAX = 0x" << std::hex << model.begin()->second.getValue() << std::dec << std::endl;
+  return true;
+}
+
+
+/* Two independent APIs with different architectures and modes are used on the same thread */
+int main(int ac, const char **av) {
+  triton::API ctx64;
+  triton::API ctx32;
+  bool ok = true;
+
+  ctx64.setArchitecture(ARCH_X86_64);
+  ctx64.enableMode(triton::modes::ONLY_ON_SYMBOLIZED, true);
+  ctx32.setArchitecture(ARCH_X86);
+
+  /* The registers and the ASTs are built in the API bound to the thread */
+  {
+    triton::ApiBinding binding(ctx64);
+    ctx64.convertRegisterToSymbolicVariable(TRITON_X86_REG_EAX);
+    ctx64.setConcreteRegisterValue(Register(TRITON_X86_REG_EBX.getId(), 0));
+  }
+  {
+    triton::ApiBinding binding(ctx32);
+    ctx32.convertRegisterToSymbolicVariable(TRITON_X86_REG_EAX);
+    ctx32.setConcreteRegisterValue(Register(TRITON_X86_REG_EBX.getId(), 1));
+  }
+
+  /* Interleave the instructions of both APIs, the x86 ones are undone by a snapshot and processed again */
+  ctx32.takeSnapshot();
+  for (unsigned int i = 0; trace[i].inst; i++) {
+    process(ctx64, i);
+    process(ctx32, i);
+  }
+
+  /* Ids are never reused by a restore, thus the memos of the API are kept */
+  usize revision = ctx32.getSymbolicEngine()->getAstRevision();
+  ctx32.restoreSnapshot();
+  ctx32.discardSnapshot();
+  if (ctx32.getSymbolicEngine()->getAstRevision() != revision) {
+    std::cout << "bad revision after restore" << std::endl;
+    ok = false;
+  }
+
+  for (unsigned int i = 0; trace[i].inst; i++)
+    process(ctx32, i);
+
+  /* Replacing the AST of an expression only outdates the memos of its API */
+  {
+    triton::ApiBinding binding(ctx32);
+    usize revision64 = ctx64.getSymbolicEngine()->getAstRevision();
+    usize revision32 = ctx32.getSymbolicEngine()->getAstRevision();
+    auto expr = ctx32.newSymbolicExpression(ast::bv(0, 32));
+    expr->setAst(ast::bv(1, 32));
+    if (ctx64.getSymbolicEngine()->getAstRevision() != revision64 || ctx32.getSymbolicEngine()->getAstRevision() == revision32) {
+      std::cout << "bad revision" << std::endl;
+      ok = false;
+    }
+    ctx32.removeSymbolicExpression(expr->getId());
+  }
+
+  ok &= check(ctx64, "x86-64", 0);
+  ok &= check(ctx32, "x86   ", 1);
+
+  return ok ? 0 : 1;
+}
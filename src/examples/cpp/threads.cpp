@@ -0,0 +1,129 @@
+/*
+** Output:
+**
+**  Thread 0 (x86-64): model EAX = 0x12345668
+**  Thread 1 (x86)   : model EAX = 0x12345669
+**  Thread 2 (x86-64): model EAX = 0x1234566a
+**  Thread 3 (x86)   : model EAX = 0x1234566b
+**  Remote free      : all nodes back
+**
+*/
+
+
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/ast.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+struct op {
+  unsigned int    addr;
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op trace[] = {
+  {0x400000, (unsigned char *)"\x31\xc3",     2}, /* xor ebx, eax */
+  {0x400002, (unsigned char *)"\x83\xc3\x10", 3}, /* add ebx, 0x10 */
+  {0x0,      nullptr,                         0}
+};
+
+
+/* Each thread owns its API and solves: ((eax ^ key) + 0x10) == 0x12345678 */
+void worker(unsigned int index, std::string* output) {
+  std::ostringstream stream;
+
+  /* Build an independent API and bind it to this thread */
+  triton::API ctx;
+  triton::ApiBinding binding(ctx);
+
+  /* Set the arch */
+  ctx.setArchitecture((index % 2) ? ARCH_X86 : ARCH_X86_64);
+
+  /* Define EAX as symbolic variable and EBX as the key */
+  ctx.convertRegisterToSymbolicVariable(TRITON_X86_REG_EAX);
+  ctx.setConcreteRegisterValue(Register(TRITON_X86_REG_EBX.getId(), index));
+
+  /* Process the trace */
+  for (unsigned int i = 0; trace[i].inst; i++) {
+    Instruction inst;
+    inst.setOpcodes(trace[i].inst, trace[i].size);
+    inst.setAddress(trace[i].addr);
+    ctx.processing(inst);
+  }
+
+  /* Build the constraint from EBX's AST */
+  auto ebx        = ctx.getFullAst(ctx.buildSymbolicRegister(TRITON_X86_REG_EBX));
+  auto constraint = ast::assert_(ast::equal(ebx, ast::bv(0x12345678, 32)));
+
+  /* Ask a model */
+  auto model = ctx.getModel(constraint);
+  stream << "Thread " << index << ((index % 2) ? " (x86)   " : " (x86-64)") << ": ";
+  if (model.size() != 1 || model.begin()->second.getValue() != ((0x12345678 - 0x10) ^ index))
+    stream << "bad model";
+  else
+    stream << "model EAX = 0x" << std::hex << model.begin()->second.getValue();
+
+  *output = stream.str();
+}
+
+
+/* Builds nodes in this thread and deletes them in another one, they go back to the allocator of this thread */
+std::string remoteFree(void) {
+  triton::API* ctx = new triton::API();
+  ctx->setArchitecture(ARCH_X86_64);
+
+  triton::usize before = ctx->getAstAllocatorStats()["usedBlocks"];
+
+  ctx->convertRegisterToSymbolicVariable(TRITON_X86_REG_EAX);
+  for (unsigned int i = 0; trace[i].inst; i++) {
+    Instruction inst;
+    inst.setOpcodes(trace[i].inst, trace[i].size);
+    inst.setAddress(trace[i].addr);
+    ctx->processing(inst);
+  }
+
+  triton::usize used = ctx->getAstAllocatorStats()["usedBlocks"];
+
+  std::thread([ctx]() { delete ctx; }).join();
+
+  /* Another instance of this thread reads the stats */
+  triton::API probe;
+  triton::usize after = probe.getAstAllocatorStats()["usedBlocks"];
+
+  if (used <= before || after > before)
+    return "Remote free      : nodes leaked";
+  return "Remote free      : all nodes back";
+}
+
+
+int main(int ac, const char **av) {
+  std::vector<std::thread> threads;
+  std::vector<std::string> outputs(4);
+
+  /* Run the analyses in parallel */
+  for (unsigned int i = 0; i < outputs.size(); i++)
+    threads.push_back(std::thread(worker, i, &outputs[i]));
+
+  for (auto& thread : threads)
+    thread.join();
+
+  outputs.push_back(remoteFree());
+
+  /* Display the results in order */
+  int ret = 0;
+  for (auto& output : outputs) {
+    std::cout << output << std::endl;
+    if (output.find("bad model") != std::string::npos || output.find("leaked") != std::string::npos)
+      ret = 1;
+  }
+
+  return ret;
+}
@@ -237,11 +237,13 @@ def memoryCaching(mem):
     size = mem.getSize()
     for index in range(size):
         if not isMemoryMapped(addr+index):
+            # The memory is mapped per page, so the whole page is loaded at once
+            page = (addr+index) & ~0xfff
             for r in memoryCache:
-                if addr+index >= r['start'] and addr+index < r['start'] + r['size']:
-                    value = ord(r['memory'][((addr+index)-r['start'])])
-                    setConcreteMemoryValue(addr+index, value)
-                    return
+                start = max(page, r['start'])
+                end   = min(page + 0x1000, r['start'] + r['size'])
+                if start < end:
+                    setConcreteMemoryAreaValue(start, r['memory'][start-r['start']:end-r['start']])
 
     return
 
@@ -42,7 +42,7 @@
 ##  [Triton] strlen hooked
 ##  [Triton] printf hooked
 ##  Input size = 5
-##  [Triton] Instruction executed: 34
+##  [Triton] Emulation stopped (reason: 4)
 ##  [Triton] Emulation done
 ##
 
@@ -52,6 +52,7 @@ import struct
 import ctypes
 import string
 import random
+import triton
 
 from triton import *
 
@@ -331,8 +332,7 @@ customRelocation = [
 ]
 
 
-def hookingHandler():
-    pc = getConcreteRegisterValue(REG.RIP)
+def hookingHandler(pc):
     for rel in customRelocation:
         if rel[2] == pc:
             # Emulate the routine and the return value
@@ -355,32 +355,13 @@ def hookingHandler():
 
 # Emulate the binary.
 def emulate(pc):
-    count = 0
-    while pc:
-        # Fetch opcodes
-        opcodes = getConcreteMemoryAreaValue(pc, 16)
+    # The libc routines are simulated by hooks on their PLT entry
+    hooks = dict((rel[2], hookingHandler) for rel in customRelocation)
 
-        # Create the Triton instruction
-        instruction = Instruction()
-        instruction.setOpcodes(opcodes)
-        instruction.setAddress(pc)
+    # The whole emulation is done natively, it stops on hlt (unsupported) or on a null pc (unmapped)
+    reason = triton.emulate(pc, [], 0, hooks)
 
-        # Process
-        processing(instruction)
-        count += 1
-
-        #print instruction
-
-        if instruction.getType() == OPCODE.HLT:
-            break
-
-        # Simulate routines
-        hookingHandler()
-
-        # Next
-        pc = getConcreteRegisterValue(REG.RIP)
-
-    debug('Instruction executed: %d' %(count))
+    debug('Emulation stopped (reason: %d)' %(reason))
     return
 
 
@@ -5,11 +5,16 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <list>
 #include <map>
+#include <memory>
 #include <new>
+#include <set>
+#include <vector>
 
 #include <triton/api.hpp>
+#include <triton/astAllocator.hpp>
 #include <triton/exceptions.hpp>
 
 
@@ -186,6 +191,31 @@ namespace triton {
   triton::API api;
 
 
+  /* The API bound to each thread, triton::api if there is none */
+  static thread_local triton::API* boundApi = nullptr;
+
+
+  triton::API& currentApi(void) {
+    if (boundApi == nullptr)
+      return triton::api;
+    return *boundApi;
+  }
+
+
+  ApiBinding::ApiBinding(const triton::API& instance) {
+    this->previous = boundApi;
+    boundApi = const_cast<triton::API*>(&instance);
+
+    /* The registers of the semantics (e.g. TRITON_X86_REG_RAX) are defined per thread */
+    instance.initThreadRegisters();
+  }
+
+
+  ApiBinding::~ApiBinding() {
+    boundApi = this->previous;
+  }
+
+
   API::API(): arch(&this->callbacks) {
   }
 
@@ -221,6 +251,7 @@ namespace triton {
 
 
   void API::setArchitecture(triton::uint32 arch) {
+    triton::ApiBinding binding(*this);
     /* Setup and init the targeted architecture */
     this->arch.setArchitecture(arch);
 
@@ -237,6 +268,11 @@ namespace triton {
   }
 
 
+  void API::initThreadRegisters(void) const {
+    this->arch.initThreadRegisters();
+  }
+
+
   bool API::isFlag(triton::uint32 regId) const {
     return this->arch.isFlag(regId);
   }
@@ -354,12 +390,58 @@ namespace triton {
   }
 
 
+  void API::loadBinary(const triton::format::BinaryInterface& binary) {
+    this->checkArchitecture();
+
+    /* The pages share the file until their first write */
+    triton::format::MappedFile* mapped = new(std::nothrow) triton::format::MappedFile(binary.getPath(), triton::format::LOADER_MMAP);
+    if (mapped == nullptr)
+      throw triton::exceptions::API("API::loadBinary(): Not enough memory.");
+
+    std::shared_ptr<const triton::format::MappedFile> file(mapped);
+
+    for (const auto& area : binary.getMemoryMapping()) {
+      triton::uint64 addr = area.getVirtualAddress();
+      triton::uint64 size = 0;
+
+      /* Corrupted areas are truncated to the end of the file */
+      if (area.getOffset() < file->getSize())
+        size = std::min<triton::uint64>(area.getSize(), file->getSize() - area.getOffset());
+
+      if (size)
+        this->arch.mapMemoryArea(addr, file->getData() + area.getOffset(), size, file);
+
+      if (area.getVirtualSize() > size)
+        this->arch.mapZeroMemory(addr + size, area.getVirtualSize() - size);
+    }
+  }
+
+
+  void API::loadBinary(const triton::format::AbstractBinary& binary) {
+    if (binary.getBinary() == nullptr)
+      throw triton::exceptions::API("API::loadBinary(): You must load the binary before.");
+    this->loadBinary(*binary.getBinary());
+  }
+
+
   void API::disassembly(triton::arch::Instruction& inst) const {
     this->checkArchitecture();
     this->arch.disassembly(inst);
   }
 
 
+  std::map<std::string, triton::usize> API::getDisassemblyCacheStats(void) const {
+    this->checkArchitecture();
+    return this->arch.getDisassemblyCacheStats();
+  }
+
+
+  void API::flushDisassemblyCache(void) {
+    this->checkArchitecture();
+    this->arch.flushDisassemblyCache();
+  }
+
+
 
   /* Processing API ================================================================================ */
 
@@ -406,6 +488,9 @@ namespace triton {
       delete this->taint;
       delete this->z3Interface;
 
+      /* Nodes still referenced (e.g. by Python objects) keep their slab */
+      triton::ast::astAllocator().releaseFreeSlabs();
+
       this->astGarbageCollector = nullptr;
       this->irBuilder           = nullptr;
       this->modes               = nullptr;
@@ -419,6 +504,7 @@ namespace triton {
 
   void API::resetEngines(void) {
     if (this->isArchitectureValid()) {
+      this->arch.discardSnapshot();
       this->removeEngines();
       this->initEngines();
       this->clearArchitecture();
@@ -427,12 +513,166 @@ namespace triton {
 
 
   bool API::processing(triton::arch::Instruction& inst) {
+    triton::ApiBinding binding(*this);
     this->checkArchitecture();
     this->disassembly(inst);
     return this->buildSemantics(inst);
   }
 
 
+  triton::arch::emulation_e API::emulate(triton::uint64 startAddress, const std::set<triton::uint64>& breakpoints, triton::usize maxInstructions,
+                                         const std::map<triton::uint64, triton::arch::emulationHookCallback>& hooks) {
+    triton::ApiBinding binding(*this);
+    this->checkArchitecture();
+
+    const triton::arch::Register& pc = this->arch.getProgramCounter();
+    triton::uint64 address           = startAddress;
+    triton::usize count              = 0;
+    bool resumed                     = true;
+
+    this->setConcreteRegisterValue(triton::arch::Register(pc.getId(), startAddress));
+
+    while (maxInstructions == 0 || count < maxInstructions) {
+      /* Breakpoints and hooks are not applied on the start address */
+      if (!resumed) {
+        if (breakpoints.find(address) != breakpoints.end())
+          return triton::arch::EMULATION_BREAKPOINT;
+
+        auto hook = hooks.find(address);
+        if (hook != hooks.end()) {
+          if (!hook->second(address))
+            return triton::arch::EMULATION_HOOK;
+
+          /* The hook may have redirected the execution */
+          triton::uint64 next = static_cast<triton::uint64>(this->getConcreteRegisterValue(pc, false));
+          if (next != address) {
+            address = next;
+            continue;
+          }
+        }
+      }
+      resumed = false;
+
+      if (!this->isMemoryMapped(address))
+        return triton::arch::EMULATION_UNMAPPED;
+
+      /* Fetch the longest possible instruction (15 bytes on x86), the disassembler refines the size */
+      std::vector<triton::uint8> opcodes = this->getConcreteMemoryAreaValue(address, DQWORD_SIZE, false);
+      triton::arch::Instruction inst(opcodes.data(), opcodes.size());
+      inst.setAddress(address);
+
+      try {
+        if (!this->processing(inst))
+          return triton::arch::EMULATION_UNSUPPORTED;
+      }
+      catch (const triton::exceptions::Disassembly&) {
+        return triton::arch::EMULATION_UNSUPPORTED;
+      }
+
+      count++;
+      address = static_cast<triton::uint64>(this->getConcreteRegisterValue(pc, false));
+
+      if (this->arch.isSyscall(inst))
+        return triton::arch::EMULATION_SYSCALL;
+    }
+
+    return triton::arch::EMULATION_MAX_INSTRUCTIONS;
+  }
+
+
+
+  /* Snapshot API =================================================================================== */
+
+  void API::takeSnapshot(void) {
+    triton::ApiBinding binding(*this);
+    this->checkArchitecture();
+    this->checkSymbolic();
+    this->checkTaint();
+
+    this->arch.takeSnapshot();
+    this->symbolic->takeSnapshot();
+    this->taint->takeSnapshot();
+  }
+
+
+  void API::restoreSnapshot(void) {
+    triton::ApiBinding binding(*this);
+    if (!this->isSnapshotEnabled())
+      throw triton::exceptions::API("API::restoreSnapshot(): No snapshot taken.");
+
+    this->arch.restoreSnapshot();
+    this->symbolic->restoreSnapshot();
+    this->taint->restoreSnapshot();
+  }
+
+
+  void API::discardSnapshot(void) {
+    triton::ApiBinding binding(*this);
+    this->checkArchitecture();
+    this->checkSymbolic();
+    this->checkTaint();
+
+    this->arch.discardSnapshot();
+    this->symbolic->discardSnapshot();
+    this->taint->discardSnapshot();
+  }
+
+
+  bool API::isSnapshotEnabled(void) const {
+    this->checkArchitecture();
+    return this->arch.isSnapshotEnabled();
+  }
+
+
+
+  /* Trace API ====================================================================================== */
+
+  triton::usize API::replayTrace(const std::string& path, const std::map<triton::uint64, triton::format::trace::replayHookCallback>& hooks) {
+    triton::ApiBinding binding(*this);
+    triton::format::trace::TraceReader trace(path);
+    triton::usize count = 0;
+
+    if (!this->isArchitectureValid())
+      this->setArchitecture(trace.getArchitecture());
+
+    else if (this->getArchitecture() != trace.getArchitecture())
+      throw triton::exceptions::API("API::replayTrace(): The trace has been recorded for another architecture.");
+
+    while (true) {
+      triton::arch::Instruction inst;
+
+      if (!trace.nextInstruction(inst))
+        break;
+
+      /*
+       * A recorded value which differs from the current one (thread switch, unsupported
+       * instruction) means that the symbolic state of this location is stale.
+       */
+      for (auto it = inst.registerState.begin(); it != inst.registerState.end(); it++) {
+        if (this->getConcreteRegisterValue(it->second, false) != it->second.getConcreteValue())
+          this->concretizeRegister(it->second);
+      }
+
+      for (auto it = inst.memoryAccess.begin(); it != inst.memoryAccess.end(); it++) {
+        if (this->getConcreteMemoryValue(*it, false) != it->getConcreteValue())
+          this->concretizeMemory(*it);
+      }
+
+      this->processing(inst);
+      count++;
+
+      if (hooks.empty())
+        continue;
+
+      auto hook = hooks.find(inst.getAddress());
+      if (hook != hooks.end() && !hook->second(inst))
+        break;
+    }
+
+    return count;
+  }
+
+
 
   /* IR builder API ================================================================================= */
 
@@ -443,6 +683,7 @@ namespace triton {
 
 
   bool API::buildSemantics(triton::arch::Instruction& inst) {
+    triton::ApiBinding binding(*this);
     this->checkIrBuilder();
     return this->irBuilder->buildSemantics(inst);
   }
@@ -487,7 +728,7 @@ namespace triton {
   }
 
 
-  const std::set<triton::ast::AbstractNode*>& API::getAllocatedAstNodes(void) const {
+  std::set<triton::ast::AbstractNode*> API::getAllocatedAstNodes(void) const {
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAllocatedAstNodes();
   }
@@ -499,6 +740,11 @@ namespace triton {
   }
 
 
+  std::map<std::string, triton::usize> API::getAstAllocatorStats(void) const {
+    return triton::ast::astAllocator().getStats();
+  }
+
+
   const std::map<std::string, triton::ast::AbstractNode*>& API::getAstVariableNodes(void) const {
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAstVariableNodes();
@@ -526,12 +772,17 @@ namespace triton {
   /* AST representation API ========================================================================= */
 
   triton::uint32 API::getAstRepresentationMode(void) const {
-    return triton::ast::representations::astRepresentation.getMode();
+    return this->astRepresentation.getMode();
   }
 
 
   void API::setAstRepresentationMode(triton::uint32 mode) {
-    triton::ast::representations::astRepresentation.setMode(mode);
+    this->astRepresentation.setMode(mode);
+  }
+
+
+  std::ostream& API::printAstRepresentation(std::ostream& stream, triton::ast::AbstractNode* node) {
+    return this->astRepresentation.print(stream, node);
   }
 
 
@@ -629,78 +880,91 @@ namespace triton {
 
 
   triton::engines::symbolic::SymbolicVariable* API::convertExpressionToSymbolicVariable(triton::usize exprId, triton::uint32 symVarSize, const std::string& symVarComment) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->convertExpressionToSymbolicVariable(exprId, symVarSize, symVarComment);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::convertMemoryToSymbolicVariable(const triton::arch::MemoryAccess& mem, const std::string& symVarComment) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->convertMemoryToSymbolicVariable(mem, symVarComment);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::convertRegisterToSymbolicVariable(const triton::arch::Register& reg, const std::string& symVarComment) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->convertRegisterToSymbolicVariable(reg, symVarComment);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicOperand(triton::arch::OperandWrapper& op) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicOperand(op);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicOperand(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicOperand(inst, op);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicImmediate(const triton::arch::Immediate& imm) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicImmediate(imm);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicImmediate(triton::arch::Instruction& inst, triton::arch::Immediate& imm) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicImmediate(inst, imm);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicMemory(const triton::arch::MemoryAccess& mem) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicMemory(mem);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicMemory(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicMemory(inst, mem);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicRegister(const triton::arch::Register& reg) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicRegister(reg);
   }
 
 
   triton::ast::AbstractNode* API::buildSymbolicRegister(triton::arch::Instruction& inst, triton::arch::Register& reg) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->buildSymbolicRegister(inst, reg);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::newSymbolicExpression(triton::ast::AbstractNode* node, const std::string& comment) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->newSymbolicExpression(node, triton::engines::symbolic::UNDEF, comment);
   }
 
 
   triton::engines::symbolic::SymbolicVariable* API::newSymbolicVariable(triton::uint32 varSize, const std::string& comment) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEF, 0, varSize, comment);
   }
@@ -713,42 +977,49 @@ namespace triton {
 
 
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::OperandWrapper& dst, const std::string& comment) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicExpression(inst, node, dst, comment);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicMemoryExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::MemoryAccess& mem, const std::string& comment) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicMemoryExpression(inst, node, mem, comment);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& reg, const std::string& comment) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicRegisterExpression(inst, node, reg, comment);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& flag, const std::string& comment) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicFlagExpression(inst, node, flag, comment);
   }
 
 
   triton::engines::symbolic::SymbolicExpression* API::createSymbolicVolatileExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const std::string& comment) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->createSymbolicVolatileExpression(inst, node, comment);
   }
 
 
   void API::assignSymbolicExpressionToMemory(triton::engines::symbolic::SymbolicExpression* se, const triton::arch::MemoryAccess& mem) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     this->symbolic->assignSymbolicExpressionToMemory(se, mem);
   }
 
 
   void API::assignSymbolicExpressionToRegister(triton::engines::symbolic::SymbolicExpression* se, const triton::arch::Register& reg) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     this->symbolic->assignSymbolicExpressionToRegister(se, reg);
   }
@@ -761,6 +1032,7 @@ namespace triton {
 
 
   std::map<triton::arch::Register, triton::engines::symbolic::SymbolicExpression*> API::getSymbolicRegisters(void) const {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicRegisters();
   }
@@ -773,36 +1045,42 @@ namespace triton {
 
 
   triton::usize API::getSymbolicRegisterId(const triton::arch::Register& reg) const {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicRegisterId(reg);
   }
 
 
   triton::uint8 API::getSymbolicMemoryValue(triton::uint64 address) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemoryValue(address);
   }
 
 
   triton::uint512 API::getSymbolicMemoryValue(const triton::arch::MemoryAccess& mem) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemoryValue(mem);
   }
 
 
   std::vector<triton::uint8> API::getSymbolicMemoryAreaValue(triton::uint64 baseAddr, triton::usize size) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicMemoryAreaValue(baseAddr, size);
   }
 
 
   triton::uint512 API::getSymbolicRegisterValue(const triton::arch::Register& reg) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->getSymbolicRegisterValue(reg);
   }
 
 
   triton::ast::AbstractNode* API::processSimplification(triton::ast::AbstractNode* node, bool z3) const {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     if (z3 == true)
       node = this->processZ3Simplification(node);
@@ -836,12 +1114,14 @@ namespace triton {
 
 
   triton::ast::AbstractNode* API::getPathConstraintsAst(void) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->getPathConstraintsAst();
   }
 
 
   void API::addPathConstraint(const triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* expr) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     this->symbolic->addPathConstraint(inst, expr);
   }
@@ -884,42 +1164,63 @@ namespace triton {
 
 
   bool API::isRegisterSymbolized(const triton::arch::Register& reg) const {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->isRegisterSymbolized(reg);
   }
 
 
   void API::concretizeAllMemory(void) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     this->symbolic->concretizeAllMemory();
+
+    /* Nodes are shared with AST_DICTIONARIES, those of the expressions which are not used anymore are reclaimed */
+    if (this->modes->isModeEnabled(triton::modes::AST_DICTIONARIES)) {
+      std::set<triton::ast::AbstractNode*> nodes;
+      this->symbolic->removeUnreachableExpressions(nodes);
+      this->freeAstNodes(nodes);
+    }
   }
 
 
   void API::concretizeAllRegister(void) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     this->symbolic->concretizeAllRegister();
+
+    /* Nodes are shared with AST_DICTIONARIES, those of the expressions which are not used anymore are reclaimed */
+    if (this->modes->isModeEnabled(triton::modes::AST_DICTIONARIES)) {
+      std::set<triton::ast::AbstractNode*> nodes;
+      this->symbolic->removeUnreachableExpressions(nodes);
+      this->freeAstNodes(nodes);
+    }
   }
 
 
   void API::concretizeMemory(const triton::arch::MemoryAccess& mem) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     this->symbolic->concretizeMemory(mem);
   }
 
 
   void API::concretizeMemory(triton::uint64 addr) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     this->symbolic->concretizeMemory(addr);
   }
 
 
   void API::concretizeRegister(const triton::arch::Register& reg) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     this->symbolic->concretizeRegister(reg);
   }
 
 
   triton::ast::AbstractNode* API::getFullAst(triton::ast::AbstractNode* node) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     return this->symbolic->getFullAst(node);
   }
@@ -933,6 +1234,7 @@ namespace triton {
 
 
   triton::ast::AbstractNode* API::getFullAstFromId(triton::usize symExprId) {
+    triton::ApiBinding binding(*this);
     this->checkSymbolic();
     triton::ast::AbstractNode* partialAst = this->getAstFromId(symExprId);
     return this->getFullAst(partialAst);
@@ -973,17 +1275,84 @@ namespace triton {
 
 
   std::map<triton::uint32, triton::engines::solver::SolverModel> API::getModel(triton::ast::AbstractNode* node) const {
+    triton::ApiBinding binding(*this);
     this->checkSolver();
     return this->solver->getModel(node);
   }
 
 
   std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const {
+    triton::ApiBinding binding(*this);
     this->checkSolver();
     return this->solver->getModels(node, limit);
   }
 
 
+  std::vector<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModels(const std::vector<triton::ast::AbstractNode*>& nodes, triton::uint32 threads, triton::uint32 timeout) const {
+    triton::ApiBinding binding(*this);
+    this->checkSolver();
+    return this->solver->getModels(nodes, threads, timeout);
+  }
+
+
+  std::vector<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getNegatedBranchModels(const std::vector<triton::usize>& indexes, triton::uint32 threads, triton::uint32 timeout) const {
+    triton::ApiBinding binding(*this);
+    this->checkSolver();
+    return this->solver->getNegatedBranchModels(indexes, threads, timeout);
+  }
+
+
+  bool API::isSat(triton::ast::AbstractNode* node) const {
+    triton::ApiBinding binding(*this);
+    this->checkSolver();
+    return this->solver->isSat(node);
+  }
+
+
+  void API::pushSolverScope(void) {
+    this->checkSolver();
+    this->solver->push();
+  }
+
+
+  void API::popSolverScope(void) {
+    this->checkSolver();
+    this->solver->pop();
+  }
+
+
+  triton::usize API::getNumberOfSolverScopes(void) const {
+    this->checkSolver();
+    return this->solver->getNumberOfScopes();
+  }
+
+
+  void API::addSolverConstraint(triton::ast::AbstractNode* node) {
+    triton::ApiBinding binding(*this);
+    this->checkSolver();
+    this->solver->addConstraint(node);
+  }
+
+
+  void API::resetSolverSession(void) {
+    triton::ApiBinding binding(*this);
+    this->checkSolver();
+    this->solver->resetSession();
+  }
+
+
+  std::map<std::string, triton::usize> API::getSolverCacheStats(void) const {
+    this->checkSolver();
+    return this->solver->getCacheStats();
+  }
+
+
+  void API::flushSolverCache(void) {
+    this->checkSolver();
+    this->solver->flushCache();
+  }
+
+
 
   /* Z3 interface API ============================================================================== */
 
@@ -994,12 +1363,14 @@ namespace triton {
 
 
   triton::uint512 API::evaluateAstViaZ3(triton::ast::AbstractNode* node) const {
+    triton::ApiBinding binding(*this);
     this->checkZ3Interface();
     return this->z3Interface->evaluate(node);
   }
 
 
   triton::ast::AbstractNode* API::processZ3Simplification(triton::ast::AbstractNode* node) const {
+    triton::ApiBinding binding(*this);
     this->checkZ3Interface();
     return this->z3Interface->simplify(node);
   }
@@ -1020,12 +1391,24 @@ namespace triton {
   }
 
 
-  const std::set<triton::uint64>& API::getTaintedMemory(void) const {
+  std::set<triton::uint64> API::getTaintedMemory(void) const {
     this->checkTaint();
     return this->taint->getTaintedMemory();
   }
 
 
+  std::map<triton::uint64, triton::usize> API::getTaintedMemoryRanges(triton::uint64 baseAddr, triton::usize size) const {
+    this->checkTaint();
+    return this->taint->getTaintedMemoryRanges(baseAddr, size);
+  }
+
+
+  std::map<triton::uint64, triton::usize> API::getTaintedMemoryRanges(void) const {
+    this->checkTaint();
+    return this->taint->getTaintedMemoryRanges();
+  }
+
+
   const std::set<triton::arch::Register>& API::getTaintedRegisters(void) const {
     this->checkTaint();
     return this->taint->getTaintedRegisters();
@@ -1050,7 +1433,7 @@ namespace triton {
   }
 
 
-  bool API::isMemoryTainted(triton::uint64 addr, uint32 size) const {
+  bool API::isMemoryTainted(triton::uint64 addr, triton::usize size) const {
     this->checkTaint();
     return this->taint->isMemoryTainted(addr, size);
   }
@@ -1100,6 +1483,12 @@ namespace triton {
   }
 
 
+  bool API::taintMemoryArea(triton::uint64 baseAddr, triton::usize size) {
+    this->checkTaint();
+    return this->taint->taintMemoryArea(baseAddr, size);
+  }
+
+
   bool API::taintRegister(const triton::arch::Register& reg) {
     this->checkTaint();
     return this->taint->taintRegister(reg);
@@ -1118,6 +1507,12 @@ namespace triton {
   }
 
 
+  bool API::untaintMemoryArea(triton::uint64 baseAddr, triton::usize size) {
+    this->checkTaint();
+    return this->taint->untaintMemoryArea(baseAddr, size);
+  }
+
+
   bool API::untaintRegister(const triton::arch::Register& reg) {
     this->checkTaint();
     return this->taint->untaintRegister(reg);
@@ -17,6 +17,10 @@
 namespace triton {
   namespace arch {
 
+    /* The architecture of the registers of each thread (e.g. TRITON_X86_REG_RAX) */
+    static thread_local triton::uint32 threadRegisters = triton::arch::ARCH_INVALID;
+
+
     Architecture::Architecture(triton::callbacks::Callbacks* callbacks) {
       this->arch      = triton::arch::ARCH_INVALID;
       this->callbacks = callbacks;
@@ -61,6 +65,16 @@ namespace triton {
           this->cpu->init();
           break;
       }
+
+      threadRegisters = this->arch;
+    }
+
+
+    void Architecture::initThreadRegisters(void) const {
+      if (this->cpu && threadRegisters != this->arch) {
+        this->cpu->init();
+        threadRegisters = this->arch;
+      }
     }
 
 
@@ -166,6 +180,20 @@ namespace triton {
     }
 
 
+    std::map<std::string, triton::usize> Architecture::getDisassemblyCacheStats(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getDisassemblyCacheStats(): You must define an architecture.");
+      return this->cpu->getDisassemblyCacheStats();
+    }
+
+
+    void Architecture::flushDisassemblyCache(void) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::flushDisassemblyCache(): You must define an architecture.");
+      this->cpu->flushDisassemblyCache();
+    }
+
+
     triton::uint8 Architecture::getConcreteMemoryValue(triton::uint64 addr) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getConcreteMemoryValue(): You must define an architecture.");
@@ -242,6 +270,62 @@ namespace triton {
       this->cpu->unmapMemory(baseAddr, size);
     }
 
+
+    void Architecture::mapMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::mapMemoryArea(): You must define an architecture.");
+      this->cpu->mapMemoryArea(baseAddr, area, size, owner);
+    }
+
+
+    void Architecture::mapZeroMemory(triton::uint64 baseAddr, triton::usize size) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::mapZeroMemory(): You must define an architecture.");
+      this->cpu->mapZeroMemory(baseAddr, size);
+    }
+
+
+    void Architecture::takeSnapshot(void) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::takeSnapshot(): You must define an architecture.");
+      this->cpu->takeSnapshot();
+    }
+
+
+    void Architecture::restoreSnapshot(void) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::restoreSnapshot(): You must define an architecture.");
+      this->cpu->restoreSnapshot();
+    }
+
+
+    void Architecture::discardSnapshot(void) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::discardSnapshot(): You must define an architecture.");
+      this->cpu->discardSnapshot();
+    }
+
+
+    bool Architecture::isSnapshotEnabled(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::isSnapshotEnabled(): You must define an architecture.");
+      return this->cpu->isSnapshotEnabled();
+    }
+
+
+    const triton::arch::Register& Architecture::getProgramCounter(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getProgramCounter(): You must define an architecture.");
+      return this->cpu->getProgramCounter();
+    }
+
+
+    bool Architecture::isSyscall(const triton::arch::Instruction& inst) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::isSyscall(): You must define an architecture.");
+      return this->cpu->isSyscall(inst);
+    }
+
   }; /* arch namespace */
 }; /* triton namespace */
 
@@ -0,0 +1,113 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+
+#include <triton/disassemblyCache.hpp>
+#include <triton/operandWrapper.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    DisassemblyCache::DisassemblyCache() {
+      this->hits   = 0;
+      this->misses = 0;
+    }
+
+
+    DisassemblyCache::DisassemblyCache(const DisassemblyCache& other) {
+      this->copy(other);
+    }
+
+
+    DisassemblyCache::~DisassemblyCache() {
+    }
+
+
+    void DisassemblyCache::operator=(const DisassemblyCache& other) {
+      this->copy(other);
+    }
+
+
+    void DisassemblyCache::copy(const DisassemblyCache& other) {
+      this->hits         = other.hits;
+      this->instructions = other.instructions;
+      this->misses       = other.misses;
+    }
+
+
+    bool DisassemblyCache::load(triton::arch::Instruction& inst) {
+      auto it = this->instructions.find(inst.getAddress());
+
+      /* The address must be known and the opcodes must be the same */
+      if (it == this->instructions.end() ||
+          it->second.getSize() > inst.getSize() ||
+          std::memcmp(it->second.getOpcodes(), inst.getOpcodes(), it->second.getSize()) != 0) {
+        this->misses++;
+        return false;
+      }
+
+      triton::arch::Instruction& cached = it->second;
+
+      inst.setDisassembly(cached.getDisassembly());
+      inst.setSize(cached.getSize());
+      inst.setType(cached.getType());
+      inst.setPrefix(cached.getPrefix());
+      inst.setBranch(cached.isBranch());
+      inst.setControlFlow(cached.isControlFlow());
+
+      /* Register operands must take the register state of the given instruction */
+      for (auto op = cached.operands.begin(); op != cached.operands.end(); op++) {
+        if (op->getType() == triton::arch::OP_REG)
+          inst.operands.push_back(triton::arch::OperandWrapper(inst.getRegisterState(op->getRegister().getId())));
+        else
+          inst.operands.push_back(*op);
+      }
+
+      this->hits++;
+      return true;
+    }
+
+
+    void DisassemblyCache::store(const triton::arch::Instruction& inst) {
+      triton::arch::Instruction cached(inst.getOpcodes(), inst.getSize());
+
+      cached.setAddress(inst.getAddress());
+      cached.setDisassembly(inst.getDisassembly());
+      cached.setType(inst.getType());
+      cached.setPrefix(inst.getPrefix());
+      cached.setBranch(inst.isBranch());
+      cached.setControlFlow(inst.isControlFlow());
+      cached.operands = inst.operands;
+
+      this->instructions[inst.getAddress()] = cached;
+    }
+
+
+    void DisassemblyCache::flush(void) {
+      this->instructions.clear();
+      this->hits   = 0;
+      this->misses = 0;
+    }
+
+
+    std::map<std::string, triton::usize> DisassemblyCache::getStats(void) const {
+      std::map<std::string, triton::usize> stats;
+      triton::usize lookups = this->hits + this->misses;
+
+      stats["entries"] = this->instructions.size();
+      stats["hits"]    = this->hits;
+      stats["misses"]  = this->misses;
+      stats["hitRate"] = (lookups ? (this->hits * 100) / lookups : 0);
+
+      return stats;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -37,6 +37,7 @@ namespace triton {
 
 
     Instruction::~Instruction() {
+      this->releaseAstNodes();
     }
 
 
@@ -46,7 +47,13 @@ namespace triton {
 
 
     void Instruction::operator=(const Instruction& other) {
+      /* Drop the current references once the new ones are taken */
+      std::vector<triton::ast::AbstractNode*> nodes = this->heldAstNodes;
+
       this->copy(other);
+
+      for (auto it = nodes.begin(); it != nodes.end(); it++)
+        (*it)->decRefCount();
     }
 
 
@@ -73,6 +80,56 @@ namespace triton {
 
       this->disassembly.clear();
       this->disassembly.str(other.disassembly.str());
+
+      /* Each copy holds its own references */
+      this->heldAstNodes = other.heldAstNodes;
+      for (auto it = this->heldAstNodes.begin(); it != this->heldAstNodes.end(); it++)
+        (*it)->incRefCount();
+    }
+
+
+    void Instruction::holdAstNodes(void) {
+      std::vector<triton::ast::AbstractNode*> nodes;
+
+      for (auto it = this->loadAccess.begin(); it != this->loadAccess.end(); it++)
+        nodes.push_back(it->second);
+
+      for (auto it = this->storeAccess.begin(); it != this->storeAccess.end(); it++)
+        nodes.push_back(it->second);
+
+      for (auto it = this->readRegisters.begin(); it != this->readRegisters.end(); it++)
+        nodes.push_back(it->second);
+
+      for (auto it = this->writtenRegisters.begin(); it != this->writtenRegisters.end(); it++)
+        nodes.push_back(it->second);
+
+      for (auto it = this->readImmediates.begin(); it != this->readImmediates.end(); it++)
+        nodes.push_back(it->second);
+
+      for (auto it = this->operands.begin(); it != this->operands.end(); it++) {
+        if (it->getType() == triton::arch::OP_MEM)
+          nodes.push_back(it->getConstMemory().getLeaAst());
+      }
+
+      /* Take the new references before dropping the old ones */
+      for (auto it = nodes.begin(); it != nodes.end();) {
+        if (*it == nullptr) {
+          it = nodes.erase(it);
+          continue;
+        }
+        (*it)->incRefCount();
+        it++;
+      }
+
+      this->releaseAstNodes();
+      this->heldAstNodes = nodes;
+    }
+
+
+    void Instruction::releaseAstNodes(void) {
+      for (auto it = this->heldAstNodes.begin(); it != this->heldAstNodes.end(); it++)
+        (*it)->decRefCount();
+      this->heldAstNodes.clear();
     }
 
 
@@ -139,6 +196,11 @@ namespace triton {
     }
 
 
+    const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& Instruction::getLoadAccess(void) const {
+      return this->loadAccess;
+    }
+
+
     std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& Instruction::getStoreAccess(void) {
       return this->storeAccess;
     }
@@ -453,6 +515,8 @@ namespace triton {
 
 
     void Instruction::partialReset(void) {
+      this->releaseAstNodes();
+
       this->address         = 0;
       this->branch          = false;
       this->conditionTaken  = false;
@@ -12,6 +12,7 @@
 #include <triton/memoryAccess.hpp>
 #include <triton/operandWrapper.hpp>
 #include <triton/register.hpp>
+#include <triton/x86ConcreteSemantics.hpp>
 #include <triton/x86Semantics.hpp>
 
 
@@ -40,24 +41,22 @@ namespace triton {
       if (taintEngine == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): The taint engines API must be defined.");
 
-      this->architecture              = architecture;
-      this->astGarbageCollector       = astGarbageCollector;
-      this->backupAstGarbageCollector = new(std::nothrow) triton::ast::AstGarbageCollector(modes, true);
-      this->backupSymbolicEngine      = new(std::nothrow) triton::engines::symbolic::SymbolicEngine(architecture, modes, nullptr, true);
-      this->modes                     = modes;
-      this->symbolicEngine            = symbolicEngine;
-      this->taintEngine               = taintEngine;
-      this->x86Isa                    = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine);
+      this->architecture        = architecture;
+      this->astGarbageCollector = astGarbageCollector;
+      this->modes               = modes;
+      this->symbolicEngine      = symbolicEngine;
+      this->taintEngine         = taintEngine;
+      this->x86Isa              = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine);
+      this->x86ConcreteIsa      = new(std::nothrow) triton::arch::x86::x86ConcreteSemantics(architecture, symbolicEngine, taintEngine);
 
-      if (this->x86Isa == nullptr || this->backupSymbolicEngine == nullptr || this->backupAstGarbageCollector == nullptr)
+      if (this->x86Isa == nullptr || this->x86ConcreteIsa == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): Not enough memory.");
     }
 
 
     IrBuilder::~IrBuilder() {
-      delete this->backupSymbolicEngine;
-      delete this->backupAstGarbageCollector;
       delete this->x86Isa;
+      delete this->x86ConcreteIsa;
     }
 
 
@@ -79,7 +78,14 @@ namespace triton {
         this->architecture->setConcreteRegisterValue(it2->second);
       }
 
-      /* Stage 3 - Initialize the target address of memory operands */
+      /*
+       * Stage 3 - Execute natively the instruction if none of its inputs is symbolized or tainted. In the
+       * taint-only mode, the supported instructions are always executed natively and only spread the taint.
+       */
+      if ((this->modes->isModeEnabled(triton::modes::CONCRETE_FAST_PATH) || !this->symbolicEngine->isEnabled()) && this->buildConcreteSemantics(inst))
+        return true;
+
+      /* Stage 4 - Initialize the target address of memory operands */
       std::vector<triton::arch::OperandWrapper>::iterator it3;
       for (it3 = inst.operands.begin(); it3 != inst.operands.end(); it3++) {
         if (it3->getType() == triton::arch::OP_MEM) {
@@ -104,6 +110,37 @@ namespace triton {
     }
 
 
+    bool IrBuilder::buildConcreteSemantics(triton::arch::Instruction& inst) {
+      bool ret = false;
+
+      /* Clear the semantics of a previous processing, the accesses are recorded by the concrete semantics */
+      inst.symbolicExpressions.clear();
+      inst.getLoadAccess().clear();
+      inst.getReadRegisters().clear();
+      inst.getReadImmediates().clear();
+      inst.getStoreAccess().clear();
+      inst.getWrittenRegisters().clear();
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          ret = this->x86ConcreteIsa->buildSemantics(inst);
+      }
+
+      if (!ret)
+        return false;
+
+      /* Clear unused data */
+      inst.memoryAccess.clear();
+      inst.registerState.clear();
+
+      /* Drop the nodes held by a previous processing */
+      inst.holdAstNodes();
+
+      return true;
+    }
+
+
     void IrBuilder::preIrInit(triton::arch::Instruction& inst) {
       /* Clear previous expressions if exist */
       inst.symbolicExpressions.clear();
@@ -115,11 +152,15 @@ namespace triton {
       inst.getStoreAccess().clear();
       inst.getWrittenRegisters().clear();
 
-      /* Backup the symbolic engine in the case where only the taint is available. */
-      if (!this->symbolicEngine->isEnabled()) {
-        *this->backupSymbolicEngine = *this->symbolicEngine;
-        *this->backupAstGarbageCollector = *this->astGarbageCollector;
-      }
+      /*
+       * If only the taint is available, we are here because the instruction is not
+       * handled by the native semantics (see x86ConcreteSemantics). The full semantics
+       * are then the fallback to spread the taint. The symbolic engine does not record
+       * the expressions into its state and all nodes allocated by the semantics are
+       * temporary. Thus, they can be freed without any backup of the engines.
+       */
+      if (!this->symbolicEngine->isEnabled())
+        this->astGarbageCollector->beginTemporaryAstNodes();
     }
 
 
@@ -149,7 +190,6 @@ namespace triton {
        */
       if (!this->symbolicEngine->isEnabled()) {
         this->removeSymbolicExpressions(inst, uniqueNodes);
-        *this->symbolicEngine = *this->backupSymbolicEngine;
       }
 
       // ----------------------------------------------------------------------
@@ -284,11 +324,15 @@ namespace triton {
 
       // ----------------------------------------------------------------------
 
+      /* Collect nodes which have been allocated by the semantics in the taint-only mode */
+      if (!this->symbolicEngine->isEnabled())
+        this->astGarbageCollector->endTemporaryAstNodes(uniqueNodes);
+
+      /* The instruction keeps its semantics nodes alive */
+      inst.holdAstNodes();
+
       /* Free collected nodes */
       this->astGarbageCollector->freeAstNodes(uniqueNodes);
-
-      if (!this->symbolicEngine->isEnabled())
-        *this->astGarbageCollector = *this->backupAstGarbageCollector;
     }
 
 
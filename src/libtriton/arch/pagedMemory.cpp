@@ -0,0 +1,351 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <triton/pagedMemory.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* Returns the base address of the page which contains the address */
+    static inline triton::uint64 pageBase(triton::uint64 addr) {
+      return addr & ~static_cast<triton::uint64>(MEMORY_PAGE_SIZE - 1);
+    }
+
+
+    /* The content shared by the zero pages */
+    static const triton::uint8 zeroPage[MEMORY_PAGE_SIZE] = {0};
+
+
+    PagedMemory::PagedMemory() {
+      this->snapshotFlag = false;
+      this->resetLastPages();
+    }
+
+
+    PagedMemory::PagedMemory(const PagedMemory& other) {
+      this->copy(other);
+    }
+
+
+    PagedMemory::~PagedMemory() {
+    }
+
+
+    void PagedMemory::operator=(const PagedMemory& other) {
+      this->discardSnapshot();
+      this->copy(other);
+    }
+
+
+    /* The snapshot is not copied */
+    void PagedMemory::copy(const PagedMemory& other) {
+      this->pages        = other.pages;
+      this->snapshotFlag = false;
+      this->resetLastPages();
+    }
+
+
+    void PagedMemory::resetLastPages(void) {
+      this->lastPageBase        = 0;
+      this->lastPage            = nullptr;
+      this->lastWrittenPageBase = 0;
+      this->lastWrittenPage     = nullptr;
+    }
+
+
+    const triton::uint8* PagedMemory::findPage(triton::uint64 addr) const {
+      triton::uint64 base = pageBase(addr);
+
+      /* Fast path - consecutive accesses inside the same page */
+      if (this->lastPage != nullptr && this->lastPageBase == base)
+        return this->lastPage;
+
+      auto it = this->pages.find(base);
+      if (it == this->pages.end())
+        return nullptr;
+
+      this->lastPageBase = base;
+      this->lastPage     = it->second.data();
+
+      return this->lastPage;
+    }
+
+
+    triton::uint8* PagedMemory::mapPage(triton::uint64 addr) {
+      triton::uint64 base = pageBase(addr);
+
+      /* Fast path - consecutive writes inside the same page */
+      if (this->lastWrittenPage != nullptr && this->lastWrittenPageBase == base)
+        return this->lastWrittenPage;
+
+      auto it = this->pages.lower_bound(base);
+
+      if (it == this->pages.end() || it->first != base) {
+        if (this->snapshotFlag && this->journal.find(base) == this->journal.end())
+          this->journal.emplace(base, Page());
+        it = this->pages.emplace_hint(it, base, Page());
+        it->second.content.resize(MEMORY_PAGE_SIZE, 0x00);
+      }
+      else {
+        this->savePage(it, false);
+      }
+
+      /* Copy on write */
+      if (it->second.shared) {
+        it->second.content.assign(it->second.shared, it->second.shared + MEMORY_PAGE_SIZE);
+        it->second.shared = nullptr;
+        it->second.owner.reset();
+      }
+
+      this->lastPageBase        = base;
+      this->lastPage            = it->second.content.data();
+      this->lastWrittenPageBase = base;
+      this->lastWrittenPage     = it->second.content.data();
+
+      return this->lastWrittenPage;
+    }
+
+
+    void PagedMemory::sharePage(triton::uint64 base, const triton::uint8* content, const std::shared_ptr<const void>& owner) {
+      auto it = this->pages.lower_bound(base);
+
+      if (it == this->pages.end() || it->first != base) {
+        if (this->snapshotFlag && this->journal.find(base) == this->journal.end())
+          this->journal.emplace(base, Page());
+        it = this->pages.emplace_hint(it, base, Page());
+      }
+      else {
+        this->savePage(it, true);
+        std::vector<triton::uint8>().swap(it->second.content);
+      }
+
+      it->second.shared = content;
+      it->second.owner  = owner;
+    }
+
+
+    void PagedMemory::savePage(std::map<triton::uint64, Page>::iterator page, bool release) {
+      if (this->snapshotFlag == false)
+        return;
+
+      auto it = this->journal.lower_bound(page->first);
+      if (it != this->journal.end() && it->first == page->first)
+        return;
+
+      if (release)
+        this->journal.emplace_hint(it, page->first, std::move(page->second));
+      else
+        this->journal.emplace_hint(it, page->first, page->second);
+    }
+
+
+    triton::uint8 PagedMemory::read(triton::uint64 addr) const {
+      const triton::uint8* page = this->findPage(addr);
+
+      if (page == nullptr)
+        return 0x00;
+
+      return page[addr - pageBase(addr)];
+    }
+
+
+    void PagedMemory::read(triton::uint64 addr, triton::uint8* area, triton::usize size) const {
+      while (size) {
+        triton::usize offset = addr - pageBase(addr);
+        triton::usize chunk  = std::min<triton::usize>(size, MEMORY_PAGE_SIZE - offset);
+        const triton::uint8* page = this->findPage(addr);
+
+        if (page == nullptr)
+          std::memset(area, 0x00, chunk);
+        else
+          std::memcpy(area, page + offset, chunk);
+
+        addr += chunk;
+        area += chunk;
+        size -= chunk;
+      }
+    }
+
+
+    void PagedMemory::write(triton::uint64 addr, triton::uint8 value) {
+      this->mapPage(addr)[addr - pageBase(addr)] = value;
+    }
+
+
+    void PagedMemory::write(triton::uint64 addr, const triton::uint8* area, triton::usize size) {
+      while (size) {
+        triton::usize offset = addr - pageBase(addr);
+        triton::usize chunk  = std::min<triton::usize>(size, MEMORY_PAGE_SIZE - offset);
+
+        std::memcpy(this->mapPage(addr) + offset, area, chunk);
+
+        addr += chunk;
+        area += chunk;
+        size -= chunk;
+      }
+    }
+
+
+    void PagedMemory::mapShared(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+      if (size == 0)
+        return;
+
+      /* The pages shared below may be the last ones accessed */
+      this->resetLastPages();
+
+      while (size) {
+        triton::usize offset = baseAddr - pageBase(baseAddr);
+        triton::usize chunk  = std::min<triton::usize>(size, MEMORY_PAGE_SIZE - offset);
+
+        if (chunk == MEMORY_PAGE_SIZE)
+          this->sharePage(baseAddr, area, owner);
+        else
+          this->write(baseAddr, area, chunk);
+
+        baseAddr += chunk;
+        area     += chunk;
+        size     -= chunk;
+      }
+
+      this->resetLastPages();
+    }
+
+
+    void PagedMemory::mapZero(triton::uint64 baseAddr, triton::usize size) {
+      this->resetLastPages();
+
+      while (size) {
+        triton::usize offset = baseAddr - pageBase(baseAddr);
+        triton::usize chunk  = std::min<triton::usize>(size, MEMORY_PAGE_SIZE - offset);
+
+        if (chunk == MEMORY_PAGE_SIZE)
+          this->sharePage(baseAddr, zeroPage, nullptr);
+        else
+          this->write(baseAddr, zeroPage, chunk);
+
+        baseAddr += chunk;
+        size     -= chunk;
+      }
+
+      this->resetLastPages();
+    }
+
+
+    bool PagedMemory::isMapped(triton::uint64 baseAddr, triton::usize size) const {
+      if (size == 0)
+        return true;
+
+      triton::uint64 last = pageBase(baseAddr + (size - 1));
+      for (triton::uint64 base = pageBase(baseAddr); ; base += MEMORY_PAGE_SIZE) {
+        if (this->findPage(base) == nullptr)
+          return false;
+        if (base == last)
+          break;
+      }
+
+      return true;
+    }
+
+
+    void PagedMemory::unmapPages(triton::uint64 firstBase, triton::uint64 lastBase) {
+      auto first = this->pages.lower_bound(firstBase);
+      auto last  = this->pages.upper_bound(lastBase);
+
+      for (auto it = first; it != last; it++)
+        this->savePage(it, true);
+
+      this->pages.erase(first, last);
+    }
+
+
+    void PagedMemory::unmap(triton::uint64 baseAddr, triton::usize size) {
+      if (size == 0)
+        return;
+
+      /* The range wraps around the address space, unmap its two parts */
+      if (size - 1 > std::numeric_limits<triton::uint64>::max() - baseAddr) {
+        this->unmapPages(pageBase(baseAddr), pageBase(std::numeric_limits<triton::uint64>::max()));
+        this->unmapPages(0, pageBase(baseAddr + (size - 1)));
+      }
+      else {
+        this->unmapPages(pageBase(baseAddr), pageBase(baseAddr + (size - 1)));
+      }
+
+      this->resetLastPages();
+    }
+
+
+    void PagedMemory::clear(void) {
+      for (auto it = this->pages.begin(); it != this->pages.end(); it++)
+        this->savePage(it, true);
+
+      this->pages.clear();
+      this->resetLastPages();
+    }
+
+
+    triton::usize PagedMemory::getNumberOfPages(void) const {
+      return this->pages.size();
+    }
+
+
+    triton::usize PagedMemory::getNumberOfSharedPages(void) const {
+      triton::usize count = 0;
+
+      for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+        if (it->second.shared)
+          count++;
+      }
+
+      return count;
+    }
+
+
+    void PagedMemory::takeSnapshot(void) {
+      this->journal.clear();
+      this->snapshotFlag = true;
+
+      /* The next write must save its page */
+      this->lastWrittenPageBase = 0;
+      this->lastWrittenPage     = nullptr;
+    }
+
+
+    void PagedMemory::restoreSnapshot(void) {
+      for (auto it = this->journal.begin(); it != this->journal.end(); it++) {
+        /* The page was not mapped */
+        if (!it->second.isMapped())
+          this->pages.erase(it->first);
+        else
+          this->pages[it->first] = std::move(it->second);
+      }
+
+      this->journal.clear();
+      this->resetLastPages();
+    }
+
+
+    void PagedMemory::discardSnapshot(void) {
+      this->journal.clear();
+      this->snapshotFlag = false;
+      this->lastWrittenPageBase = 0;
+      this->lastWrittenPage     = nullptr;
+    }
+
+
+    bool PagedMemory::isSnapshotEnabled(void) const {
+      return this->snapshotFlag;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -21,7 +21,7 @@ namespace triton {
 
 
     Register::Register(triton::uint32 regId) {
-      if (!triton::api.isArchitectureValid()) {
+      if (!triton::currentApi().isArchitectureValid()) {
         this->clear();
         return;
       }
@@ -38,7 +38,7 @@ namespace triton {
 
 
     Register::Register(triton::uint32 regId, triton::uint512 concreteValue, bool immutable) {
-      if (!triton::api.isArchitectureValid()) {
+      if (!triton::currentApi().isArchitectureValid()) {
         this->clear();
         return;
       }
@@ -79,10 +79,10 @@ namespace triton {
       triton::arch::RegisterSpecification regInfo;
 
       this->id = regId;
-      if (!triton::api.isRegisterValid(regId))
+      if (!triton::currentApi().isRegisterValid(regId))
         this->id = triton::arch::INVALID_REGISTER_ID;
 
-      regInfo      = triton::api.getRegisterSpecification(this->id);
+      regInfo      = triton::currentApi().getRegisterSpecification(this->id);
       this->name   = regInfo.getName();
       this->parent = regInfo.getParentId();
 
@@ -0,0 +1,845 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/x86ConcreteSemantics.hpp>
+#include <triton/x86Specifications.hpp>
+
+
+
+/*! \page concrete_fast_path_page Concrete Fast Path
+    \brief [**internal**] The concrete fast path of the x86 semantics.
+
+\tableofcontents
+
+\section concrete_fast_path_description Description
+<hr>
+
+When the triton::modes::CONCRETE_FAST_PATH mode is enabled, the IR builder first tries to execute the instruction natively.
+If none of the registers and memory cells read by the instruction (including the registers used to compute the effective
+addresses, the stack pointer and the flags) is symbolized or tainted, the concrete state is updated with native arithmetic,
+the written registers and memory cells are concretized and untainted, and no AST is built. Otherwise, the full semantics
+are used. The following instructions are handled natively: `nop`, `mov`, `movzx`, `movsx`, `movsxd`, `lea`, `add`, `sub`, `cmp`,
+`and`, `or`, `xor`, `test`, `inc`, `dec`, `push`, `pop`, `call`, `ret`, `jmp` and `jcc` (except `jcxz`, `jecxz` and `jrcxz`),
+without prefix and only with general purpose registers.
+
+Note that an instruction executed natively has no symbolic expression and does not add any path constraint (its branch is
+concrete, see triton::modes::PC_TRACKING_SYMBOLIC).
+Its accesses are recorded as with the full semantics (see triton::arch::Instruction::getLoadAccess(),
+triton::arch::Instruction::getStoreAccess(), triton::arch::Instruction::getReadRegisters(),
+triton::arch::Instruction::getWrittenRegisters() and triton::arch::Instruction::getReadImmediates()) but their AST is
+null.
+
+\section concrete_fast_path_taint Taint-only mode
+<hr>
+
+When the symbolic engine is disabled, the IR builder always tries the native semantics first, whatever the
+triton::modes::CONCRETE_FAST_PATH mode. The inputs may then be tainted: the concrete state is updated with native arithmetic,
+the symbolic state is left untouched and the taint is spread through the operands with the
+triton::engines::taint::TaintEngine routines, as the full semantics do. Only the instructions which are not handled natively fall back to the full semantics. They build ASTs, which are
+temporary and freed once the instruction is processed.
+
+*/
+
+
+
+namespace triton {
+  namespace arch {
+    namespace x86 {
+
+      /* Returns the mask of a vector of `bits` bits */
+      static inline triton::uint64 maskOf(triton::uint32 bits) {
+        return (bits >= QWORD_SIZE_BIT) ? 0xffffffffffffffff : ((static_cast<triton::uint64>(1) << bits) - 1);
+      }
+
+
+      /* Returns the most significant bit of a vector of `bits` bits */
+      static inline bool msbOf(triton::uint64 value, triton::uint32 bits) {
+        return ((value >> (bits - 1)) & 1) != 0;
+      }
+
+
+      /* Sign extends a vector of `bits` bits to 64 bits */
+      static inline triton::uint64 sxOf(triton::uint64 value, triton::uint32 bits) {
+        if (bits >= QWORD_SIZE_BIT || !msbOf(value, bits))
+          return value;
+        return value | ~maskOf(bits);
+      }
+
+
+      /* Returns true if the register is a general purpose register */
+      static inline bool isGprOf(const triton::arch::Register& reg) {
+        return (reg.getId() >= triton::arch::x86::ID_REG_RAX && reg.getId() < triton::arch::x86::ID_REG_EFLAGS);
+      }
+
+
+      x86ConcreteSemantics::x86ConcreteSemantics(triton::arch::Architecture* architecture,
+                                                 triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                                 triton::engines::taint::TaintEngine* taintEngine) {
+
+        this->architecture    = architecture;
+        this->symbolicEngine  = symbolicEngine;
+        this->taintEngine     = taintEngine;
+        this->taintOnly       = false;
+
+        if (this->architecture == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The architecture API must be defined.");
+
+        if (this->symbolicEngine == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The symbolic engine API must be defined.");
+
+        if (this->taintEngine == nullptr)
+          throw triton::exceptions::Semantics("x86ConcreteSemantics::x86ConcreteSemantics(): The taint engines API must be defined.");
+      }
+
+
+      x86ConcreteSemantics::~x86ConcreteSemantics() {
+      }
+
+
+      bool x86ConcreteSemantics::isConcreteRegister(const triton::arch::Register& reg) const {
+        if (this->symbolicEngine->isRegisterSymbolized(reg))
+          return false;
+        return (this->taintOnly || !this->taintEngine->isRegisterTainted(reg));
+      }
+
+
+      bool x86ConcreteSemantics::isConcreteMemory(triton::uint64 addr, triton::uint32 size) const {
+        if (this->symbolicEngine->isMemorySymbolized(addr, size))
+          return false;
+        return (this->taintOnly || !this->taintEngine->isMemoryTainted(addr, size));
+      }
+
+
+      bool x86ConcreteSemantics::isConcreteOperand(const triton::arch::OperandWrapper& op, triton::usize index) const {
+        switch (op.getType()) {
+          case triton::arch::OP_REG: return this->isConcreteRegister(op.getConstRegister());
+          case triton::arch::OP_MEM: return this->isConcreteMemory(this->addresses[index], op.getSize());
+          default:
+            return true;
+        }
+      }
+
+
+      bool x86ConcreteSemantics::isFullWrite(const triton::arch::Register& reg) const {
+        /* On x86-64, a 32-bit register write zero-extends the parent register */
+        if (this->architecture->getArchitecture() == triton::arch::ARCH_X86_64 && reg.getBitSize() == DWORD_SIZE_BIT)
+          return true;
+        return (reg.getBitSize() == reg.getParent().getBitSize());
+      }
+
+
+      bool x86ConcreteSemantics::initOperands(triton::arch::Instruction& inst) {
+        this->addresses.clear();
+
+        for (auto it = inst.operands.begin(); it != inst.operands.end(); it++) {
+          triton::uint64 address = 0;
+
+          switch (it->getType()) {
+            case triton::arch::OP_IMM:
+              break;
+
+            case triton::arch::OP_REG:
+              if (!isGprOf(it->getConstRegister()))
+                return false;
+              break;
+
+            case triton::arch::OP_MEM: {
+              const triton::arch::MemoryAccess& mem = it->getConstMemory();
+              const triton::arch::Register& base    = mem.getConstBaseRegister();
+              const triton::arch::Register& index   = mem.getConstIndexRegister();
+              const triton::arch::Register& seg     = mem.getConstSegmentRegister();
+              bool validBase                        = this->architecture->isRegisterValid(base);
+              bool validIndex                       = this->architecture->isRegisterValid(index);
+              bool validSeg                         = this->architecture->isRegisterValid(seg);
+
+              if (mem.getSize() == 0 || mem.getSize() > QWORD_SIZE)
+                return false;
+
+              /* The effective address must be concrete */
+              if ((validBase && !this->isConcreteRegister(base)) || (validIndex && !this->isConcreteRegister(index)) || (validSeg && !this->isConcreteRegister(seg)))
+                return false;
+
+              /* Same computation as SymbolicEngine::initLeaAst() -> ((pc + base) + (index * scale) + disp) */
+              triton::uint32 bitSize = (validIndex ? index.getBitSize() :
+                                         (validBase ? base.getBitSize() :
+                                           (mem.getConstDisplacement().getBitSize() ? mem.getConstDisplacement().getBitSize() :
+                                             this->architecture->registerBitSize()
+                                           )
+                                         )
+                                       );
+
+              address  = (mem.getPcRelative() ? mem.getPcRelative() : (validBase ? this->architecture->getConcreteRegisterValue(base).convert_to<triton::uint64>() : 0));
+              address += (validIndex ? this->architecture->getConcreteRegisterValue(index).convert_to<triton::uint64>() : 0) * mem.getConstScale().getValue();
+              address += mem.getConstDisplacement().getValue();
+              address &= maskOf(bitSize);
+
+              /* Use segments as base address instead of selector into the GDT. */
+              triton::uint64 segmentValue = (validSeg ? this->architecture->getConcreteRegisterValue(seg).convert_to<triton::uint64>() : 0);
+              if (segmentValue)
+                address = (segmentValue + sxOf(address, bitSize)) & maskOf(seg.getBitSize());
+
+              /* The address is only initialized if it is not already defined */
+              if (mem.getAddress())
+                address = mem.getAddress();
+
+              break;
+            }
+
+            default:
+              return false;
+          }
+
+          this->addresses.push_back(address);
+        }
+
+        return true;
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::readRegister(triton::arch::Instruction& inst, const triton::arch::Register& reg) {
+        triton::arch::Register r = reg;
+
+        r.setConcreteValue(this->architecture->getConcreteRegisterValue(reg));
+        inst.setReadRegister(r, nullptr);
+
+        return r.getConcreteValue().convert_to<triton::uint64>();
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::readMemory(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem) {
+        mem.setConcreteValue(this->architecture->getConcreteMemoryValue(mem));
+        inst.setLoadAccess(mem, nullptr);
+
+        return mem.getConcreteValue().convert_to<triton::uint64>();
+      }
+
+
+      triton::uint64 x86ConcreteSemantics::readOperand(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op) {
+        triton::uint64 value = 0;
+
+        switch (op.getType()) {
+          case triton::arch::OP_IMM:
+            value = op.getConstImmediate().getValue() & maskOf(op.getBitSize());
+            inst.setReadImmediate(op.getConstImmediate(), nullptr);
+            break;
+
+          case triton::arch::OP_REG:
+            value = this->readRegister(inst, op.getConstRegister());
+            op.getRegister().setConcreteValue(value);
+            break;
+
+          case triton::arch::OP_MEM:
+            value = this->readMemory(inst, op.getMemory());
+            break;
+
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::readOperand(): Invalid operand.");
+        }
+
+        return value;
+      }
+
+
+      void x86ConcreteSemantics::writeRegister(triton::arch::Instruction& inst, const triton::arch::Register& reg, triton::uint64 value) {
+        triton::arch::Register r = reg;
+
+        r.setConcreteValue(value & maskOf(reg.getBitSize()));
+
+        /* On x86-64, a 32-bit register write zero-extends the parent register */
+        if (this->architecture->getArchitecture() == triton::arch::ARCH_X86_64 && reg.getBitSize() == DWORD_SIZE_BIT) {
+          triton::arch::Register parent = reg.getParent();
+          parent.setConcreteValue(r.getConcreteValue());
+          this->architecture->setConcreteRegisterValue(parent);
+        }
+        else {
+          this->architecture->setConcreteRegisterValue(r);
+        }
+
+        /* In the taint-only mode, only the concrete state is synchronized */
+        if (!this->taintOnly) {
+          this->symbolicEngine->concretizeRegister(reg);
+          this->taintEngine->untaintRegister(reg);
+        }
+        inst.setWrittenRegister(r, nullptr);
+      }
+
+
+      void x86ConcreteSemantics::writeMemory(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem, triton::uint64 value) {
+        mem.setConcreteValue(value & maskOf(mem.getBitSize()));
+
+        this->architecture->setConcreteMemoryValue(mem);
+        /* In the taint-only mode, only the concrete state is synchronized */
+        if (!this->taintOnly) {
+          this->symbolicEngine->concretizeMemory(mem);
+          this->taintEngine->untaintMemory(mem);
+        }
+        inst.setStoreAccess(mem, nullptr);
+      }
+
+
+      void x86ConcreteSemantics::writeOperand(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op, triton::uint64 value) {
+        switch (op.getType()) {
+          case triton::arch::OP_REG:
+            this->writeRegister(inst, op.getConstRegister(), value);
+            op.getRegister().setConcreteValue(value & maskOf(op.getBitSize()));
+            break;
+
+          case triton::arch::OP_MEM:
+            this->writeMemory(inst, op.getMemory(), value);
+            break;
+
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::writeOperand(): Invalid operand.");
+        }
+      }
+
+
+      void x86ConcreteSemantics::setResultFlags(triton::arch::Instruction& inst, triton::uint64 result, triton::uint32 bits) {
+        /* PF is set if the least significant byte of the result has an even number of bits set */
+        triton::uint8 parity = static_cast<triton::uint8>(result & 0xff);
+        parity ^= parity >> 4;
+        parity ^= parity >> 2;
+        parity ^= parity >> 1;
+
+        this->writeRegister(inst, TRITON_X86_REG_PF, (parity & 1) == 0);
+        this->writeRegister(inst, TRITON_X86_REG_SF, msbOf(result, bits));
+        this->writeRegister(inst, TRITON_X86_REG_ZF, (result & maskOf(bits)) == 0);
+      }
+
+
+      bool x86ConcreteSemantics::getCondition(triton::arch::Instruction& inst, triton::uint32 type) {
+        switch (type) {
+          case ID_INS_JA:   return !this->readRegister(inst, TRITON_X86_REG_CF) && !this->readRegister(inst, TRITON_X86_REG_ZF);
+          case ID_INS_JAE:  return !this->readRegister(inst, TRITON_X86_REG_CF);
+          case ID_INS_JB:   return this->readRegister(inst, TRITON_X86_REG_CF) != 0;
+          case ID_INS_JBE:  return this->readRegister(inst, TRITON_X86_REG_CF) || this->readRegister(inst, TRITON_X86_REG_ZF);
+          case ID_INS_JE:   return this->readRegister(inst, TRITON_X86_REG_ZF) != 0;
+          case ID_INS_JG:   return !this->readRegister(inst, TRITON_X86_REG_ZF) && (this->readRegister(inst, TRITON_X86_REG_SF) == this->readRegister(inst, TRITON_X86_REG_OF));
+          case ID_INS_JGE:  return this->readRegister(inst, TRITON_X86_REG_SF) == this->readRegister(inst, TRITON_X86_REG_OF);
+          case ID_INS_JL:   return this->readRegister(inst, TRITON_X86_REG_SF) != this->readRegister(inst, TRITON_X86_REG_OF);
+          case ID_INS_JLE:  return this->readRegister(inst, TRITON_X86_REG_ZF) || (this->readRegister(inst, TRITON_X86_REG_SF) != this->readRegister(inst, TRITON_X86_REG_OF));
+          case ID_INS_JNE:  return !this->readRegister(inst, TRITON_X86_REG_ZF);
+          case ID_INS_JNO:  return !this->readRegister(inst, TRITON_X86_REG_OF);
+          case ID_INS_JNP:  return !this->readRegister(inst, TRITON_X86_REG_PF);
+          case ID_INS_JNS:  return !this->readRegister(inst, TRITON_X86_REG_SF);
+          case ID_INS_JO:   return this->readRegister(inst, TRITON_X86_REG_OF) != 0;
+          case ID_INS_JP:   return this->readRegister(inst, TRITON_X86_REG_PF) != 0;
+          case ID_INS_JS:   return this->readRegister(inst, TRITON_X86_REG_SF) != 0;
+          default:
+            throw triton::exceptions::Semantics("x86ConcreteSemantics::getCondition(): Invalid conditional jump.");
+        }
+      }
+
+
+      triton::usize x86ConcreteSemantics::getConditionFlags(triton::uint32 type, const triton::arch::Register* flags[3]) const {
+        switch (type) {
+          case ID_INS_JA:
+          case ID_INS_JBE:
+            flags[0] = &TRITON_X86_REG_CF;
+            flags[1] = &TRITON_X86_REG_ZF;
+            return 2;
+
+          case ID_INS_JAE:
+          case ID_INS_JB:
+            flags[0] = &TRITON_X86_REG_CF;
+            return 1;
+
+          case ID_INS_JE:
+          case ID_INS_JNE:
+            flags[0] = &TRITON_X86_REG_ZF;
+            return 1;
+
+          case ID_INS_JG:
+          case ID_INS_JLE:
+            flags[0] = &TRITON_X86_REG_ZF;
+            flags[1] = &TRITON_X86_REG_SF;
+            flags[2] = &TRITON_X86_REG_OF;
+            return 3;
+
+          case ID_INS_JGE:
+          case ID_INS_JL:
+            flags[0] = &TRITON_X86_REG_SF;
+            flags[1] = &TRITON_X86_REG_OF;
+            return 2;
+
+          case ID_INS_JNO:
+          case ID_INS_JO:
+            flags[0] = &TRITON_X86_REG_OF;
+            return 1;
+
+          case ID_INS_JNP:
+          case ID_INS_JP:
+            flags[0] = &TRITON_X86_REG_PF;
+            return 1;
+
+          case ID_INS_JNS:
+          case ID_INS_JS:
+            flags[0] = &TRITON_X86_REG_SF;
+            return 1;
+
+          default:
+            return 0;
+        }
+      }
+
+
+      bool x86ConcreteSemantics::isConcreteCondition(triton::uint32 type) const {
+        const triton::arch::Register* flags[3];
+        triton::usize count = this->getConditionFlags(type, flags);
+
+        if (count == 0)
+          return false;
+
+        for (triton::usize index = 0; index < count; index++) {
+          if (!this->isConcreteRegister(*flags[index]))
+            return false;
+        }
+
+        return true;
+      }
+
+
+      bool x86ConcreteSemantics::spreadTaint(triton::arch::Instruction& inst) {
+        triton::uint32 type  = inst.getType();
+        auto pc              = triton::arch::OperandWrapper(TRITON_X86_REG_PC.getParent());
+        auto stack           = TRITON_X86_REG_SP.getParent();
+        triton::uint64 sp    = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+        bool tainted         = false;
+        bool result          = false;
+
+        /* Same spreading as the x86Semantics handlers */
+        switch (type) {
+          case ID_INS_NOP:
+            break;
+
+          case ID_INS_MOV:
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVZX:
+            tainted = this->taintEngine->taintAssignment(inst.operands[0], inst.operands[1]);
+            break;
+
+          case ID_INS_LEA: {
+            const triton::arch::MemoryAccess& mem = inst.operands[1].getConstMemory();
+            const triton::arch::Register& base    = mem.getConstBaseRegister();
+            const triton::arch::Register& index   = mem.getConstIndexRegister();
+            bool taintedBase                      = this->architecture->isRegisterValid(base) && this->taintEngine->isRegisterTainted(base);
+            bool taintedIndex                     = this->architecture->isRegisterValid(index) && this->taintEngine->isRegisterTainted(index);
+            tainted = this->taintEngine->setTaint(inst.operands[0], taintedBase | taintedIndex);
+            break;
+          }
+
+          case ID_INS_ADD:
+          case ID_INS_AND:
+          case ID_INS_OR:
+          case ID_INS_SUB:
+          case ID_INS_XOR:
+            tainted = result = this->taintEngine->taintUnion(inst.operands[0], inst.operands[1]);
+            break;
+
+          case ID_INS_CMP:
+          case ID_INS_TEST:
+            tainted = result = this->taintEngine->isTainted(inst.operands[0]) | this->taintEngine->isTainted(inst.operands[1]);
+            break;
+
+          case ID_INS_DEC:
+          case ID_INS_INC:
+            tainted = result = this->taintEngine->taintUnion(inst.operands[0], inst.operands[0]);
+            break;
+
+          case ID_INS_PUSH: {
+            /* If it's an immediate source, the memory access is always based on the arch size */
+            triton::uint32 size = (inst.operands[0].getType() == triton::arch::OP_IMM ? stack.getSize() : inst.operands[0].getSize());
+            auto dst            = triton::arch::OperandWrapper(triton::arch::MemoryAccess(sp - size, size));
+            tainted = this->taintEngine->taintAssignment(dst, inst.operands[0]);
+            break;
+          }
+
+          case ID_INS_POP: {
+            auto src = triton::arch::OperandWrapper(triton::arch::MemoryAccess(sp, inst.operands[0].getSize()));
+            tainted = this->taintEngine->taintAssignment(inst.operands[0], src);
+            break;
+          }
+
+          case ID_INS_CALL:
+            tainted  = this->taintEngine->taintAssignmentMemoryImmediate(triton::arch::MemoryAccess(sp - stack.getSize(), stack.getSize()));
+            tainted |= this->taintEngine->taintAssignment(pc, inst.operands[0]);
+            return tainted;
+
+          case ID_INS_RET: {
+            auto src = triton::arch::OperandWrapper(triton::arch::MemoryAccess(sp, stack.getSize()));
+            return this->taintEngine->taintAssignment(pc, src);
+          }
+
+          case ID_INS_JMP:
+            return this->taintEngine->taintAssignment(pc, inst.operands[0]);
+
+          default: {
+            /* Conditional jumps */
+            const triton::arch::Register* flags[3];
+            triton::usize count = this->getConditionFlags(type, flags);
+            for (triton::usize index = 0; index < count; index++)
+              tainted |= this->taintEngine->isRegisterTainted(*flags[index]);
+            return this->taintEngine->setTaintRegister(pc.getConstRegister(), tainted);
+          }
+        }
+
+        /* The flags are tainted by the result */
+        switch (type) {
+          case ID_INS_ADD:
+          case ID_INS_CMP:
+          case ID_INS_SUB:
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, result);
+            /* Fall through */
+
+          case ID_INS_DEC:
+          case ID_INS_INC:
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_AF, result);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, result);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_PF, result);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_SF, result);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_ZF, result);
+            break;
+
+          case ID_INS_AND:
+          case ID_INS_OR:
+          case ID_INS_TEST:
+          case ID_INS_XOR:
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, triton::engines::taint::UNTAINTED);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, triton::engines::taint::UNTAINTED);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_PF, result);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_SF, result);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_ZF, result);
+            break;
+        }
+
+        /* The next address is concrete, see x86Semantics::controlFlow_s() */
+        this->taintEngine->setTaintRegister(pc.getConstRegister(), triton::engines::taint::UNTAINTED);
+
+        return tainted;
+      }
+
+
+      bool x86ConcreteSemantics::buildSemantics(triton::arch::Instruction& inst) {
+        triton::uint32 type  = inst.getType();
+        triton::usize  count = inst.operands.size();
+        auto pc              = TRITON_X86_REG_PC.getParent();
+        auto stack           = TRITON_X86_REG_SP.getParent();
+
+        /* Prefixes (REP, LOCK, ...) always go through the full semantics */
+        if (inst.getPrefix() != triton::arch::x86::ID_PREFIX_INVALID)
+          return false;
+
+        /* Without symbolic engine, tainted inputs are allowed and the taint is spread */
+        this->taintOnly = !this->symbolicEngine->isEnabled();
+
+        /* Checks that the operands are supported and that all inputs are concrete */
+        switch (type) {
+          case ID_INS_NOP:
+            break;
+
+          case ID_INS_LEA:
+          case ID_INS_MOV:
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVZX:
+            if (count != 2 || (inst.operands[0].getType() != triton::arch::OP_REG && inst.operands[0].getType() != triton::arch::OP_MEM))
+              return false;
+            if (type == ID_INS_LEA && (inst.operands[0].getType() != triton::arch::OP_REG || inst.operands[1].getType() != triton::arch::OP_MEM))
+              return false;
+            break;
+
+          case ID_INS_ADD:
+          case ID_INS_AND:
+          case ID_INS_CMP:
+          case ID_INS_OR:
+          case ID_INS_SUB:
+          case ID_INS_TEST:
+          case ID_INS_XOR:
+            if (count != 2 || (inst.operands[0].getType() != triton::arch::OP_REG && inst.operands[0].getType() != triton::arch::OP_MEM))
+              return false;
+            break;
+
+          case ID_INS_DEC:
+          case ID_INS_INC:
+            if (count != 1 || (inst.operands[0].getType() != triton::arch::OP_REG && inst.operands[0].getType() != triton::arch::OP_MEM))
+              return false;
+            break;
+
+          case ID_INS_CALL:
+          case ID_INS_JMP:
+          case ID_INS_POP:
+          case ID_INS_PUSH:
+            if (count != 1)
+              return false;
+            /* The stack pointer as operand is left to the full semantics */
+            if (inst.operands[0].getType() == triton::arch::OP_REG && inst.operands[0].getConstRegister().getParent().getId() == stack.getId())
+              return false;
+            if (type == ID_INS_POP && inst.operands[0].getType() != triton::arch::OP_REG)
+              return false;
+            if (type == ID_INS_PUSH && inst.operands[0].getType() == triton::arch::OP_MEM)
+              return false;
+            break;
+
+          case ID_INS_RET:
+            if (count > 1 || (count == 1 && inst.operands[0].getType() != triton::arch::OP_IMM))
+              return false;
+            break;
+
+          case ID_INS_JA:
+          case ID_INS_JAE:
+          case ID_INS_JB:
+          case ID_INS_JBE:
+          case ID_INS_JE:
+          case ID_INS_JG:
+          case ID_INS_JGE:
+          case ID_INS_JL:
+          case ID_INS_JLE:
+          case ID_INS_JNE:
+          case ID_INS_JNO:
+          case ID_INS_JNP:
+          case ID_INS_JNS:
+          case ID_INS_JO:
+          case ID_INS_JP:
+          case ID_INS_JS:
+            if (count != 1 || inst.operands[0].getType() != triton::arch::OP_IMM || !this->isConcreteCondition(type))
+              return false;
+            break;
+
+          default:
+            return false;
+        }
+
+        if (!this->initOperands(inst))
+          return false;
+
+        switch (type) {
+          /* The destination is only an input if the write is partial */
+          case ID_INS_LEA:
+          case ID_INS_MOV:
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVZX:
+            if (inst.operands[0].getType() == triton::arch::OP_REG && !this->isFullWrite(inst.operands[0].getConstRegister()) && !this->isConcreteOperand(inst.operands[0], 0))
+              return false;
+            if (type != ID_INS_LEA && !this->isConcreteOperand(inst.operands[1], 1))
+              return false;
+            break;
+
+          case ID_INS_POP:
+            if (!this->isFullWrite(inst.operands[0].getConstRegister()) && !this->isConcreteOperand(inst.operands[0], 0))
+              return false;
+            /* Fall through */
+
+          case ID_INS_RET:
+            if (!this->isConcreteRegister(stack))
+              return false;
+            if (!this->isConcreteMemory(this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>(), (type == ID_INS_POP ? inst.operands[0].getSize() : stack.getSize())))
+              return false;
+            break;
+
+          case ID_INS_CALL:
+          case ID_INS_PUSH:
+            if (!this->isConcreteRegister(stack))
+              return false;
+            /* Fall through */
+
+          default:
+            for (triton::usize index = 0; index < count; index++) {
+              if (!this->isConcreteOperand(inst.operands[index], index))
+                return false;
+            }
+            break;
+        }
+
+        /* From here, the instruction is executed natively */
+        if (!inst.getAddress())
+          inst.setAddress(this->architecture->getConcreteRegisterValue(pc).convert_to<triton::uint64>());
+
+        for (triton::usize index = 0; index < count; index++) {
+          if (inst.operands[index].getType() == triton::arch::OP_MEM && !inst.operands[index].getConstMemory().getAddress())
+            inst.operands[index].getMemory().setAddress(this->addresses[index]);
+        }
+
+        triton::uint64 next = inst.getNextAddress();
+
+        /* The taint is spread from the inputs before they are overwritten */
+        if (this->taintOnly)
+          inst.setTaint(this->spreadTaint(inst));
+
+        switch (type) {
+          case ID_INS_NOP:
+            break;
+
+          case ID_INS_MOV:
+          case ID_INS_MOVZX:
+            this->writeOperand(inst, inst.operands[0], this->readOperand(inst, inst.operands[1]));
+            break;
+
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+            this->writeOperand(inst, inst.operands[0], sxOf(this->readOperand(inst, inst.operands[1]), inst.operands[1].getBitSize()));
+            break;
+
+          case ID_INS_LEA: {
+            /* Same computation as x86Semantics::lea_s() */
+            auto& mem               = inst.operands[1].getMemory();
+            auto& base              = mem.getBaseRegister();
+            auto& index             = mem.getIndexRegister();
+            triton::uint32 leaSize  = (this->architecture->isRegisterValid(base) ? base.getBitSize() :
+                                        (this->architecture->isRegisterValid(index) ? index.getBitSize() : mem.getDisplacement().getBitSize()));
+            triton::uint64 value    = mem.getDisplacement().getValue();
+
+            if (this->architecture->isRegisterValid(base)) {
+              value += this->readRegister(inst, base);
+              if (base.getParent().getId() == pc.getId())
+                value += inst.getSize();
+            }
+
+            if (this->architecture->isRegisterValid(index))
+              value += this->readRegister(inst, index) * mem.getScale().getValue();
+
+            this->writeOperand(inst, inst.operands[0], value & maskOf(leaSize));
+            break;
+          }
+
+          case ID_INS_ADD:
+          case ID_INS_CMP:
+          case ID_INS_SUB: {
+            triton::uint32 bits = inst.operands[0].getBitSize();
+            triton::uint64 op1  = this->readOperand(inst, inst.operands[0]);
+            triton::uint64 op2  = this->readOperand(inst, inst.operands[1]) & maskOf(bits);
+            triton::uint64 res  = ((type == ID_INS_ADD) ? (op1 + op2) : (op1 - op2)) & maskOf(bits);
+
+            if (type != ID_INS_CMP)
+              this->writeOperand(inst, inst.operands[0], res);
+
+            this->writeRegister(inst, TRITON_X86_REG_AF, ((op1 ^ op2 ^ res) & 0x10) != 0);
+            if (type == ID_INS_ADD) {
+              this->writeRegister(inst, TRITON_X86_REG_CF, res < op1);
+              this->writeRegister(inst, TRITON_X86_REG_OF, msbOf((op1 ^ res) & (op2 ^ res), bits));
+            }
+            else {
+              this->writeRegister(inst, TRITON_X86_REG_CF, op1 < op2);
+              this->writeRegister(inst, TRITON_X86_REG_OF, msbOf((op1 ^ op2) & (op1 ^ res), bits));
+            }
+            this->setResultFlags(inst, res, bits);
+            break;
+          }
+
+          case ID_INS_AND:
+          case ID_INS_OR:
+          case ID_INS_TEST:
+          case ID_INS_XOR: {
+            triton::uint32 bits = inst.operands[0].getBitSize();
+            triton::uint64 op1  = this->readOperand(inst, inst.operands[0]);
+            triton::uint64 op2  = this->readOperand(inst, inst.operands[1]) & maskOf(bits);
+            triton::uint64 res  = 0;
+
+            switch (type) {
+              case ID_INS_OR:  res = op1 | op2; break;
+              case ID_INS_XOR: res = op1 ^ op2; break;
+              default:         res = op1 & op2; break;
+            }
+
+            if (type != ID_INS_TEST)
+              this->writeOperand(inst, inst.operands[0], res);
+
+            this->writeRegister(inst, TRITON_X86_REG_CF, 0);
+            this->writeRegister(inst, TRITON_X86_REG_OF, 0);
+            this->setResultFlags(inst, res, bits);
+            break;
+          }
+
+          case ID_INS_DEC:
+          case ID_INS_INC: {
+            triton::uint32 bits = inst.operands[0].getBitSize();
+            triton::uint64 op1  = this->readOperand(inst, inst.operands[0]);
+            triton::uint64 res  = ((type == ID_INS_INC) ? (op1 + 1) : (op1 - 1)) & maskOf(bits);
+
+            this->writeOperand(inst, inst.operands[0], res);
+
+            this->writeRegister(inst, TRITON_X86_REG_AF, ((op1 ^ 1 ^ res) & 0x10) != 0);
+            if (type == ID_INS_INC)
+              this->writeRegister(inst, TRITON_X86_REG_OF, msbOf((op1 ^ res) & (1 ^ res), bits));
+            else
+              this->writeRegister(inst, TRITON_X86_REG_OF, msbOf((op1 ^ 1) & (op1 ^ res), bits));
+            this->setResultFlags(inst, res, bits);
+            break;
+          }
+
+          case ID_INS_PUSH: {
+            /* If it's an immediate source, the memory access is always based on the arch size */
+            triton::uint32 size = (inst.operands[0].getType() == triton::arch::OP_IMM ? stack.getSize() : inst.operands[0].getSize());
+            triton::uint64 sp   = this->readRegister(inst, stack) - size;
+            triton::uint64 src  = this->readOperand(inst, inst.operands[0]);
+            triton::arch::MemoryAccess dst(sp, size);
+
+            this->writeRegister(inst, stack, sp);
+            this->writeMemory(inst, dst, src);
+            break;
+          }
+
+          case ID_INS_POP: {
+            triton::uint32 size = inst.operands[0].getSize();
+            triton::uint64 sp   = this->readRegister(inst, stack);
+            triton::arch::MemoryAccess src(sp, size);
+
+            this->writeOperand(inst, inst.operands[0], this->readMemory(inst, src));
+            this->writeRegister(inst, stack, sp + size);
+            break;
+          }
+
+          case ID_INS_CALL: {
+            triton::uint64 target = this->readOperand(inst, inst.operands[0]);
+            triton::uint64 sp     = this->readRegister(inst, stack) - stack.getSize();
+            triton::arch::MemoryAccess dst(sp, stack.getSize());
+
+            this->writeRegister(inst, stack, sp);
+            this->writeMemory(inst, dst, next);
+            next = target;
+            break;
+          }
+
+          case ID_INS_RET: {
+            triton::uint64 sp = this->readRegister(inst, stack);
+            triton::arch::MemoryAccess src(sp, stack.getSize());
+
+            next = this->readMemory(inst, src);
+            sp  += stack.getSize();
+            if (count == 1)
+              sp += this->readOperand(inst, inst.operands[0]);
+
+            this->writeRegister(inst, stack, sp);
+            break;
+          }
+
+          case ID_INS_JMP:
+            next = this->readOperand(inst, inst.operands[0]);
+            inst.setConditionTaken(true);
+            break;
+
+          default:
+            /* Conditional jumps */
+            if (this->getCondition(inst, type)) {
+              next = this->readOperand(inst, inst.operands[0]);
+              inst.setConditionTaken(true);
+            }
+            break;
+        }
+
+        /* Update the program counter */
+        this->writeRegister(inst, pc, next);
+
+        return true;
+      }
+
+    }; /* x86 namespace */
+  }; /* arch namespace */
+}; /* triton namespace */
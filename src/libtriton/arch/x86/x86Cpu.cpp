@@ -22,23 +22,39 @@ namespace triton {
 
       x86Cpu::x86Cpu(triton::callbacks::Callbacks* callbacks) {
         this->callbacks = callbacks;
+        this->openCapstone();
         this->clear();
       }
 
 
       x86Cpu::x86Cpu(const x86Cpu& other) {
+        this->openCapstone();
         this->copy(other);
       }
 
 
       x86Cpu::~x86Cpu() {
         this->memory.clear();
+        triton::extlibs::capstone::cs_close(&this->handle);
+      }
+
+
+      void x86Cpu::openCapstone(void) {
+        /* Open capstone */
+        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_32, &this->handle) != triton::extlibs::capstone::CS_ERR_OK)
+          throw triton::exceptions::Disassembly("x86Cpu::openCapstone(): Cannot open capstone.");
+
+        /* Init capstone's options */
+        triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
+        triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
       }
 
 
       void x86Cpu::copy(const x86Cpu& other) {
-        this->callbacks = other.callbacks;
-        this->memory    = other.memory;
+        this->callbacks         = other.callbacks;
+        this->disassemblyCache  = other.disassemblyCache;
+        this->memory            = other.memory;
+        this->snapshotRegisters.clear();
 
         std::memcpy(this->eax,     other.eax,    sizeof(this->eax));
         std::memcpy(this->ebx,     other.ebx,    sizeof(this->ebx));
@@ -513,7 +529,6 @@ namespace triton {
 
 
       void x86Cpu::disassembly(triton::arch::Instruction& inst) const {
-        triton::extlibs::capstone::csh       handle;
         triton::extlibs::capstone::cs_insn*  insn;
         triton::usize                        count = 0;
 
@@ -521,16 +536,12 @@ namespace triton {
         if (inst.getOpcodes() == nullptr || inst.getSize() == 0)
           throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Opcodes and opcodesSize must be definied.");
 
-        /* Open capstone */
-        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_32, &handle) != triton::extlibs::capstone::CS_ERR_OK)
-          throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Cannot open capstone.");
-
-        /* Init capstone's options */
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
+        /* Reuse the decoding if this instruction has already been disassembled */
+        if (this->disassemblyCache.load(inst))
+          return;
 
         /* Let's disass and build our operands */
-        count = triton::extlibs::capstone::cs_disasm(handle, inst.getOpcodes(), inst.getSize(), inst.getAddress(), 0, &insn);
+        count = triton::extlibs::capstone::cs_disasm(this->handle, inst.getOpcodes(), inst.getSize(), inst.getAddress(), 0, &insn);
         if (count > 0) {
           triton::extlibs::capstone::cs_detail* detail = insn->detail;
           for (triton::uint32 j = 0; j < 1; j++) {
@@ -625,15 +636,23 @@ namespace triton {
         else
           throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Failed to disassemble the given code.");
 
-        triton::extlibs::capstone::cs_close(&handle);
-        return;
+        /* Record the decoding for the next time */
+        this->disassemblyCache.store(inst);
+      }
+
+
+      std::map<std::string, triton::usize> x86Cpu::getDisassemblyCacheStats(void) const {
+        return this->disassemblyCache.getStats();
+      }
+
+
+      void x86Cpu::flushDisassemblyCache(void) {
+        this->disassemblyCache.flush();
       }
 
 
       triton::uint8 x86Cpu::getConcreteMemoryValue(triton::uint64 addr) const {
-        if (this->memory.find(addr) == this->memory.end())
-          return 0x00;
-        return this->memory.at(addr);
+        return this->memory.read(addr);
       }
 
 
@@ -648,22 +667,31 @@ namespace triton {
         if (execCallbacks && this->callbacks)
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
 
+        triton::uint8 area[DQQWORD_SIZE];
+        this->memory.read(addr, area, size);
+
         for (triton::sint32 i = size-1; i >= 0; i--)
-          ret = ((ret << BYTE_SIZE_BIT) | this->getConcreteMemoryValue(addr+i));
+          ret = ((ret << BYTE_SIZE_BIT) | area[i]);
 
         return ret;
       }
 
 
       std::vector<triton::uint8> x86Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area(size);
 
-        for (triton::usize index = 0; index < size; index++) {
-          if (execCallbacks && this->callbacks)
+        /* Callbacks may define the memory on the fly, thus they are processed byte per byte */
+        if (execCallbacks && this->callbacks && this->callbacks->isDefined) {
+          for (triton::usize index = 0; index < size; index++) {
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, BYTE_SIZE));
-          area.push_back(this->getConcreteMemoryValue(baseAddr+index));
+            area[index] = this->memory.read(baseAddr+index);
+          }
+          return area;
         }
 
+        if (size)
+          this->memory.read(baseAddr, area.data(), size);
+
         return area;
       }
 
@@ -805,7 +833,7 @@ namespace triton {
 
 
       void x86Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
-        this->memory[addr] = value;
+        this->memory.write(addr, value);
       }
 
 
@@ -817,24 +845,24 @@ namespace triton {
         if (size == 0 || size > DQQWORD_SIZE)
           throw triton::exceptions::Cpu("x86Cpu::setConcreteMemoryValue(): Invalid size memory.");
 
+        triton::uint8 area[DQQWORD_SIZE];
         for (triton::uint32 i = 0; i < size; i++) {
-          this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
+          area[i] = (cv & 0xff).convert_to<triton::uint8>();
           cv >>= 8;
         }
+
+        this->memory.write(addr, area, size);
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-        for (triton::usize index = 0; index < values.size(); index++) {
-          this->memory[baseAddr+index] = values[index];
-        }
+        if (values.size())
+          this->memory.write(baseAddr, values.data(), values.size());
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          this->memory[baseAddr+index] = area[index];
-        }
+        this->memory.write(baseAddr, area, size);
       }
 
 
@@ -1070,19 +1098,74 @@ namespace triton {
 
 
       bool x86Cpu::isMemoryMapped(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) == this->memory.end())
-            return false;
-        }
-        return true;
+        return this->memory.isMapped(baseAddr, size);
       }
 
 
       void x86Cpu::unmapMemory(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) != this->memory.end())
-            this->memory.erase(baseAddr + index);
+        this->memory.unmap(baseAddr, size);
+      }
+
+
+      void x86Cpu::mapMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) {
+        this->memory.mapShared(baseAddr, area, size, owner);
+      }
+
+
+      void x86Cpu::mapZeroMemory(triton::uint64 baseAddr, triton::usize size) {
+        this->memory.mapZero(baseAddr, size);
+      }
+
+
+      void x86Cpu::takeSnapshot(void) {
+        /* Registers are few, their values are copied */
+        this->snapshotRegisters.clear();
+        for (const triton::arch::Register* reg : this->getParentRegisters()) {
+          triton::arch::Register value(*reg);
+          value.setConcreteValue(this->getConcreteRegisterValue(*reg, false));
+          this->snapshotRegisters.push_back(value);
+        }
+
+        /* Pages are saved on their first write */
+        this->memory.takeSnapshot();
+      }
+
+
+      void x86Cpu::restoreSnapshot(void) {
+        if (!this->memory.isSnapshotEnabled())
+          throw triton::exceptions::Cpu("x86Cpu::restoreSnapshot(): No snapshot taken.");
+
+        for (const triton::arch::Register& reg : this->snapshotRegisters)
+          this->setConcreteRegisterValue(reg);
+
+        this->memory.restoreSnapshot();
+      }
+
+
+      void x86Cpu::discardSnapshot(void) {
+        this->snapshotRegisters.clear();
+        this->memory.discardSnapshot();
+      }
+
+
+      bool x86Cpu::isSnapshotEnabled(void) const {
+        return this->memory.isSnapshotEnabled();
+      }
+
+
+      const triton::arch::Register& x86Cpu::getProgramCounter(void) const {
+        return TRITON_X86_REG_PC;
+      }
+
+
+      bool x86Cpu::isSyscall(const triton::arch::Instruction& inst) const {
+        switch (inst.getType()) {
+          case triton::arch::x86::ID_INS_INT:
+          case triton::arch::x86::ID_INS_SYSCALL:
+          case triton::arch::x86::ID_INS_SYSENTER:
+            return true;
         }
+        return false;
       }
 
     }; /* x86 namespace */
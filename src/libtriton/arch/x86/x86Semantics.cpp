@@ -679,6 +679,12 @@ namespace triton {
 
 
       void x86Semantics::clearFlag_s(triton::arch::Instruction& inst, triton::arch::Register& flag, std::string comment) {
+        /* Defer the symbolic expression until the flag is read */
+        if (this->symbolicEngine->isLazyFlags()) {
+          this->deferFlag_s(flag, nullptr, false, comment, []() { return triton::ast::bv(0, 1); });
+          return;
+        }
+
         /* Create the semantics */
         auto node = triton::ast::bv(0, 1);
 
@@ -691,6 +697,12 @@ namespace triton {
 
 
       void x86Semantics::setFlag_s(triton::arch::Instruction& inst, triton::arch::Register& flag, std::string comment) {
+        /* Defer the symbolic expression until the flag is read */
+        if (this->symbolicEngine->isLazyFlags()) {
+          this->deferFlag_s(flag, nullptr, true, comment, []() { return triton::ast::bv(1, 1); });
+          return;
+        }
+
         /* Create the semantics */
         auto node = triton::ast::bv(1, 1);
 
@@ -702,6 +714,33 @@ namespace triton {
       }
 
 
+      void x86Semantics::deferFlag_s(triton::arch::Register& flag,
+                                     triton::engines::symbolic::SymbolicExpression* parent,
+                                     bool value,
+                                     const std::string& comment,
+                                     const triton::engines::symbolic::deferredBuilder& semantics,
+                                     triton::ast::AbstractNode* op1,
+                                     triton::ast::AbstractNode* op2) {
+
+        auto deferred = new(std::nothrow) triton::engines::symbolic::DeferredExpression(semantics, parent, op1, op2, comment);
+        if (deferred == nullptr)
+          throw triton::exceptions::Semantics("x86Semantics::deferFlag_s(): Not enough memory.");
+
+        /* Only the concrete value is computed at once */
+        flag.setConcreteValue(value);
+        this->symbolicEngine->deferSymbolicRegisterExpression(flag, deferred);
+
+        /* Spread the taint from the parent to the child */
+        this->taintEngine->setTaintRegister(flag, (parent != nullptr ? parent->isTainted : triton::engines::taint::UNTAINTED));
+      }
+
+
+      triton::uint512 x86Semantics::extractConcreteValue(triton::engines::symbolic::SymbolicExpression* expr, triton::uint32 high, triton::uint32 low) const {
+        triton::uint512 mask = (triton::uint512(1) << (high - low + 1)) - 1;
+        return (expr->getAst()->evaluate() >> low) & mask;
+      }
+
+
       void x86Semantics::controlFlow_s(triton::arch::Instruction& inst) {
         auto pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC.getParent());
         auto counter = triton::arch::OperandWrapper(TRITON_X86_REG_CX.getParent());
@@ -815,31 +854,43 @@ namespace triton {
                               triton::ast::AbstractNode* op2,
                               bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * af = 0x10 == (0x10 & (regDst ^ op1 ^ op2))
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
-                        triton::ast::bv(0x10, bvSize),
-                        triton::ast::bvand(
-                          triton::ast::bv(0x10, bvSize),
-                          triton::ast::bvxor(
-                            triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                            triton::ast::bvxor(op1, op2)
-                          )
-                        )
-                      ),
-                      triton::ast::bv(1, 1),
-                      triton::ast::bv(0, 1)
-                    );
+        auto semantics = [=]() {
+          return triton::ast::ite(
+                   triton::ast::equal(
+                     triton::ast::bv(0x10, bvSize),
+                     triton::ast::bvand(
+                       triton::ast::bv(0x10, bvSize),
+                       triton::ast::bvxor(
+                         triton::ast::extract(high, low, triton::ast::reference(parentId)),
+                         triton::ast::bvxor(op1, op2)
+                       )
+                     )
+                   ),
+                   triton::ast::bv(1, 1),
+                   triton::ast::bv(0, 1)
+                 );
+        };
+
+        /* Defer the symbolic expression until the flag is read */
+        if (this->symbolicEngine->isLazyFlags()) {
+          auto res = this->extractConcreteValue(parent, high, low);
+          auto a   = op1->evaluate();
+          auto b   = op2->evaluate();
+          this->deferFlag_s(TRITON_X86_REG_AF, parent, ((res ^ a ^ b) & 0x10) != 0, "Adjust flag", semantics, op1, op2);
+          return;
+        }
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_AF, "Adjust flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, semantics(), TRITON_X86_REG_AF, "Adjust flag");
 
         /* Spread the taint from the parent to the child */
         expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_AF, parent->isTainted);
@@ -890,28 +941,40 @@ namespace triton {
                                  triton::ast::AbstractNode* op2,
                                  bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * cf = MSB((op1 & op2) ^ ((op1 ^ op2 ^ parent) & (op1 ^ op2)));
          */
-        auto node = triton::ast::extract(bvSize-1, bvSize-1,
-                      triton::ast::bvxor(
-                        triton::ast::bvand(op1, op2),
-                        triton::ast::bvand(
-                          triton::ast::bvxor(
-                            triton::ast::bvxor(op1, op2),
-                            triton::ast::extract(high, low, triton::ast::reference(parent->getId()))
-                          ),
-                        triton::ast::bvxor(op1, op2))
-                      )
-                    );
+        auto semantics = [=]() {
+          return triton::ast::extract(bvSize-1, bvSize-1,
+                   triton::ast::bvxor(
+                     triton::ast::bvand(op1, op2),
+                     triton::ast::bvand(
+                       triton::ast::bvxor(
+                         triton::ast::bvxor(op1, op2),
+                         triton::ast::extract(high, low, triton::ast::reference(parentId))
+                       ),
+                     triton::ast::bvxor(op1, op2))
+                   )
+                 );
+        };
+
+        /* Defer the symbolic expression until the flag is read */
+        if (this->symbolicEngine->isLazyFlags()) {
+          auto res = this->extractConcreteValue(parent, high, low);
+          auto a   = op1->evaluate();
+          auto b   = op2->evaluate();
+          this->deferFlag_s(TRITON_X86_REG_CF, parent, ((((a & b) ^ ((a ^ b ^ res) & (a ^ b))) >> (bvSize-1)) & 1) != 0, "Carry flag", semantics, op1, op2);
+          return;
+        }
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, semantics(), TRITON_X86_REG_CF, "Carry flag");
 
         /* Spread the taint from the parent to the child */
         expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
@@ -1392,26 +1455,38 @@ namespace triton {
                                  triton::ast::AbstractNode* op2,
                                  bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * cf = extract(bvSize, bvSize (((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)))))
          */
-        auto node = triton::ast::extract(bvSize-1, bvSize-1,
-                      triton::ast::bvxor(
-                        triton::ast::bvxor(op1, triton::ast::bvxor(op2, triton::ast::extract(high, low, triton::ast::reference(parent->getId())))),
-                        triton::ast::bvand(
-                          triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parent->getId()))),
-                          triton::ast::bvxor(op1, op2)
-                        )
-                      )
-                    );
+        auto semantics = [=]() {
+          return triton::ast::extract(bvSize-1, bvSize-1,
+                   triton::ast::bvxor(
+                     triton::ast::bvxor(op1, triton::ast::bvxor(op2, triton::ast::extract(high, low, triton::ast::reference(parentId)))),
+                     triton::ast::bvand(
+                       triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parentId))),
+                       triton::ast::bvxor(op1, op2)
+                     )
+                   )
+                 );
+        };
+
+        /* Defer the symbolic expression until the flag is read */
+        if (this->symbolicEngine->isLazyFlags()) {
+          auto res = this->extractConcreteValue(parent, high, low);
+          auto a   = op1->evaluate();
+          auto b   = op2->evaluate();
+          this->deferFlag_s(TRITON_X86_REG_CF, parent, ((((a ^ b ^ res) ^ ((a ^ res) & (a ^ b))) >> (bvSize-1)) & 1) != 0, "Carry flag", semantics, op1, op2);
+          return;
+        }
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, semantics(), TRITON_X86_REG_CF, "Carry flag");
 
         /* Spread the taint from the parent to the child */
         expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
@@ -1425,23 +1500,35 @@ namespace triton {
                                  triton::ast::AbstractNode* op2,
                                  bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * of = MSB((op1 ^ ~op2) & (op1 ^ regDst))
          */
-        auto node = triton::ast::extract(bvSize-1, bvSize-1,
-                      triton::ast::bvand(
-                        triton::ast::bvxor(op1, triton::ast::bvnot(op2)),
-                        triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parent->getId())))
-                      )
-                    );
+        auto semantics = [=]() {
+          return triton::ast::extract(bvSize-1, bvSize-1,
+                   triton::ast::bvand(
+                     triton::ast::bvxor(op1, triton::ast::bvnot(op2)),
+                     triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parentId)))
+                   )
+                 );
+        };
+
+        /* Defer the symbolic expression until the flag is read */
+        if (this->symbolicEngine->isLazyFlags()) {
+          auto res = this->extractConcreteValue(parent, high, low);
+          auto a   = op1->evaluate();
+          auto b   = op2->evaluate();
+          this->deferFlag_s(TRITON_X86_REG_OF, parent, ((((a ^ ~b) & (a ^ res)) >> (bvSize-1)) & 1) != 0, "Overflow flag", semantics, op1, op2);
+          return;
+        }
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, semantics(), TRITON_X86_REG_OF, "Overflow flag");
 
         /* Spread the taint from the parent to the child */
         expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
@@ -1796,23 +1883,35 @@ namespace triton {
                                  triton::ast::AbstractNode* op2,
                                  bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * of = high:bool((op1 ^ op2) & (op1 ^ regDst))
          */
-        auto node = triton::ast::extract(bvSize-1, bvSize-1,
-                      triton::ast::bvand(
-                        triton::ast::bvxor(op1, op2),
-                        triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parent->getId())))
-                      )
-                    );
+        auto semantics = [=]() {
+          return triton::ast::extract(bvSize-1, bvSize-1,
+                   triton::ast::bvand(
+                     triton::ast::bvxor(op1, op2),
+                     triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parentId)))
+                   )
+                 );
+        };
+
+        /* Defer the symbolic expression until the flag is read */
+        if (this->symbolicEngine->isLazyFlags()) {
+          auto res = this->extractConcreteValue(parent, high, low);
+          auto a   = op1->evaluate();
+          auto b   = op2->evaluate();
+          this->deferFlag_s(TRITON_X86_REG_OF, parent, ((((a ^ b) & (a ^ res)) >> (bvSize-1)) & 1) != 0, "Overflow flag", semantics, op1, op2);
+          return;
+        }
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, semantics(), TRITON_X86_REG_OF, "Overflow flag");
 
         /* Spread the taint from the parent to the child */
         expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
@@ -1824,8 +1923,9 @@ namespace triton {
                               triton::arch::OperandWrapper& dst,
                               bool vol) {
 
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? BYTE_SIZE_BIT-1 : !low ? BYTE_SIZE_BIT-1 : WORD_SIZE_BIT-1;
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? BYTE_SIZE_BIT-1 : !low ? BYTE_SIZE_BIT-1 : WORD_SIZE_BIT-1;
+        auto parentId = parent->getId();
 
         /*
          * Create the semantics.
@@ -1833,21 +1933,34 @@ namespace triton {
          * pf is set to one if there is an even number of bit set to 1 in the least
          * significant byte of the result.
          */
-        auto node = triton::ast::bv(1, 1);
-        for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
-          node = triton::ast::bvxor(
-                   node,
-                   triton::ast::extract(0, 0,
-                     triton::ast::bvlshr(
-                       triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                       triton::ast::bv(counter, BYTE_SIZE_BIT)
-                     )
-                  )
-                );
+        auto semantics = [=]() -> triton::ast::AbstractNode* {
+          auto node = triton::ast::bv(1, 1);
+          for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
+            node = triton::ast::bvxor(
+                     node,
+                     triton::ast::extract(0, 0,
+                       triton::ast::bvlshr(
+                         triton::ast::extract(high, low, triton::ast::reference(parentId)),
+                         triton::ast::bv(counter, BYTE_SIZE_BIT)
+                       )
+                    )
+                  );
+          }
+          return node;
+        };
+
+        /* Defer the symbolic expression until the flag is read */
+        if (this->symbolicEngine->isLazyFlags()) {
+          auto res = this->extractConcreteValue(parent, high, low) & 0xff;
+          bool value = true;
+          for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++)
+            value ^= ((res >> counter) & 1) != 0;
+          this->deferFlag_s(TRITON_X86_REG_PF, parent, value, "Parity flag", semantics);
+          return;
         }
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_PF, "Parity flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, semantics(), TRITON_X86_REG_PF, "Parity flag");
 
         /* Spread the taint from the parent to the child */
         expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_PF, parent->isTainted);
@@ -1901,17 +2014,27 @@ namespace triton {
                               triton::arch::OperandWrapper& dst,
                               bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * sf = high:bool(regDst)
          */
-        auto node = triton::ast::extract(high, high, triton::ast::reference(parent->getId()));
+        auto semantics = [=]() {
+          return triton::ast::extract(high, high, triton::ast::reference(parentId));
+        };
+
+        /* Defer the symbolic expression until the flag is read */
+        if (this->symbolicEngine->isLazyFlags()) {
+          auto res = this->extractConcreteValue(parent, high, high);
+          this->deferFlag_s(TRITON_X86_REG_SF, parent, res != 0, "Sign flag", semantics);
+          return;
+        }
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_SF, "Sign flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, semantics(), TRITON_X86_REG_SF, "Sign flag");
 
         /* Spread the taint from the parent to the child */
         expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_SF, parent->isTainted);
@@ -2021,25 +2144,35 @@ namespace triton {
                               triton::arch::OperandWrapper& dst,
                               bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * zf = 0 == regDst
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
-                        triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                        triton::ast::bv(0, bvSize)
-                      ),
-                      triton::ast::bv(1, 1),
-                      triton::ast::bv(0, 1)
-                    );
+        auto semantics = [=]() {
+          return triton::ast::ite(
+                   triton::ast::equal(
+                     triton::ast::extract(high, low, triton::ast::reference(parentId)),
+                     triton::ast::bv(0, bvSize)
+                   ),
+                   triton::ast::bv(1, 1),
+                   triton::ast::bv(0, 1)
+                 );
+        };
+
+        /* Defer the symbolic expression until the flag is read */
+        if (this->symbolicEngine->isLazyFlags()) {
+          auto res = this->extractConcreteValue(parent, high, low);
+          this->deferFlag_s(TRITON_X86_REG_ZF, parent, res == 0, "Zero flag", semantics);
+          return;
+        }
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, semantics(), TRITON_X86_REG_ZF, "Zero flag");
 
         /* Spread the taint from the parent to the child */
         expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
@@ -21,230 +21,232 @@ namespace triton {
        * TRITON_X86_REG_RAX, TRITON_X86_REG_RBX, ..., TRITON_X86_REG_AF...
        * are now available for a temporary access to the triton::arch::Register
        * class. By default, these X86_REG are empty. We must use init32 or init64 before.
+       * They are defined per thread, thus several APIs may run on several threads
+       * (see triton::arch::Architecture::initThreadRegisters()).
        */
 
-      triton::arch::Register x86_reg_invalid = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rax     = triton::arch::Register();
-      triton::arch::Register x86_reg_eax     = triton::arch::Register();
-      triton::arch::Register x86_reg_ax      = triton::arch::Register();
-      triton::arch::Register x86_reg_ah      = triton::arch::Register();
-      triton::arch::Register x86_reg_al      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rbx     = triton::arch::Register();
-      triton::arch::Register x86_reg_ebx     = triton::arch::Register();
-      triton::arch::Register x86_reg_bx      = triton::arch::Register();
-      triton::arch::Register x86_reg_bh      = triton::arch::Register();
-      triton::arch::Register x86_reg_bl      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rcx     = triton::arch::Register();
-      triton::arch::Register x86_reg_ecx     = triton::arch::Register();
-      triton::arch::Register x86_reg_cx      = triton::arch::Register();
-      triton::arch::Register x86_reg_ch      = triton::arch::Register();
-      triton::arch::Register x86_reg_cl      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rdx     = triton::arch::Register();
-      triton::arch::Register x86_reg_edx     = triton::arch::Register();
-      triton::arch::Register x86_reg_dx      = triton::arch::Register();
-      triton::arch::Register x86_reg_dh      = triton::arch::Register();
-      triton::arch::Register x86_reg_dl      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rdi     = triton::arch::Register();
-      triton::arch::Register x86_reg_edi     = triton::arch::Register();
-      triton::arch::Register x86_reg_di      = triton::arch::Register();
-      triton::arch::Register x86_reg_dil     = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rsi     = triton::arch::Register();
-      triton::arch::Register x86_reg_esi     = triton::arch::Register();
-      triton::arch::Register x86_reg_si      = triton::arch::Register();
-      triton::arch::Register x86_reg_sil     = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rsp     = triton::arch::Register();
-      triton::arch::Register x86_reg_esp     = triton::arch::Register();
-      triton::arch::Register x86_reg_sp      = triton::arch::Register();
-      triton::arch::Register x86_reg_spl     = triton::arch::Register();
-      triton::arch::Register x86_reg_stack   = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rbp     = triton::arch::Register();
-      triton::arch::Register x86_reg_ebp     = triton::arch::Register();
-      triton::arch::Register x86_reg_bp      = triton::arch::Register();
-      triton::arch::Register x86_reg_bpl     = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rip     = triton::arch::Register();
-      triton::arch::Register x86_reg_eip     = triton::arch::Register();
-      triton::arch::Register x86_reg_ip      = triton::arch::Register();
-      triton::arch::Register x86_reg_pc      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_eflags  = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r8      = triton::arch::Register();
-      triton::arch::Register x86_reg_r8d     = triton::arch::Register();
-      triton::arch::Register x86_reg_r8w     = triton::arch::Register();
-      triton::arch::Register x86_reg_r8b     = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r9      = triton::arch::Register();
-      triton::arch::Register x86_reg_r9d     = triton::arch::Register();
-      triton::arch::Register x86_reg_r9w     = triton::arch::Register();
-      triton::arch::Register x86_reg_r9b     = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r10     = triton::arch::Register();
-      triton::arch::Register x86_reg_r10d    = triton::arch::Register();
-      triton::arch::Register x86_reg_r10w    = triton::arch::Register();
-      triton::arch::Register x86_reg_r10b    = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r11     = triton::arch::Register();
-      triton::arch::Register x86_reg_r11d    = triton::arch::Register();
-      triton::arch::Register x86_reg_r11w    = triton::arch::Register();
-      triton::arch::Register x86_reg_r11b    = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r12     = triton::arch::Register();
-      triton::arch::Register x86_reg_r12d    = triton::arch::Register();
-      triton::arch::Register x86_reg_r12w    = triton::arch::Register();
-      triton::arch::Register x86_reg_r12b    = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r13     = triton::arch::Register();
-      triton::arch::Register x86_reg_r13d    = triton::arch::Register();
-      triton::arch::Register x86_reg_r13w    = triton::arch::Register();
-      triton::arch::Register x86_reg_r13b    = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r14     = triton::arch::Register();
-      triton::arch::Register x86_reg_r14d    = triton::arch::Register();
-      triton::arch::Register x86_reg_r14w    = triton::arch::Register();
-      triton::arch::Register x86_reg_r14b    = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r15     = triton::arch::Register();
-      triton::arch::Register x86_reg_r15d    = triton::arch::Register();
-      triton::arch::Register x86_reg_r15w    = triton::arch::Register();
-      triton::arch::Register x86_reg_r15b    = triton::arch::Register();
-
-      triton::arch::Register x86_reg_mm0     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm1     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm2     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm3     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm4     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm5     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm6     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm7     = triton::arch::Register();
-
-      triton::arch::Register x86_reg_xmm0    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm1    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm2    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm3    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm4    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm5    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm6    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm7    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm8    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm9    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm10   = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm11   = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm12   = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm13   = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm14   = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm15   = triton::arch::Register();
-
-      triton::arch::Register x86_reg_ymm0    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm1    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm2    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm3    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm4    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm5    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm6    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm7    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm8    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm9    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm10   = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm11   = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm12   = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm13   = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm14   = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm15   = triton::arch::Register();
-
-      triton::arch::Register x86_reg_zmm0    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm1    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm2    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm3    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm4    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm5    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm6    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm7    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm8    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm9    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm10   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm11   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm12   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm13   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm14   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm15   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm16   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm17   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm18   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm19   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm20   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm21   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm22   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm23   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm24   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm25   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm26   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm27   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm28   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm29   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm30   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm31   = triton::arch::Register();
-
-      triton::arch::Register x86_reg_mxcsr   = triton::arch::Register();
-
-      triton::arch::Register x86_reg_cr0    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr1    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr2    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr3    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr4    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr5    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr6    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr7    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr8    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr9    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr10   = triton::arch::Register();
-      triton::arch::Register x86_reg_cr11   = triton::arch::Register();
-      triton::arch::Register x86_reg_cr12   = triton::arch::Register();
-      triton::arch::Register x86_reg_cr13   = triton::arch::Register();
-      triton::arch::Register x86_reg_cr14   = triton::arch::Register();
-      triton::arch::Register x86_reg_cr15   = triton::arch::Register();
-
-      triton::arch::Register x86_reg_ie      = triton::arch::Register();
-      triton::arch::Register x86_reg_de      = triton::arch::Register();
-      triton::arch::Register x86_reg_ze      = triton::arch::Register();
-      triton::arch::Register x86_reg_oe      = triton::arch::Register();
-      triton::arch::Register x86_reg_ue      = triton::arch::Register();
-      triton::arch::Register x86_reg_pe      = triton::arch::Register();
-      triton::arch::Register x86_reg_daz     = triton::arch::Register();
-      triton::arch::Register x86_reg_im      = triton::arch::Register();
-      triton::arch::Register x86_reg_dm      = triton::arch::Register();
-      triton::arch::Register x86_reg_zm      = triton::arch::Register();
-      triton::arch::Register x86_reg_om      = triton::arch::Register();
-      triton::arch::Register x86_reg_um      = triton::arch::Register();
-      triton::arch::Register x86_reg_pm      = triton::arch::Register();
-      triton::arch::Register x86_reg_rl      = triton::arch::Register();
-      triton::arch::Register x86_reg_rh      = triton::arch::Register();
-      triton::arch::Register x86_reg_fz      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_af      = triton::arch::Register();
-      triton::arch::Register x86_reg_cf      = triton::arch::Register();
-      triton::arch::Register x86_reg_df      = triton::arch::Register();
-      triton::arch::Register x86_reg_if      = triton::arch::Register();
-      triton::arch::Register x86_reg_of      = triton::arch::Register();
-      triton::arch::Register x86_reg_pf      = triton::arch::Register();
-      triton::arch::Register x86_reg_sf      = triton::arch::Register();
-      triton::arch::Register x86_reg_tf      = triton::arch::Register();
-      triton::arch::Register x86_reg_zf      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_cs      = triton::arch::Register();
-      triton::arch::Register x86_reg_ds      = triton::arch::Register();
-      triton::arch::Register x86_reg_es      = triton::arch::Register();
-      triton::arch::Register x86_reg_fs      = triton::arch::Register();
-      triton::arch::Register x86_reg_gs      = triton::arch::Register();
-      triton::arch::Register x86_reg_ss      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_invalid = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_rax     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_eax     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ax      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ah      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_al      = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_rbx     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ebx     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_bx      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_bh      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_bl      = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_rcx     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ecx     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cx      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ch      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cl      = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_rdx     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_edx     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_dx      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_dh      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_dl      = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_rdi     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_edi     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_di      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_dil     = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_rsi     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_esi     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_si      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_sil     = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_rsp     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_esp     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_sp      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_spl     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_stack   = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_rbp     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ebp     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_bp      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_bpl     = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_rip     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_eip     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ip      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_pc      = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_eflags  = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_r8      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r8d     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r8w     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r8b     = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_r9      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r9d     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r9w     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r9b     = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_r10     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r10d    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r10w    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r10b    = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_r11     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r11d    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r11w    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r11b    = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_r12     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r12d    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r12w    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r12b    = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_r13     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r13d    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r13w    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r13b    = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_r14     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r14d    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r14w    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r14b    = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_r15     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r15d    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r15w    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_r15b    = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_mm0     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_mm1     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_mm2     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_mm3     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_mm4     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_mm5     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_mm6     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_mm7     = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_xmm0    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm1    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm2    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm3    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm4    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm5    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm6    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm7    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm8    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm9    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm10   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm11   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm12   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm13   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm14   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_xmm15   = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_ymm0    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm1    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm2    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm3    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm4    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm5    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm6    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm7    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm8    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm9    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm10   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm11   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm12   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm13   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm14   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ymm15   = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_zmm0    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm1    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm2    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm3    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm4    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm5    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm6    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm7    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm8    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm9    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm10   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm11   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm12   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm13   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm14   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm15   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm16   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm17   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm18   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm19   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm20   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm21   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm22   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm23   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm24   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm25   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm26   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm27   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm28   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm29   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm30   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zmm31   = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_mxcsr   = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_cr0    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr1    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr2    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr3    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr4    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr5    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr6    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr7    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr8    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr9    = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr10   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr11   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr12   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr13   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr14   = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cr15   = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_ie      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_de      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ze      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_oe      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ue      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_pe      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_daz     = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_im      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_dm      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zm      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_om      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_um      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_pm      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_rl      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_rh      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_fz      = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_af      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_cf      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_df      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_if      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_of      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_pf      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_sf      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_tf      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_zf      = triton::arch::Register();
+
+      thread_local triton::arch::Register x86_reg_cs      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ds      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_es      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_fs      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_gs      = triton::arch::Register();
+      thread_local triton::arch::Register x86_reg_ss      = triton::arch::Register();
 
 
       triton::arch::Register* x86_regs[triton::arch::x86::ID_REG_LAST_ITEM] = {
@@ -6,10 +6,16 @@
 */
 
 #include <cmath>
+#include <functional>
+#include <limits>
 #include <new>
+#include <set>
+#include <string>
+#include <vector>
 
 #include <triton/api.hpp>
 #include <triton/ast.hpp>
+#include <triton/astAllocator.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/tritonToZ3Ast.hpp>
@@ -20,38 +26,165 @@
 namespace triton {
   namespace ast {
 
+    /* Returns the mask of a bitvector of `size` bits (size <= 64) */
+    static inline triton::uint64 mask64(triton::uint32 size) {
+      if (size >= QWORD_SIZE_BIT)
+        return ~static_cast<triton::uint64>(0);
+      return (static_cast<triton::uint64>(1) << size) - 1;
+    }
+
+
+    /* Sign extends a bitvector of `size` bits (size <= 64) to 64 bits */
+    static inline triton::sint64 signExtend64(triton::uint64 value, triton::uint32 size) {
+      if (size != 0 && size < QWORD_SIZE_BIT && ((value >> (size - 1)) & 1))
+        value |= ~mask64(size);
+      return static_cast<triton::sint64>(value);
+    }
+
+
+    /* Returns true if the node is evaluated on a native integer */
+    static inline bool isNative(AbstractNode* node) {
+      return node->getBitvectorSize() <= QWORD_SIZE_BIT;
+    }
+
+
+    /* Mixes a value into a hash */
+    static inline triton::uint64 hashCombine(triton::uint64 seed, triton::uint64 value) {
+      return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+    }
+
+
+    /* Spreads the entropy of a hash over all its bits (murmur3 finalizer) */
+    static inline triton::uint64 hashFinalize(triton::uint64 hash) {
+      hash ^= hash >> 33;
+      hash *= 0xff51afd7ed558ccdULL;
+      hash ^= hash >> 33;
+      hash *= 0xc4ceb9fe1a85ec53ULL;
+      hash ^= hash >> 33;
+      return hash;
+    }
+
+
+    /* Returns true if both nodes have the same kind, size, number of childs and value (for leaves) */
+    static bool isSameNode(AbstractNode* node1, AbstractNode* node2) {
+      if (node1->getKind() != node2->getKind() || node1->getBitvectorSize() != node2->getBitvectorSize())
+        return false;
+
+      if (node1->getChilds().size() != node2->getChilds().size())
+        return false;
+
+      switch (node1->getKind()) {
+        case DECIMAL_NODE:
+          return reinterpret_cast<DecimalNode*>(node1)->getValue() == reinterpret_cast<DecimalNode*>(node2)->getValue();
+
+        case REFERENCE_NODE:
+          return reinterpret_cast<ReferenceNode*>(node1)->getValue() == reinterpret_cast<ReferenceNode*>(node2)->getValue();
+
+        case STRING_NODE:
+          return reinterpret_cast<StringNode*>(node1)->getValue() == reinterpret_cast<StringNode*>(node2)->getValue();
+
+        case VARIABLE_NODE:
+          return reinterpret_cast<VariableNode*>(node1)->getValue() == reinterpret_cast<VariableNode*>(node2)->getValue();
+
+        default:
+          return true;
+      }
+    }
+
+
     /* ====== Abstract node */
 
     AbstractNode::AbstractNode(enum kind_e kind) {
-      this->eval        = 0;
-      this->kind        = kind;
-      this->size        = 0;
-      this->symbolized  = false;
+      this->api            = &triton::currentApi();
+      this->dirty          = false;
+      this->eval           = 0;
+      this->evalWide       = nullptr;
+      this->kind           = kind;
+      this->refCount       = 0;
+      this->released       = false;
+      this->size           = 0;
+      this->structuralHash = 0;
+      this->dictionaryHash = 0;
+      this->inDictionaries = false;
+      this->prevRecorded   = nullptr;
+      this->nextRecorded   = nullptr;
+      this->symbolized     = false;
     }
 
 
     AbstractNode::AbstractNode() {
-      this->eval        = 0;
-      this->kind        = UNDEFINED_NODE;
-      this->size        = 0;
-      this->symbolized  = false;
+      this->api            = &triton::currentApi();
+      this->dirty          = false;
+      this->eval           = 0;
+      this->evalWide       = nullptr;
+      this->kind           = UNDEFINED_NODE;
+      this->refCount       = 0;
+      this->released       = false;
+      this->size           = 0;
+      this->structuralHash = 0;
+      this->dictionaryHash = 0;
+      this->inDictionaries = false;
+      this->prevRecorded   = nullptr;
+      this->nextRecorded   = nullptr;
+      this->symbolized     = false;
     }
 
 
     AbstractNode::AbstractNode(const AbstractNode& copy) {
-      this->eval        = copy.eval;
-      this->kind        = copy.kind;
-      this->parents     = copy.parents;
-      this->size        = copy.size;
-      this->symbolized  = copy.symbolized;
-
-      for (triton::uint32 index = 0; index < copy.childs.size(); index++)
-        this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+      this->api            = copy.api;
+      this->dirty          = copy.dirty;
+      this->eval           = copy.eval;
+      this->evalWide       = (copy.evalWide != nullptr) ? new triton::uint512(*copy.evalWide) : nullptr;
+      this->kind           = copy.kind;
+      this->parents        = copy.parents;
+      this->refCount       = 0;
+      this->released       = false;
+      this->size           = copy.size;
+      this->structuralHash = copy.structuralHash;
+      this->dictionaryHash = 0;
+      this->inDictionaries = false;
+      this->prevRecorded   = nullptr;
+      this->nextRecorded   = nullptr;
+      this->symbolized     = copy.symbolized;
+
+      /* Childs are shared, triton::ast::newInstance() duplicates them if needed */
+      this->childs = copy.childs;
     }
 
 
     AbstractNode::~AbstractNode() {
-      /* virtual */
+      delete this->evalWide;
+    }
+
+
+    /* Nodes of each API are allocated in their own arena, thus the slabs of an API are released with its nodes */
+    void* AbstractNode::operator new(std::size_t size) {
+      return triton::ast::astAllocator().allocate(size, &triton::currentApi());
+    }
+
+
+    void* AbstractNode::operator new(std::size_t size, const std::nothrow_t&) noexcept {
+      try {
+        return triton::ast::astAllocator().allocate(size, &triton::currentApi());
+      }
+      catch (const std::bad_alloc&) {
+        return nullptr;
+      }
+    }
+
+
+    void AbstractNode::operator delete(void* ptr) noexcept {
+      triton::ast::astAllocator().deallocate(ptr);
+    }
+
+
+    void AbstractNode::operator delete(void* ptr, const std::nothrow_t&) noexcept {
+      triton::ast::astAllocator().deallocate(ptr);
+    }
+
+
+    triton::API* AbstractNode::getApi(void) const {
+      return this->api;
     }
 
 
@@ -61,6 +194,8 @@ namespace triton {
 
 
     triton::uint32 AbstractNode::getBitvectorSize(void) const {
+      if (this->dirty)
+        this->refresh();
       return this->size;
     }
 
@@ -73,21 +208,49 @@ namespace triton {
 
 
     bool AbstractNode::isSigned(void) const {
-      if ((this->eval >> (this->size-1)) & 1)
+      if (this->dirty)
+        this->refresh();
+
+      if (this->evalWide == nullptr && this->size <= QWORD_SIZE_BIT)
+        return (this->size != 0) && ((this->eval >> (this->size-1)) & 1);
+
+      if ((this->evaluate() >> (this->size-1)) & 1)
         return true;
       return false;
     }
 
 
     bool AbstractNode::isSymbolized(void) const {
+      if (this->dirty)
+        this->refresh();
       return this->symbolized;
     }
 
 
     bool AbstractNode::equalTo(const AbstractNode& other) const {
-      return (this->evaluate() == other.evaluate()) &&
-             (this->getBitvectorSize() == other.getBitvectorSize()) &&
-             (this->hash(1) == other.hash(1));
+      std::set<std::pair<AbstractNode*, AbstractNode*>> visited;
+      std::vector<std::pair<AbstractNode*, AbstractNode*>> worklist;
+
+      if (this->getHash() != other.getHash())
+        return false;
+
+      /* Same hashes, the structures are compared to rule out a collision. Shared sub-trees are compared once. */
+      worklist.push_back(std::make_pair(const_cast<AbstractNode*>(this), const_cast<AbstractNode*>(&other)));
+      while (!worklist.empty()) {
+        auto pair = worklist.back();
+        worklist.pop_back();
+
+        if (pair.first == pair.second || !visited.insert(pair).second)
+          continue;
+
+        if (pair.first->getHash() != pair.second->getHash() || !isSameNode(pair.first, pair.second))
+          return false;
+
+        for (triton::uint32 index = 0; index < pair.first->childs.size(); index++)
+          worklist.push_back(std::make_pair(pair.first->childs[index], pair.second->childs[index]));
+      }
+
+      return true;
     }
 
 
@@ -97,16 +260,93 @@ namespace triton {
 
 
     triton::uint512 AbstractNode::evaluate(void) const {
+      if (this->dirty)
+        this->refresh();
+
+      if (this->evalWide != nullptr)
+        return *this->evalWide;
       return this->eval;
     }
 
 
-    std::vector<AbstractNode*>& AbstractNode::getChilds(void) {
+    triton::uint64 AbstractNode::evaluate64(void) const {
+      if (this->dirty)
+        this->refresh();
+
+      if (this->evalWide != nullptr)
+        return (*this->evalWide & std::numeric_limits<triton::uint64>::max()).convert_to<triton::uint64>();
+      return this->eval;
+    }
+
+
+    void AbstractNode::setEval(triton::uint64 value) {
+      if (this->evalWide != nullptr) {
+        delete this->evalWide;
+        this->evalWide = nullptr;
+      }
+      this->eval = value;
+    }
+
+
+    void AbstractNode::setEval(const triton::uint512& value) {
+      if (this->size <= QWORD_SIZE_BIT) {
+        this->setEval((value & std::numeric_limits<triton::uint64>::max()).convert_to<triton::uint64>());
+        return;
+      }
+
+      if (this->evalWide == nullptr)
+        this->evalWide = new triton::uint512(value);
+      else
+        *this->evalWide = value;
+      this->eval = 0;
+    }
+
+
+    triton::uint64 AbstractNode::getHash(void) const {
+      if (this->dirty)
+        this->refresh();
+      return this->structuralHash;
+    }
+
+
+    triton::uint64 AbstractNode::getDictionaryHash(void) const {
+      return this->dictionaryHash;
+    }
+
+
+    bool AbstractNode::isInDictionaries(void) const {
+      return this->inDictionaries;
+    }
+
+
+    void AbstractNode::setInDictionaries(bool flag, triton::uint64 hash) {
+      this->dictionaryHash = hash;
+      this->inDictionaries = flag;
+    }
+
+
+    AbstractNode* AbstractNode::getPrevRecorded(void) const {
+      return this->prevRecorded;
+    }
+
+
+    AbstractNode* AbstractNode::getNextRecorded(void) const {
+      return this->nextRecorded;
+    }
+
+
+    void AbstractNode::setRecorded(AbstractNode* prev, AbstractNode* next) {
+      this->prevRecorded = prev;
+      this->nextRecorded = next;
+    }
+
+
+    AstChildList& AbstractNode::getChilds(void) {
       return this->childs;
     }
 
 
-    std::set<AbstractNode*>& AbstractNode::getParents(void) {
+    AstParentList& AbstractNode::getParents(void) {
       return this->parents;
     }
 
@@ -121,8 +361,8 @@ namespace triton {
     }
 
 
-    void AbstractNode::setParent(std::set<AbstractNode*>& p) {
-      for (std::set<AbstractNode*>::iterator it = p.begin(); it != p.end(); it++)
+    void AbstractNode::setParent(const AstParentList& p) {
+      for (auto it = p.begin(); it != p.end(); it++)
         this->parents.insert(*it);
     }
 
@@ -155,6 +395,157 @@ namespace triton {
     }
 
 
+    void AbstractNode::initHash(void) {
+      triton::uint64 hash = hashCombine(this->kind, this->size);
+
+      switch (this->kind) {
+        case DECIMAL_NODE: {
+          triton::uint512 value = reinterpret_cast<DecimalNode*>(this)->getValue();
+          for (; value != 0; value >>= 64)
+            hash = hashCombine(hash, (value & std::numeric_limits<triton::uint64>::max()).convert_to<triton::uint64>());
+          break;
+        }
+
+        case REFERENCE_NODE:
+          hash = hashCombine(hash, reinterpret_cast<ReferenceNode*>(this)->getValue());
+          break;
+
+        case STRING_NODE:
+          hash = hashCombine(hash, std::hash<std::string>()(reinterpret_cast<StringNode*>(this)->getValue()));
+          break;
+
+        case VARIABLE_NODE:
+          hash = hashCombine(hash, std::hash<std::string>()(reinterpret_cast<VariableNode*>(this)->getValue()));
+          break;
+
+        default:
+          break;
+      }
+
+      for (auto it = this->childs.begin(); it != this->childs.end(); it++)
+        hash = hashCombine(hash, (*it)->getHash());
+
+      this->structuralHash = hashFinalize(hash);
+    }
+
+
+    void AbstractNode::initParents(void) {
+      this->dirty = false;
+      this->initHash();
+
+      if (this->parents.empty())
+        return;
+
+      if (this->api->isArchitectureValid() && this->api->isModeEnabled(triton::modes::LAZY_EVALUATION)) {
+        this->invalidateParents();
+        return;
+      }
+
+      for (auto it = this->parents.begin(); it != this->parents.end(); it++)
+        (*it)->init();
+    }
+
+
+    void AbstractNode::invalidateParents(void) {
+      std::vector<AbstractNode*> worklist(this->parents.begin(), this->parents.end());
+
+      /* An ancestor already dirty has its own ancestors dirty too, the walk stops there */
+      while (!worklist.empty()) {
+        AbstractNode* node = worklist.back();
+        worklist.pop_back();
+
+        if (node->dirty)
+          continue;
+
+        node->dirty = true;
+        worklist.insert(worklist.end(), node->parents.begin(), node->parents.end());
+      }
+    }
+
+
+    void AbstractNode::refresh(void) const {
+      std::vector<AbstractNode*> worklist;
+
+      worklist.push_back(const_cast<AbstractNode*>(this));
+      while (!worklist.empty()) {
+        AbstractNode* node = worklist.back();
+        bool ready = true;
+
+        if (!node->dirty) {
+          worklist.pop_back();
+          continue;
+        }
+
+        for (auto it = node->childs.begin(); it != node->childs.end(); it++) {
+          if ((*it)->dirty) {
+            worklist.push_back(*it);
+            ready = false;
+          }
+        }
+
+        /* A reference is init from the tree of its expression */
+        if (node->kind == REFERENCE_NODE) {
+          triton::usize id = reinterpret_cast<ReferenceNode*>(node)->getValue();
+          if (node->api->isSymbolicExpressionIdExists(id)) {
+            AbstractNode* ast = node->api->getAstFromId(id);
+            if (ast->dirty) {
+              worklist.push_back(ast);
+              ready = false;
+            }
+          }
+        }
+
+        if (!ready)
+          continue;
+
+        /* Childs are up to date, parents are already dirty */
+        worklist.pop_back();
+        node->init();
+      }
+    }
+
+
+    bool AbstractNode::isDirty(void) const {
+      return this->dirty;
+    }
+
+
+    triton::uint32 AbstractNode::getRefCount(void) const {
+      return this->refCount;
+    }
+
+
+    void AbstractNode::incRefCount(void) {
+      this->refCount++;
+    }
+
+
+    void AbstractNode::decRefCount(void) {
+      /* Called from destructors, thus it must not throw */
+      if (this->refCount == 0)
+        return;
+
+      this->refCount--;
+
+      /* The garbage collector does not own this node anymore */
+      if (this->refCount == 0 && this->released)
+        delete this;
+    }
+
+
+    void AbstractNode::release(void) {
+      if (this->refCount == 0) {
+        delete this;
+        return;
+      }
+
+      /* Childs and parents may be deleted by the garbage collector */
+      this->childs.clear();
+      this->parents.clear();
+      this->released = true;
+    }
+
+
     /* ====== assert */
 
 
@@ -179,17 +570,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = 0;
+      this->setEval(0);
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -235,17 +626,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() + this->childs[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval((this->childs[0]->evaluate64() + this->childs[1]->evaluate64()) & mask64(this->size));
+      else
+        this->setEval(((this->childs[0]->evaluate() + this->childs[1]->evaluate()) & this->getBitvectorMask()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -291,17 +685,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() & this->childs[1]->evaluate());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval(this->childs[0]->evaluate64() & this->childs[1]->evaluate64());
+      else
+        this->setEval((this->childs[0]->evaluate() & this->childs[1]->evaluate()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -350,47 +747,62 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvashrNode::init(): Must take two nodes of same size.");
 
-      value = this->childs[0]->evaluate();
-      shift = this->childs[1]->evaluate().convert_to<triton::uint32>();
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      /* Mask based on the sign */
-      if (this->childs[0]->isSigned()) {
-        mask = 1;
-        mask = ((mask << (this->size-1)) & this->getBitvectorMask());
-      }
+      if (this->size <= QWORD_SIZE_BIT) {
+        triton::uint64 value64 = static_cast<triton::uint64>(signExtend64(this->childs[0]->evaluate64(), this->size));
+        triton::uint64 shift64 = this->childs[1]->evaluate64();
 
-      if (shift >= this->size && this->childs[0]->isSigned()) {
-        this->eval = -1;
-        this->eval &= this->getBitvectorMask();
+        if (shift64 >= this->size)
+          this->setEval(this->childs[0]->isSigned() ? mask64(this->size) : 0);
+        else if (this->childs[0]->isSigned())
+          this->setEval(~(~value64 >> shift64) & mask64(this->size));
+        else
+          this->setEval(value64 >> shift64);
       }
 
-      else if (shift >= this->size && !this->childs[0]->isSigned()) {
-        this->eval = 0;
-      }
+      else {
+        value = this->childs[0]->evaluate();
+        shift = this->childs[1]->evaluate().convert_to<triton::uint32>();
 
-      else if (shift == 0) {
-        this->eval = value;
-      }
+        /* Mask based on the sign */
+        if (this->childs[0]->isSigned()) {
+          mask = 1;
+          mask = ((mask << (this->size-1)) & this->getBitvectorMask());
+        }
 
-      else {
-        this->eval = value & this->getBitvectorMask();
-        for (triton::uint32 index = 0; index < shift; index++) {
-          this->eval = (((this->eval >> 1) | mask) & this->getBitvectorMask());
+        if (shift >= this->size && this->childs[0]->isSigned()) {
+          value = -1;
+          this->setEval(value & this->getBitvectorMask());
+        }
+
+        else if (shift >= this->size && !this->childs[0]->isSigned()) {
+          this->setEval(0);
+        }
+
+        else if (shift == 0) {
+          this->setEval(value);
+        }
+
+        else {
+          value = value & this->getBitvectorMask();
+          for (triton::uint32 index = 0; index < shift; index++) {
+            value = (((value >> 1) | mask) & this->getBitvectorMask());
+          }
+          this->setEval(value);
         }
       }
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -444,17 +856,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = size;
-      this->eval = 0;
+      this->setEval(0);
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -500,17 +912,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() >> this->childs[1]->evaluate().convert_to<triton::uint32>());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval((this->childs[1]->evaluate64() >= QWORD_SIZE_BIT) ? 0 : (this->childs[0]->evaluate64() >> this->childs[1]->evaluate64()));
+      else
+        this->setEval((this->childs[0]->evaluate() >> this->childs[1]->evaluate().convert_to<triton::uint32>()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -556,17 +971,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() * this->childs[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval((this->childs[0]->evaluate64() * this->childs[1]->evaluate64()) & mask64(this->size));
+      else
+        this->setEval(((this->childs[0]->evaluate() * this->childs[1]->evaluate()) & this->getBitvectorMask()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -612,17 +1030,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() & this->childs[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval(~(this->childs[0]->evaluate64() & this->childs[1]->evaluate64()) & mask64(this->size));
+      else
+        this->setEval((~(this->childs[0]->evaluate() & this->childs[1]->evaluate()) & this->getBitvectorMask()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -664,17 +1085,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((-(this->childs[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval((~this->childs[0]->evaluate64() + 1) & mask64(this->size));
+      else
+        this->setEval(((-(this->childs[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -720,17 +1144,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() | this->childs[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval(~(this->childs[0]->evaluate64() | this->childs[1]->evaluate64()) & mask64(this->size));
+      else
+        this->setEval((~(this->childs[0]->evaluate() | this->childs[1]->evaluate()) & this->getBitvectorMask()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -772,17 +1199,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~this->childs[0]->evaluate() & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval(~this->childs[0]->evaluate64() & mask64(this->size));
+      else
+        this->setEval((~this->childs[0]->evaluate() & this->getBitvectorMask()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -828,17 +1258,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() | this->childs[1]->evaluate());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval(this->childs[0]->evaluate64() | this->childs[1]->evaluate64());
+      else
+        this->setEval((this->childs[0]->evaluate() | this->childs[1]->evaluate()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -894,23 +1327,33 @@ namespace triton {
       if (this->childs[0]->getKind() != DECIMAL_NODE)
         throw triton::exceptions::Ast("BvrolNode::init(): rot must be a DECIMAL_NODE.");
 
-      rot   = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
-      value = this->childs[1]->evaluate();
+      rot = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
       rot %= this->size;
-      this->eval = (((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
+
+      if (this->size <= QWORD_SIZE_BIT) {
+        triton::uint64 value64 = this->childs[1]->evaluate64();
+        if (rot == 0)
+          this->setEval(value64 & mask64(this->size));
+        else
+          this->setEval(((value64 << rot) | (value64 >> (this->size - rot))) & mask64(this->size));
+      }
+      else {
+        value = this->childs[1]->evaluate();
+        this->setEval(((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
+      }
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -965,23 +1408,33 @@ namespace triton {
       if (this->childs[0]->getKind() != DECIMAL_NODE)
         throw triton::exceptions::Ast("BvrorNode::init(): rot must be a DECIMAL_NODE.");
 
-      rot   = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
-      value = this->childs[1]->evaluate();
+      rot = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
       rot %= this->size;
-      this->eval = (((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
+
+      if (this->size <= QWORD_SIZE_BIT) {
+        triton::uint64 value64 = this->childs[1]->evaluate64();
+        if (rot == 0)
+          this->setEval(value64 & mask64(this->size));
+        else
+          this->setEval(((value64 >> rot) | (value64 << (this->size - rot))) & mask64(this->size));
+      }
+      else {
+        value = this->childs[1]->evaluate();
+        this->setEval(((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
+      }
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1028,29 +1481,44 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsdivNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (op2Signed == 0) {
-        this->eval = (op1Signed < 0 ? 1 : -1);
-        this->eval &= this->getBitvectorMask();
+      if (this->size <= QWORD_SIZE_BIT) {
+        triton::sint64 op1 = signExtend64(this->childs[0]->evaluate64(), this->size);
+        triton::sint64 op2 = signExtend64(this->childs[1]->evaluate64(), this->size);
+
+        if (op2 == 0)
+          this->setEval((op1 < 0 ? 1 : ~static_cast<triton::uint64>(0)) & mask64(this->size));
+        /* The only overflowing division (INT64_MIN / -1) */
+        else if (op2 == -1)
+          this->setEval((~static_cast<triton::uint64>(op1) + 1) & mask64(this->size));
+        else
+          this->setEval(static_cast<triton::uint64>(op1 / op2) & mask64(this->size));
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+        op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+        if (op2Signed == 0) {
+          triton::uint512 value = (op1Signed < 0 ? 1 : -1);
+          this->setEval(value & this->getBitvectorMask());
+        }
+        else
+          this->setEval((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
       }
-      else
-        this->eval = ((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1097,23 +1565,30 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsgeNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed >= op2Signed);
+
+      if (isNative(this->childs[0])) {
+        triton::uint32 size = this->childs[0]->getBitvectorSize();
+        this->setEval(signExtend64(this->childs[0]->evaluate64(), size) >= signExtend64(this->childs[1]->evaluate64(), size));
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+        op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+        this->setEval(op1Signed >= op2Signed);
+      }
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1160,23 +1635,30 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsgtNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed > op2Signed);
+
+      if (isNative(this->childs[0])) {
+        triton::uint32 size = this->childs[0]->getBitvectorSize();
+        this->setEval(signExtend64(this->childs[0]->evaluate64(), size) > signExtend64(this->childs[1]->evaluate64(), size));
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+        op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+        this->setEval(op1Signed > op2Signed);
+      }
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1222,17 +1704,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() << this->childs[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval((this->childs[1]->evaluate64() >= QWORD_SIZE_BIT) ? 0 : ((this->childs[0]->evaluate64() << this->childs[1]->evaluate64()) & mask64(this->size)));
+      else
+        this->setEval(((this->childs[0]->evaluate() << this->childs[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1279,23 +1764,30 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsleNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed <= op2Signed);
+
+      if (isNative(this->childs[0])) {
+        triton::uint32 size = this->childs[0]->getBitvectorSize();
+        this->setEval(signExtend64(this->childs[0]->evaluate64(), size) <= signExtend64(this->childs[1]->evaluate64(), size));
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+        op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+        this->setEval(op1Signed <= op2Signed);
+      }
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1342,23 +1834,30 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsltNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed < op2Signed);
+
+      if (isNative(this->childs[0])) {
+        triton::uint32 size = this->childs[0]->getBitvectorSize();
+        this->setEval(signExtend64(this->childs[0]->evaluate64(), size) < signExtend64(this->childs[1]->evaluate64(), size));
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+        op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+        this->setEval(op1Signed < op2Signed);
+      }
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1405,27 +1904,47 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsmodNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
-      else
-        this->eval = ((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT) {
+        triton::sint64 op1 = signExtend64(this->childs[0]->evaluate64(), this->size);
+        triton::sint64 op2 = signExtend64(this->childs[1]->evaluate64(), this->size);
+        triton::sint64 rem = 0;
+
+        if (op2 == 0)
+          this->setEval(this->childs[0]->evaluate64());
+        else {
+          /* INT64_MIN % -1 overflows, the remainder is 0 anyway */
+          if (op2 != -1)
+            rem = op1 % op2;
+          /* The result takes the sign of the divisor */
+          if (rem != 0 && ((rem < 0) != (op2 < 0)))
+            rem += op2;
+          this->setEval(static_cast<triton::uint64>(rem) & mask64(this->size));
+        }
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+        op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+        if (this->childs[1]->evaluate() == 0)
+          this->setEval(this->childs[0]->evaluate());
+        else
+          this->setEval((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
+      }
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1472,27 +1991,42 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsremNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
-      else
-        this->eval = ((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT) {
+        triton::sint64 op1 = signExtend64(this->childs[0]->evaluate64(), this->size);
+        triton::sint64 op2 = signExtend64(this->childs[1]->evaluate64(), this->size);
+
+        if (op2 == 0)
+          this->setEval(this->childs[0]->evaluate64());
+        /* INT64_MIN % -1 overflows, the remainder is 0 anyway */
+        else if (op2 == -1)
+          this->setEval(0);
+        else
+          this->setEval(static_cast<triton::uint64>(op1 % op2) & mask64(this->size));
+      }
+
+      else {
+        /* Sign extend */
+        op1Signed = triton::ast::modularSignExtend(this->childs[0]);
+        op2Signed = triton::ast::modularSignExtend(this->childs[1]);
+
+        if (this->childs[1]->evaluate() == 0)
+          this->setEval(this->childs[0]->evaluate());
+        else
+          this->setEval((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask());
+      }
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1538,17 +2072,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() - this->childs[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval((this->childs[0]->evaluate64() - this->childs[1]->evaluate64()) & mask64(this->size));
+      else
+        this->setEval(((this->childs[0]->evaluate() - this->childs[1]->evaluate()) & this->getBitvectorMask()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1595,20 +2132,29 @@ namespace triton {
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = (-1 & this->getBitvectorMask());
-      else
-        this->eval = (this->childs[0]->evaluate() / this->childs[1]->evaluate());
+      if (this->size <= QWORD_SIZE_BIT) {
+        if (this->childs[1]->evaluate64() == 0)
+          this->setEval(mask64(this->size));
+        else
+          this->setEval(this->childs[0]->evaluate64() / this->childs[1]->evaluate64());
+      }
+
+      else {
+        if (this->childs[1]->evaluate() == 0)
+          this->setEval(-1 & this->getBitvectorMask());
+        else
+          this->setEval(this->childs[0]->evaluate() / this->childs[1]->evaluate());
+      }
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1654,17 +2200,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() >= this->childs[1]->evaluate());
+      if (isNative(this->childs[0]))
+        this->setEval(this->childs[0]->evaluate64() >= this->childs[1]->evaluate64());
+      else
+        this->setEval((this->childs[0]->evaluate() >= this->childs[1]->evaluate()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1710,17 +2259,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() > this->childs[1]->evaluate());
+      if (isNative(this->childs[0]))
+        this->setEval(this->childs[0]->evaluate64() > this->childs[1]->evaluate64());
+      else
+        this->setEval((this->childs[0]->evaluate() > this->childs[1]->evaluate()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1766,17 +2318,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() <= this->childs[1]->evaluate());
+      if (isNative(this->childs[0]))
+        this->setEval(this->childs[0]->evaluate64() <= this->childs[1]->evaluate64());
+      else
+        this->setEval((this->childs[0]->evaluate() <= this->childs[1]->evaluate()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1822,17 +2377,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() < this->childs[1]->evaluate());
+      if (isNative(this->childs[0]))
+        this->setEval(this->childs[0]->evaluate64() < this->childs[1]->evaluate64());
+      else
+        this->setEval((this->childs[0]->evaluate() < this->childs[1]->evaluate()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1879,20 +2437,29 @@ namespace triton {
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
-      else
-        this->eval = (this->childs[0]->evaluate() % this->childs[1]->evaluate());
+      if (this->size <= QWORD_SIZE_BIT) {
+        if (this->childs[1]->evaluate64() == 0)
+          this->setEval(this->childs[0]->evaluate64());
+        else
+          this->setEval(this->childs[0]->evaluate64() % this->childs[1]->evaluate64());
+      }
+
+      else {
+        if (this->childs[1]->evaluate() == 0)
+          this->setEval(this->childs[0]->evaluate());
+        else
+          this->setEval(this->childs[0]->evaluate() % this->childs[1]->evaluate());
+      }
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1938,17 +2505,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() ^ this->childs[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval(~(this->childs[0]->evaluate64() ^ this->childs[1]->evaluate64()) & mask64(this->size));
+      else
+        this->setEval((~(this->childs[0]->evaluate() ^ this->childs[1]->evaluate()) & this->getBitvectorMask()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -1994,17 +2564,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() ^ this->childs[1]->evaluate());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval(this->childs[0]->evaluate64() ^ this->childs[1]->evaluate64());
+      else
+        this->setEval((this->childs[0]->evaluate() ^ this->childs[1]->evaluate()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2062,17 +2635,21 @@ namespace triton {
 
       /* Init attributes */
       this->size = size;
-      this->eval = (value & this->getBitvectorMask());
+
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval((value & mask64(this->size)).convert_to<triton::uint64>());
+      else
+        this->setEval(value & this->getBitvectorMask());
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2115,17 +2692,17 @@ namespace triton {
 
       /* Init attributes */
       this->size = 0;
-      this->eval = 0;
+      this->setEval(0);
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2191,19 +2768,31 @@ namespace triton {
       if (this->size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("ConcatNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = this->childs[0]->evaluate();
-      for (triton::uint32 index = 0; index < this->childs.size()-1; index++)
-        this->eval = ((this->eval << this->childs[index+1]->getBitvectorSize()) | this->childs[index+1]->evaluate());
+      if (this->size <= QWORD_SIZE_BIT) {
+        triton::uint64 value = this->childs[0]->evaluate64();
+        for (triton::uint32 index = 0; index < this->childs.size()-1; index++) {
+          triton::uint32 shift = this->childs[index+1]->getBitvectorSize();
+          value = ((shift >= QWORD_SIZE_BIT) ? 0 : (value << shift)) | this->childs[index+1]->evaluate64();
+        }
+        this->setEval(value);
+      }
+
+      else {
+        triton::uint512 value = this->childs[0]->evaluate();
+        for (triton::uint32 index = 0; index < this->childs.size()-1; index++)
+          value = ((value << this->childs[index+1]->getBitvectorSize()) | this->childs[index+1]->evaluate());
+        this->setEval(value);
+      }
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2242,13 +2831,12 @@ namespace triton {
 
     void DecimalNode::init(void) {
       /* Init attributes */
-      this->eval        = 0;
       this->size        = 0;
       this->symbolized  = false;
+      this->setEval(0);
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2299,17 +2887,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      this->eval = this->childs[1]->evaluate();
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval(this->childs[1]->evaluate64());
+      else
+        this->setEval(this->childs[1]->evaluate());
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2352,17 +2943,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() != this->childs[1]->evaluate());
+      if (isNative(this->childs[0]) && isNative(this->childs[1]))
+        this->setEval(this->childs[0]->evaluate64() != this->childs[1]->evaluate64());
+      else
+        this->setEval((this->childs[0]->evaluate() != this->childs[1]->evaluate()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2405,17 +2999,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() == this->childs[1]->evaluate());
+      if (isNative(this->childs[0]) && isNative(this->childs[1]))
+        this->setEval(this->childs[0]->evaluate64() == this->childs[1]->evaluate64());
+      else
+        this->setEval((this->childs[0]->evaluate() == this->childs[1]->evaluate()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2471,20 +3068,24 @@ namespace triton {
 
       /* Init attributes */
       this->size = ((high - low) + 1);
-      this->eval = ((this->childs[2]->evaluate() >> low) & this->getBitvectorMask());
 
       if (this->size > this->childs[2]->getBitvectorSize() || high >= this->childs[2]->getBitvectorSize())
         throw triton::exceptions::Ast("ExtractNode::init(): The size of the extraction is higher than the child expression.");
 
+      if (isNative(this->childs[2]))
+        this->setEval((this->childs[2]->evaluate64() >> low) & mask64(this->size));
+      else
+        this->setEval((this->childs[2]->evaluate() >> low) & this->getBitvectorMask());
+
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2531,17 +3132,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      this->eval = this->childs[0]->evaluate() ? this->childs[1]->evaluate() : this->childs[2]->evaluate();
+      if (this->size <= QWORD_SIZE_BIT && isNative(this->childs[0]))
+        this->setEval(this->childs[0]->evaluate64() ? this->childs[1]->evaluate64() : this->childs[2]->evaluate64());
+      else
+        this->setEval(this->childs[0]->evaluate() ? this->childs[1]->evaluate() : this->childs[2]->evaluate());
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2584,17 +3188,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() && this->childs[1]->evaluate());
+      if (isNative(this->childs[0]) && isNative(this->childs[1]))
+        this->setEval(this->childs[0]->evaluate64() != 0 && this->childs[1]->evaluate64() != 0);
+      else
+        this->setEval((this->childs[0]->evaluate() && this->childs[1]->evaluate()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2641,17 +3248,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[2]->getBitvectorSize();
-      this->eval = this->childs[2]->evaluate();
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval(this->childs[2]->evaluate64());
+      else
+        this->setEval(this->childs[2]->evaluate());
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2693,17 +3303,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = !(this->childs[0]->evaluate());
+      if (isNative(this->childs[0]))
+        this->setEval(this->childs[0]->evaluate64() == 0);
+      else
+        this->setEval(!(this->childs[0]->evaluate()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2746,17 +3359,20 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() || this->childs[1]->evaluate());
+      if (isNative(this->childs[0]) && isNative(this->childs[1]))
+        this->setEval(this->childs[0]->evaluate64() != 0 || this->childs[1]->evaluate64() != 0);
+      else
+        this->setEval((this->childs[0]->evaluate() || this->childs[1]->evaluate()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2778,6 +3394,7 @@ namespace triton {
 
 
     ReferenceNode::ReferenceNode(triton::usize value) {
+      this->ast   = nullptr;
       this->kind  = REFERENCE_NODE;
       this->value = value;
       this->init();
@@ -2785,6 +3402,8 @@ namespace triton {
 
 
     ReferenceNode::ReferenceNode(const ReferenceNode& copy) : AbstractNode(copy) {
+      /* The copy is not a parent of the referenced AST until it is initialized */
+      this->ast   = nullptr;
       this->value = copy.value;
     }
 
@@ -2795,22 +3414,30 @@ namespace triton {
 
     void ReferenceNode::init(void) {
       /* Init attributes */
-      if (!triton::api.isSymbolicExpressionIdExists(this->value)) {
-        this->eval        = 0;
+      if (!this->api->isSymbolicExpressionIdExists(this->value)) {
         this->size        = 0;
         this->symbolized  = false;
+        this->setEval(0);
       }
       else {
-        this->eval        = triton::api.getAstFromId(this->value)->evaluate();
-        this->size        = triton::api.getAstFromId(this->value)->getBitvectorSize();
-        this->symbolized  = triton::api.getAstFromId(this->value)->isSymbolized();
-
-        triton::api.getAstFromId(this->value)->setParent(this);
+        AbstractNode* node = this->api->getAstFromId(this->value);
+        this->size        = node->getBitvectorSize();
+        this->symbolized  = node->isSymbolized();
+        if (this->size <= QWORD_SIZE_BIT)
+          this->setEval(node->evaluate64());
+        else
+          this->setEval(node->evaluate());
+
+        /* The referenced expression may have a new AST since the last init */
+        if (this->ast != node)
+          this->detach();
+
+        node->setParent(this);
+        this->ast = node;
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2819,6 +3446,15 @@ namespace triton {
     }
 
 
+    AbstractNode* ReferenceNode::detach(void) {
+      AbstractNode* node = this->ast;
+      if (node != nullptr)
+        node->removeParent(this);
+      this->ast = nullptr;
+      return node;
+    }
+
+
     void ReferenceNode::accept(AstVisitor& v) {
       v(*this);
     }
@@ -2851,13 +3487,12 @@ namespace triton {
 
     void StringNode::init(void) {
       /* Init attributes */
-      this->eval        = 0;
       this->size        = 0;
       this->symbolized  = false;
+      this->setEval(0);
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2915,17 +3550,20 @@ namespace triton {
       if (size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("SxNode::SxNode(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = ((((this->childs[1]->evaluate() >> (this->childs[1]->getBitvectorSize()-1)) == 0) ? this->childs[1]->evaluate() : (this->childs[1]->evaluate() | ~(this->childs[1]->getBitvectorMask()))) & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval(static_cast<triton::uint64>(signExtend64(this->childs[1]->evaluate64(), this->childs[1]->getBitvectorSize())) & mask64(this->size));
+      else
+        this->setEval(((((this->childs[1]->evaluate() >> (this->childs[1]->getBitvectorSize()-1)) == 0) ? this->childs[1]->evaluate() : (this->childs[1]->evaluate() | ~(this->childs[1]->getBitvectorMask()))) & this->getBitvectorMask()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -2965,18 +3603,17 @@ namespace triton {
     void VariableNode::init(void) {
       triton::engines::symbolic::SymbolicVariable* symVar = nullptr;
 
-      symVar = triton::api.getSymbolicVariableFromName(this->value);
+      symVar = this->api->getSymbolicVariableFromName(this->value);
       if (symVar) {
         this->size        = symVar->getSize();
-        this->eval        = (symVar->getConcreteValue() & this->getBitvectorMask());
         this->symbolized  = true;
+        this->setEval(symVar->getConcreteValue() & this->getBitvectorMask());
       }
       else
         throw triton::exceptions::Ast("VariableNode::init(): Variable not found.");
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -3034,17 +3671,20 @@ namespace triton {
       if (size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("ZxNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = (this->childs[1]->evaluate() & this->getBitvectorMask());
+      if (this->size <= QWORD_SIZE_BIT)
+        this->setEval(this->childs[1]->evaluate64() & mask64(this->size));
+      else
+        this->setEval((this->childs[1]->evaluate() & this->getBitvectorMask()));
 
       /* Init childs and spread information */
+      this->symbolized = false;
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
         this->childs[index]->setParent(this);
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      this->initParents();
     }
 
 
@@ -3073,7 +3713,7 @@ namespace triton {
 
     /* Representation dispatcher from an abstract node */
     std::ostream& operator<<(std::ostream& stream, AbstractNode* node) {
-      return triton::ast::representations::astRepresentation.print(stream, node);
+      return node->getApi()->printAstRepresentation(stream, node);
     }
 
   }; /* ast namespace */
@@ -3135,7 +3775,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) AssertNode(expr);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3143,7 +3783,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvNode(value, size);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3151,7 +3791,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvaddNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3159,7 +3799,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvandNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3167,7 +3807,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvashrNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3175,7 +3815,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvdeclNode(size);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3183,7 +3823,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvNode(0, 1);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3191,7 +3831,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvlshrNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3199,7 +3839,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvmulNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3207,7 +3847,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvnandNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3215,7 +3855,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvnegNode(expr);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3223,7 +3863,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvnorNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3231,7 +3871,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvnotNode(expr);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3239,7 +3879,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvorNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3247,7 +3887,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvrolNode(rot, expr);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3255,7 +3895,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvrolNode(rot, expr);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3263,7 +3903,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvrorNode(rot, expr);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3271,7 +3911,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvrorNode(rot, expr);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3279,7 +3919,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsdivNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3287,7 +3927,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsgeNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3295,7 +3935,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsgtNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3303,7 +3943,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvshlNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3311,7 +3951,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsleNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3319,7 +3959,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsltNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3327,7 +3967,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsmodNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3335,7 +3975,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsremNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3343,7 +3983,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvsubNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3351,7 +3991,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvNode(1, 1);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3359,7 +3999,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvudivNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3367,7 +4007,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvugeNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3375,7 +4015,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvugtNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3383,7 +4023,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvuleNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3391,7 +4031,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvultNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3399,7 +4039,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvuremNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3407,7 +4047,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvxnorNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3415,7 +4055,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) BvxorNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3423,7 +4063,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) CompoundNode(exprs);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3431,7 +4071,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) ConcatNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3439,7 +4079,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) ConcatNode(exprs);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3447,7 +4087,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) ConcatNode(exprs);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3455,7 +4095,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) DecimalNode(value);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3463,7 +4103,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) DeclareFunctionNode(name, bvDecl);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3471,7 +4111,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) DistinctNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3479,7 +4119,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) EqualNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3487,7 +4127,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) ExtractNode(high, low, expr);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3495,7 +4135,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) IteNode(ifExpr, thenExpr, elseExpr);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3503,7 +4143,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) LandNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3511,7 +4151,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) LetNode(alias, expr2, expr3);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3519,7 +4159,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) LnotNode(expr);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3527,7 +4167,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) LorNode(expr1, expr2);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3535,7 +4175,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) ReferenceNode(value);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3543,7 +4183,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) StringNode(value);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3551,7 +4191,7 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) SxNode(sizeExt, expr);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
@@ -3560,8 +4200,8 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) VariableNode(symVar);
 
       triton::ast::checkNode(node);
-      ret = triton::api.recordAstNode(node);
-      triton::api.recordVariableAstNode(symVar.getName(), ret);
+      ret = triton::currentApi().recordAstNode(node);
+      triton::currentApi().recordVariableAstNode(symVar.getName(), ret);
 
       return ret;
     }
@@ -3571,16 +4211,14 @@ namespace triton {
       AbstractNode* node = new(std::nothrow) ZxNode(sizeExt, expr);
       triton::ast::checkNode(node);
 
-      return triton::api.recordAstNode(node);
+      return triton::currentApi().recordAstNode(node);
     }
 
 
-    AbstractNode* newInstance(AbstractNode* node) {
+    /* Returns a copy of the node which shares the childs of the original one */
+    static AbstractNode* copyNode(AbstractNode* node) {
       AbstractNode* newNode = nullptr;
 
-      if (node == nullptr)
-        return nullptr;
-
       switch (node->getKind()) {
         case ASSERT_NODE:               newNode = new(std::nothrow) AssertNode(*reinterpret_cast<AssertNode*>(node)); break;
         case BVADD_NODE:                newNode = new(std::nothrow) BvaddNode(*reinterpret_cast<BvaddNode*>(node)); break;
@@ -3641,6 +4279,41 @@ namespace triton {
       return newNode;
     }
 
+
+    AbstractNode* newInstance(AbstractNode* node) {
+      AbstractNode* newNode = nullptr;
+
+      if (node == nullptr)
+        return nullptr;
+
+      newNode = copyNode(node);
+      for (triton::uint32 index = 0; index < node->getChilds().size(); index++)
+        newNode->getChilds()[index] = triton::ast::newInstance(node->getChilds()[index]);
+
+      return newNode;
+    }
+
+
+    AbstractNode* newInstance(AbstractNode* node, const AstChildList& childs) {
+      AbstractNode* newNode = nullptr;
+
+      if (node == nullptr)
+        return nullptr;
+
+      if (childs.size() != node->getChilds().size())
+        throw triton::exceptions::Ast("triton::ast::newInstance(): Invalid number of childs.");
+
+      newNode = copyNode(node);
+      newNode->getParents().clear();
+      for (triton::uint32 index = 0; index < childs.size(); index++)
+        newNode->getChilds()[index] = childs[index];
+
+      /* The attributes copied from the original node depend on its childs, they are computed again */
+      newNode->init();
+
+      return triton::currentApi().recordAstNode(newNode);
+    }
+
   }; /* ast namespace */
 }; /* triton namespace */
 
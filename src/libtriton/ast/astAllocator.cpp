@@ -0,0 +1,384 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <set>
+
+#if defined(_WIN32)
+  #include <malloc.h>
+#endif
+
+#include <triton/astAllocator.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Size (and alignment) of a slab */
+    static const triton::usize SLAB_SIZE = 0x10000;
+
+    /* Granularity of size classes */
+    static const triton::usize CLASS_GRANULARITY = 16;
+
+    /* Number of size classes, bigger blocks have their own slab */
+    static const triton::uint32 NUMBER_OF_CLASSES = 32;
+
+    /* Size class of big blocks */
+    static const triton::uint32 BIG_CLASS = NUMBER_OF_CLASSES;
+
+
+    /* Returns the size of the slab header rounded up to the granularity */
+    static inline triton::usize headerSize(triton::usize header) {
+      return (header + CLASS_GRANULARITY - 1) & ~(CLASS_GRANULARITY - 1);
+    }
+
+
+    /* The allocators of the exited threads, they are reused by the next threads */
+    struct AllocatorPool {
+      std::mutex lock;
+      std::vector<AstAllocator*> allocators;
+    };
+
+
+    /* Returns the pool of allocators (never destroyed) */
+    static AllocatorPool& allocatorPool(void) {
+      static AllocatorPool* pool = new AllocatorPool();
+      return *pool;
+    }
+
+
+    /* The allocator of the calling thread, nullptr if the thread has exited */
+    static thread_local AstAllocator* threadAllocator = nullptr;
+
+
+    /* Takes an allocator from the pool for the calling thread and gives it back when the thread exits */
+    class ThreadAllocator {
+      public:
+        ThreadAllocator() {
+          AllocatorPool& pool = allocatorPool();
+          std::lock_guard<std::mutex> guard(pool.lock);
+
+          if (pool.allocators.empty()) {
+            threadAllocator = new AstAllocator();
+            return;
+          }
+
+          threadAllocator = pool.allocators.back();
+          pool.allocators.pop_back();
+        }
+
+        ~ThreadAllocator() {
+          AllocatorPool& pool = allocatorPool();
+          std::lock_guard<std::mutex> guard(pool.lock);
+
+          pool.allocators.push_back(threadAllocator);
+          threadAllocator = nullptr;
+        }
+    };
+
+
+    AstAllocator& astAllocator(void) {
+      static thread_local ThreadAllocator owner;
+      static AstAllocator* exited = new AstAllocator(true);
+
+      if (threadAllocator != nullptr)
+        return *threadAllocator;
+
+      /* Nodes allocated after the exit of the thread (e.g. by static destructors) */
+      return *exited;
+    }
+
+
+    AstAllocator::AstAllocator(bool shared) : remoteBlocks(nullptr) {
+      this->lastArena       = nullptr;
+      this->lastArenaSlabs  = nullptr;
+      this->shared          = shared;
+      this->usedBlocks      = 0;
+    }
+
+
+    AstAllocator::Slab** AstAllocator::getArenaSlabs(const void* arena) {
+      if (this->lastArenaSlabs != nullptr && this->lastArena == arena)
+        return this->lastArenaSlabs;
+
+      std::vector<Slab*>& lists = this->arenas[arena];
+      if (lists.empty())
+        lists.resize(NUMBER_OF_CLASSES, nullptr);
+
+      this->lastArena       = arena;
+      this->lastArenaSlabs  = lists.data();
+
+      return this->lastArenaSlabs;
+    }
+
+
+    AstAllocator::Slab* AstAllocator::newSlab(triton::uint32 sizeClass, triton::usize bytes, Slab** arenaSlabs) {
+      void* memory = nullptr;
+
+      #if defined(_WIN32)
+        memory = _aligned_malloc(bytes, SLAB_SIZE);
+      #else
+        if (posix_memalign(&memory, SLAB_SIZE, bytes) != 0)
+          memory = nullptr;
+      #endif
+
+      if (memory == nullptr)
+        throw std::bad_alloc();
+
+      Slab* slab        = static_cast<Slab*>(memory);
+      slab->owner       = this;
+      slab->arenaSlabs  = arenaSlabs;
+      slab->prev        = nullptr;
+      slab->next        = nullptr;
+      slab->freeBlocks  = nullptr;
+      slab->sizeClass   = sizeClass;
+      slab->used        = 0;
+      slab->carved      = 0;
+      slab->capacity    = 1;
+      slab->available   = false;
+
+      if (sizeClass != BIG_CLASS)
+        slab->capacity = (SLAB_SIZE - headerSize(sizeof(Slab))) / ((sizeClass + 1) * CLASS_GRANULARITY);
+
+      this->slabs.push_back(slab);
+
+      return slab;
+    }
+
+
+    void AstAllocator::deleteSlab(Slab* slab) {
+      #if defined(_WIN32)
+        _aligned_free(slab);
+      #else
+        std::free(slab);
+      #endif
+    }
+
+
+    void AstAllocator::linkSlab(Slab* slab) {
+      Slab*& head = slab->arenaSlabs[slab->sizeClass];
+
+      slab->prev      = nullptr;
+      slab->next      = head;
+      slab->available = true;
+
+      if (head != nullptr)
+        head->prev = slab;
+      head = slab;
+    }
+
+
+    void AstAllocator::unlinkSlab(Slab* slab) {
+      if (slab->prev != nullptr)
+        slab->prev->next = slab->next;
+      else
+        slab->arenaSlabs[slab->sizeClass] = slab->next;
+
+      if (slab->next != nullptr)
+        slab->next->prev = slab->prev;
+
+      slab->prev      = nullptr;
+      slab->next      = nullptr;
+      slab->available = false;
+    }
+
+
+    void AstAllocator::freeBlock(void* ptr, bool reuse) {
+      Slab* slab = reinterpret_cast<Slab*>(reinterpret_cast<triton::usize>(ptr) & ~(SLAB_SIZE - 1));
+
+      slab->used--;
+      this->usedBlocks--;
+
+      /* Big blocks are given back to the system when the slab is released */
+      if (slab->sizeClass == BIG_CLASS)
+        return;
+
+      /* All blocks of the slab are free, including the discarded ones */
+      if (slab->used == 0) {
+        slab->freeBlocks = nullptr;
+        slab->carved     = 0;
+      }
+
+      else if (reuse) {
+        *reinterpret_cast<void**>(ptr) = slab->freeBlocks;
+        slab->freeBlocks = ptr;
+      }
+
+      /* A slab is linked only if a block can be allocated from it */
+      if (slab->available == false && (slab->freeBlocks != nullptr || slab->carved != slab->capacity))
+        this->linkSlab(slab);
+    }
+
+
+    void AstAllocator::drainRemoteBlocks(void) {
+      void* block = this->remoteBlocks.exchange(nullptr, std::memory_order_acquire);
+
+      while (block != nullptr) {
+        void* next = *reinterpret_cast<void**>(block);
+        this->freeBlock(block, true);
+        block = next;
+      }
+    }
+
+
+    void* AstAllocator::allocate(triton::usize size, const void* arena) {
+      std::unique_lock<std::mutex> guard(this->lock, std::defer_lock);
+      triton::uint32 sizeClass = static_cast<triton::uint32>((size + CLASS_GRANULARITY - 1) / CLASS_GRANULARITY);
+      triton::uint8* block     = nullptr;
+
+      if (this->shared)
+        guard.lock();
+
+      if (this->remoteBlocks.load(std::memory_order_relaxed) != nullptr)
+        this->drainRemoteBlocks();
+
+      /* A zero-sized request still needs a distinct block */
+      if (sizeClass != 0)
+        sizeClass--;
+
+      /* Big blocks have their own slab */
+      if (sizeClass >= NUMBER_OF_CLASSES) {
+        Slab* slab = this->newSlab(BIG_CLASS, headerSize(sizeof(Slab)) + size, nullptr);
+        slab->used = 1;
+        this->usedBlocks++;
+        return reinterpret_cast<triton::uint8*>(slab) + headerSize(sizeof(Slab));
+      }
+
+      Slab** arenaSlabs = this->getArenaSlabs(arena);
+      Slab* slab        = arenaSlabs[sizeClass];
+      if (slab == nullptr) {
+        slab = this->newSlab(sizeClass, SLAB_SIZE, arenaSlabs);
+        this->linkSlab(slab);
+      }
+
+      /* Reuse a freed block first, otherwise carve a new one */
+      if (slab->freeBlocks != nullptr) {
+        block = static_cast<triton::uint8*>(slab->freeBlocks);
+        slab->freeBlocks = *reinterpret_cast<void**>(block);
+      }
+      else {
+        block = reinterpret_cast<triton::uint8*>(slab) + headerSize(sizeof(Slab)) + (slab->carved * (sizeClass + 1) * CLASS_GRANULARITY);
+        slab->carved++;
+      }
+
+      slab->used++;
+      this->usedBlocks++;
+
+      /* The slab is full */
+      if (slab->freeBlocks == nullptr && slab->carved == slab->capacity)
+        this->unlinkSlab(slab);
+
+      return block;
+    }
+
+
+    void AstAllocator::deallocate(void* ptr) {
+      if (ptr == nullptr)
+        return;
+
+      Slab* slab          = reinterpret_cast<Slab*>(reinterpret_cast<triton::usize>(ptr) & ~(SLAB_SIZE - 1));
+      AstAllocator* owner = slab->owner;
+
+      /* The owner gives the block back without lock (unless the allocator is shared) */
+      if (owner == &astAllocator()) {
+        std::unique_lock<std::mutex> guard(owner->lock, std::defer_lock);
+        if (owner->shared)
+          guard.lock();
+        owner->freeBlock(ptr, true);
+        return;
+      }
+
+      /* Another thread pushes the block on the remote list of the owner */
+      void* head = owner->remoteBlocks.load(std::memory_order_relaxed);
+      do {
+        *reinterpret_cast<void**>(ptr) = head;
+      } while (!owner->remoteBlocks.compare_exchange_weak(head, ptr, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+
+    bool AstAllocator::owns(const void* ptr) const {
+      const Slab* slab = reinterpret_cast<const Slab*>(reinterpret_cast<triton::usize>(ptr) & ~(SLAB_SIZE - 1));
+      return (ptr != nullptr && slab->owner == this);
+    }
+
+
+    void AstAllocator::discard(void* ptr) {
+      std::unique_lock<std::mutex> guard(this->lock, std::defer_lock);
+
+      if (this->shared)
+        guard.lock();
+
+      this->freeBlock(ptr, false);
+    }
+
+
+    void AstAllocator::releaseFreeSlabs(void) {
+      std::unique_lock<std::mutex> guard(this->lock, std::defer_lock);
+      std::set<Slab**> usedArenas;
+      std::vector<Slab*> kept;
+
+      if (this->shared)
+        guard.lock();
+
+      this->drainRemoteBlocks();
+
+      for (auto it = this->slabs.begin(); it != this->slabs.end(); it++) {
+        Slab* slab = *it;
+
+        if (slab->used != 0) {
+          usedArenas.insert(slab->arenaSlabs);
+          kept.push_back(slab);
+          continue;
+        }
+
+        if (slab->available)
+          this->unlinkSlab(slab);
+
+        this->deleteSlab(slab);
+      }
+
+      this->slabs.swap(kept);
+
+      /* Forget the arenas without slab */
+      for (auto it = this->arenas.begin(); it != this->arenas.end();) {
+        if (usedArenas.find(it->second.data()) == usedArenas.end())
+          it = this->arenas.erase(it);
+        else
+          it++;
+      }
+
+      this->lastArena       = nullptr;
+      this->lastArenaSlabs  = nullptr;
+    }
+
+
+    std::map<std::string, triton::usize> AstAllocator::getStats(void) {
+      std::unique_lock<std::mutex> guard(this->lock, std::defer_lock);
+      std::map<std::string, triton::usize> stats;
+      triton::usize bytes = 0;
+
+      if (this->shared)
+        guard.lock();
+
+      /* Blocks freed by other threads are not in use anymore */
+      this->drainRemoteBlocks();
+
+      for (auto it = this->slabs.begin(); it != this->slabs.end(); it++)
+        bytes += ((*it)->sizeClass == BIG_CLASS) ? 0 : SLAB_SIZE;
+
+      stats["bytes"]      = bytes;
+      stats["slabs"]      = this->slabs.size();
+      stats["usedBlocks"] = this->usedBlocks;
+
+      return stats;
+    }
+
+  }; /* ast namespace */
+}; /*triton namespace */
@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+
 #include <triton/astDictionaries.hpp>
 
 
@@ -12,11 +14,67 @@
 namespace triton {
   namespace ast {
 
+    /* Initial number of slots of the table (must be a power of two) */
+    static const triton::usize INITIAL_CAPACITY = 1024;
+
+    /* Names of the kinds of node reported by getAstDictionariesStats */
+    static const std::pair<triton::uint32, const char*> kindNames[] = {
+      {triton::ast::ASSERT_NODE,           "assert"},
+      {triton::ast::BVADD_NODE,            "bvadd"},
+      {triton::ast::BVAND_NODE,            "bvand"},
+      {triton::ast::BVASHR_NODE,           "bvashr"},
+      {triton::ast::BVDECL_NODE,           "bvdecl"},
+      {triton::ast::BVLSHR_NODE,           "bvlshr"},
+      {triton::ast::BVMUL_NODE,            "bvmul"},
+      {triton::ast::BVNAND_NODE,           "bvnand"},
+      {triton::ast::BVNEG_NODE,            "bvneg"},
+      {triton::ast::BVNOR_NODE,            "bvnor"},
+      {triton::ast::BVNOT_NODE,            "bvnot"},
+      {triton::ast::BVOR_NODE,             "bvor"},
+      {triton::ast::BVROL_NODE,            "bvrol"},
+      {triton::ast::BVROR_NODE,            "bvror"},
+      {triton::ast::BVSDIV_NODE,           "bvsdiv"},
+      {triton::ast::BVSGE_NODE,            "bvsge"},
+      {triton::ast::BVSGT_NODE,            "bvsgt"},
+      {triton::ast::BVSHL_NODE,            "bvshl"},
+      {triton::ast::BVSLE_NODE,            "bvsle"},
+      {triton::ast::BVSLT_NODE,            "bvslt"},
+      {triton::ast::BVSMOD_NODE,           "bvsmod"},
+      {triton::ast::BVSREM_NODE,           "bvsrem"},
+      {triton::ast::BVSUB_NODE,            "bvsub"},
+      {triton::ast::BVUDIV_NODE,           "bvudiv"},
+      {triton::ast::BVUGE_NODE,            "bvuge"},
+      {triton::ast::BVUGT_NODE,            "bvugt"},
+      {triton::ast::BVULE_NODE,            "bvule"},
+      {triton::ast::BVULT_NODE,            "bvult"},
+      {triton::ast::BVUREM_NODE,           "bvurem"},
+      {triton::ast::BVXNOR_NODE,           "bvxnor"},
+      {triton::ast::BVXOR_NODE,            "bvxor"},
+      {triton::ast::BV_NODE,               "bv"},
+      {triton::ast::COMPOUND_NODE,         "compound"},
+      {triton::ast::CONCAT_NODE,           "concat"},
+      {triton::ast::DECIMAL_NODE,          "decimal"},
+      {triton::ast::DECLARE_FUNCTION_NODE, "declareFunction"},
+      {triton::ast::DISTINCT_NODE,         "distinct"},
+      {triton::ast::EQUAL_NODE,            "equal"},
+      {triton::ast::EXTRACT_NODE,          "extract"},
+      {triton::ast::ITE_NODE,              "ite"},
+      {triton::ast::LAND_NODE,             "land"},
+      {triton::ast::LET_NODE,              "let"},
+      {triton::ast::LNOT_NODE,             "lnot"},
+      {triton::ast::LOR_NODE,              "lor"},
+      {triton::ast::REFERENCE_NODE,        "reference"},
+      {triton::ast::STRING_NODE,           "string"},
+      {triton::ast::SX_NODE,               "sx"},
+      {triton::ast::VARIABLE_NODE,         "variable"},
+      {triton::ast::ZX_NODE,               "zx"},
+    };
+
+
     AstDictionaries::AstDictionaries(bool isBackup) {
       this->allocatedNodes  = 0;
       this->backupFlag      = isBackup;
-
-      this->linkDictionaries();
+      this->tableEntries    = 0;
     }
 
 
@@ -26,10 +84,8 @@ namespace triton {
 
 
     AstDictionaries::~AstDictionaries() {
-      if (this->backupFlag == false) {
-        for (auto it = this->allocatedDictionaries.begin(); it != this->allocatedDictionaries.end(); it++)
-          delete *it;
-      }
+      if (this->backupFlag == false)
+        this->releaseAstDictionaries();
     }
 
 
@@ -39,243 +95,178 @@ namespace triton {
 
 
     void AstDictionaries::copy(const AstDictionaries& other) {
-      /* Global information */
-      this->allocatedNodes              = other.allocatedNodes;
-      this->allocatedDictionaries       = other.allocatedDictionaries;
-      this->backupFlag                  = true;
-
-      /* Dictionnaries */
-      this->assertDictionary            = other.assertDictionary;
-      this->bvaddDictionary             = other.bvaddDictionary;
-      this->bvandDictionary             = other.bvandDictionary;
-      this->bvashrDictionary            = other.bvashrDictionary;
-      this->bvdeclDictionary            = other.bvdeclDictionary;
-      this->bvlshrDictionary            = other.bvlshrDictionary;
-      this->bvmulDictionary             = other.bvmulDictionary;
-      this->bvnandDictionary            = other.bvnandDictionary;
-      this->bvnegDictionary             = other.bvnegDictionary;
-      this->bvnorDictionary             = other.bvnorDictionary;
-      this->bvnotDictionary             = other.bvnotDictionary;
-      this->bvorDictionary              = other.bvorDictionary;
-      this->bvrolDictionary             = other.bvrolDictionary;
-      this->bvrorDictionary             = other.bvrorDictionary;
-      this->bvsdivDictionary            = other.bvsdivDictionary;
-      this->bvsgeDictionary             = other.bvsgeDictionary;
-      this->bvsgtDictionary             = other.bvsgtDictionary;
-      this->bvshlDictionary             = other.bvshlDictionary;
-      this->bvsleDictionary             = other.bvsleDictionary;
-      this->bvsltDictionary             = other.bvsltDictionary;
-      this->bvsmodDictionary            = other.bvsmodDictionary;
-      this->bvsremDictionary            = other.bvsremDictionary;
-      this->bvsubDictionary             = other.bvsubDictionary;
-      this->bvudivDictionary            = other.bvudivDictionary;
-      this->bvugeDictionary             = other.bvugeDictionary;
-      this->bvugtDictionary             = other.bvugtDictionary;
-      this->bvuleDictionary             = other.bvuleDictionary;
-      this->bvultDictionary             = other.bvultDictionary;
-      this->bvuremDictionary            = other.bvuremDictionary;
-      this->bvxnorDictionary            = other.bvxnorDictionary;
-      this->bvxorDictionary             = other.bvxorDictionary;
-      this->bvDictionary                = other.bvDictionary;
-      this->compoundDictionary          = other.compoundDictionary;
-      this->concatDictionary            = other.concatDictionary;
-      this->decimalDictionary           = other.decimalDictionary;
-      this->declareFunctionDictionary   = other.declareFunctionDictionary;
-      this->distinctDictionary          = other.distinctDictionary;
-      this->equalDictionary             = other.equalDictionary;
-      this->extractDictionary           = other.extractDictionary;
-      this->iteDictionary               = other.iteDictionary;
-      this->landDictionary              = other.landDictionary;
-      this->letDictionary               = other.letDictionary;
-      this->lnotDictionary              = other.lnotDictionary;
-      this->lorDictionary               = other.lorDictionary;
-      this->referenceDictionary         = other.referenceDictionary;
-      this->stringDictionary            = other.stringDictionary;
-      this->sxDictionary                = other.sxDictionary;
-      this->variableDictionary          = other.variableDictionary;
-      this->zxDictionary                = other.zxDictionary;
-
-      this->linkDictionaries();
+      this->allocatedNodes  = other.allocatedNodes;
+      this->backupFlag      = true;
+      this->table           = other.table;
+      this->tableEntries    = other.tableEntries;
+    }
+
+
+    void AstDictionaries::releaseAstDictionaries(void) {
+      for (auto it = this->table.begin(); it != this->table.end(); it++) {
+        if (it->second != nullptr) {
+          it->second->setInDictionaries(false, 0);
+          it->second->release();
+        }
+      }
+
+      this->table.clear();
+      this->tableEntries = 0;
+    }
+
+
+    void AstDictionaries::clearAstDictionaries(void) {
+      for (auto it = this->table.begin(); it != this->table.end(); it++) {
+        if (it->second != nullptr)
+          it->second->setInDictionaries(false, 0);
+      }
+
+      this->table.clear();
+      this->tableEntries = 0;
+    }
+
+
+    bool AstDictionaries::isSameNode(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2) const {
+      if (node1->getKind() != node2->getKind() || node1->getBitvectorSize() != node2->getBitvectorSize())
+        return false;
+
+      if (node1->getChilds() != node2->getChilds())
+        return false;
+
+      switch (node1->getKind()) {
+        case triton::ast::DECIMAL_NODE:
+          return static_cast<triton::ast::DecimalNode*>(node1)->getValue() == static_cast<triton::ast::DecimalNode*>(node2)->getValue();
+
+        case triton::ast::REFERENCE_NODE:
+          return static_cast<triton::ast::ReferenceNode*>(node1)->getValue() == static_cast<triton::ast::ReferenceNode*>(node2)->getValue();
+
+        case triton::ast::STRING_NODE:
+          return static_cast<triton::ast::StringNode*>(node1)->getValue() == static_cast<triton::ast::StringNode*>(node2)->getValue();
+
+        case triton::ast::VARIABLE_NODE:
+          return static_cast<triton::ast::VariableNode*>(node1)->getValue() == static_cast<triton::ast::VariableNode*>(node2)->getValue();
+
+        default:
+          return true;
+      }
     }
 
 
-    void AstDictionaries::linkDictionaries(void) {
-      this->dictionaries[triton::ast::ASSERT_NODE]             = &this->assertDictionary;
-      this->dictionaries[triton::ast::BVADD_NODE]              = &this->bvaddDictionary;
-      this->dictionaries[triton::ast::BVAND_NODE]              = &this->bvandDictionary;
-      this->dictionaries[triton::ast::BVASHR_NODE]             = &this->bvashrDictionary;
-      this->dictionaries[triton::ast::BVDECL_NODE]             = &this->bvdeclDictionary;
-      this->dictionaries[triton::ast::BVLSHR_NODE]             = &this->bvlshrDictionary;
-      this->dictionaries[triton::ast::BVMUL_NODE]              = &this->bvmulDictionary;
-      this->dictionaries[triton::ast::BVNAND_NODE]             = &this->bvnandDictionary;
-      this->dictionaries[triton::ast::BVNEG_NODE]              = &this->bvnegDictionary;
-      this->dictionaries[triton::ast::BVNOR_NODE]              = &this->bvnorDictionary;
-      this->dictionaries[triton::ast::BVNOT_NODE]              = &this->bvnotDictionary;
-      this->dictionaries[triton::ast::BVOR_NODE]               = &this->bvorDictionary;
-      this->dictionaries[triton::ast::BVROL_NODE]              = &this->bvrolDictionary;
-      this->dictionaries[triton::ast::BVROR_NODE]              = &this->bvrorDictionary;
-      this->dictionaries[triton::ast::BVSDIV_NODE]             = &this->bvsdivDictionary;
-      this->dictionaries[triton::ast::BVSGE_NODE]              = &this->bvsgeDictionary;
-      this->dictionaries[triton::ast::BVSGT_NODE]              = &this->bvsgtDictionary;
-      this->dictionaries[triton::ast::BVSHL_NODE]              = &this->bvshlDictionary;
-      this->dictionaries[triton::ast::BVSLE_NODE]              = &this->bvsleDictionary;
-      this->dictionaries[triton::ast::BVSLT_NODE]              = &this->bvsltDictionary;
-      this->dictionaries[triton::ast::BVSMOD_NODE]             = &this->bvsmodDictionary;
-      this->dictionaries[triton::ast::BVSREM_NODE]             = &this->bvsremDictionary;
-      this->dictionaries[triton::ast::BVSUB_NODE]              = &this->bvsubDictionary;
-      this->dictionaries[triton::ast::BVUDIV_NODE]             = &this->bvudivDictionary;
-      this->dictionaries[triton::ast::BVUGE_NODE]              = &this->bvugeDictionary;
-      this->dictionaries[triton::ast::BVUGT_NODE]              = &this->bvugtDictionary;
-      this->dictionaries[triton::ast::BVULE_NODE]              = &this->bvuleDictionary;
-      this->dictionaries[triton::ast::BVULT_NODE]              = &this->bvultDictionary;
-      this->dictionaries[triton::ast::BVUREM_NODE]             = &this->bvuremDictionary;
-      this->dictionaries[triton::ast::BVXNOR_NODE]             = &this->bvxnorDictionary;
-      this->dictionaries[triton::ast::BVXOR_NODE]              = &this->bvxorDictionary;
-      this->dictionaries[triton::ast::BV_NODE]                 = &this->bvDictionary;
-      this->dictionaries[triton::ast::COMPOUND_NODE]           = &this->compoundDictionary;
-      this->dictionaries[triton::ast::CONCAT_NODE]             = &this->concatDictionary;
-      this->dictionaries[triton::ast::DECIMAL_NODE]            = &this->decimalDictionary;
-      this->dictionaries[triton::ast::DECLARE_FUNCTION_NODE]   = &this->declareFunctionDictionary;
-      this->dictionaries[triton::ast::DISTINCT_NODE]           = &this->distinctDictionary;
-      this->dictionaries[triton::ast::EQUAL_NODE]              = &this->equalDictionary;
-      this->dictionaries[triton::ast::EXTRACT_NODE]            = &this->extractDictionary;
-      this->dictionaries[triton::ast::ITE_NODE]                = &this->iteDictionary;
-      this->dictionaries[triton::ast::LAND_NODE]               = &this->landDictionary;
-      this->dictionaries[triton::ast::LET_NODE]                = &this->letDictionary;
-      this->dictionaries[triton::ast::LNOT_NODE]               = &this->lnotDictionary;
-      this->dictionaries[triton::ast::LOR_NODE]                = &this->lorDictionary;
-      this->dictionaries[triton::ast::REFERENCE_NODE]          = &this->referenceDictionary;
-      this->dictionaries[triton::ast::STRING_NODE]             = &this->stringDictionary;
-      this->dictionaries[triton::ast::SX_NODE]                 = &this->sxDictionary;
-      this->dictionaries[triton::ast::VARIABLE_NODE]           = &this->variableDictionary;
-      this->dictionaries[triton::ast::ZX_NODE]                 = &this->zxDictionary;
+    void AstDictionaries::growTable(void) {
+      std::vector<std::pair<triton::uint64, triton::ast::AbstractNode*>> old;
+      triton::usize capacity = this->table.empty() ? INITIAL_CAPACITY : this->table.size() * 2;
+
+      old.swap(this->table);
+      this->table.resize(capacity, std::make_pair(0, nullptr));
+
+      /* Re-insert entries, hashes are kept in slots thus they are not computed again */
+      for (auto it = old.begin(); it != old.end(); it++) {
+        if (it->second == nullptr)
+          continue;
+        triton::usize index = it->first & (capacity - 1);
+        while (this->table[index].second != nullptr)
+          index = (index + 1) & (capacity - 1);
+        this->table[index] = *it;
+      }
     }
 
 
     triton::ast::AbstractNode* AstDictionaries::browseAstDictionaries(triton::ast::AbstractNode* node) {
       this->allocatedNodes++;
-      triton::uint32 kind = node->getKind();
-
-      switch (kind) {
-
-        case triton::ast::DECIMAL_NODE: {
-          auto value       = static_cast<triton::ast::DecimalNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<triton::uint512, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
-        }
 
-        case triton::ast::REFERENCE_NODE: {
-          auto value       = static_cast<triton::ast::ReferenceNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<triton::usize, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
+      /* Keep the load factor under 3/4 */
+      if ((this->tableEntries + 1) * 4 > this->table.size() * 3)
+        this->growTable();
+
+      triton::uint64 hash  = node->getHash();
+      triton::usize mask   = this->table.size() - 1;
+      triton::usize index  = hash & mask;
+
+      while (this->table[index].second != nullptr) {
+        auto& slot = this->table[index];
+        if (slot.first == hash && this->isSameNode(slot.second, node)) {
+          /* The node is a duplicate, unlink it from its childs before deleting it */
+          for (auto it = node->getChilds().begin(); it != node->getChilds().end(); it++)
+            (*it)->removeParent(node);
+          if (node->getKind() == triton::ast::REFERENCE_NODE)
+            reinterpret_cast<triton::ast::ReferenceNode*>(node)->detach();
+          delete node;
+          return slot.second;
         }
+        index = (index + 1) & mask;
+      }
 
-        case triton::ast::STRING_NODE: {
-          auto value       = static_cast<triton::ast::StringNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<std::string, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
-        }
+      this->table[index] = std::make_pair(hash, node);
+      this->tableEntries++;
+      node->setInDictionaries(true, hash);
 
-        case triton::ast::VARIABLE_NODE: {
-          auto value       = static_cast<triton::ast::VariableNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<std::string, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
-        }
+      return nullptr;
+    }
 
-        default: {
-          auto value       = node->getChilds();
-          auto dictionary  = static_cast<std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
-        }
 
+    bool AstDictionaries::removeFromAstDictionaries(triton::ast::AbstractNode* node) {
+      triton::usize mask  = this->table.size() - 1;
+      triton::usize index = 0;
+
+      /* Nodes allocated before the AST_DICTIONARIES mode has been enabled are not recorded */
+      if (!node->isInDictionaries() || this->table.empty())
+        return false;
+
+      /* The probe starts from the slot of the hash used at insertion, even if the childs have changed since (e.g. via setChild) */
+      for (index = node->getDictionaryHash() & mask; this->table[index].second != node; index = (index + 1) & mask) {
+        if (this->table[index].second == nullptr)
+          return false;
       }
 
-      this->allocatedDictionaries.insert(node);
-      return nullptr;
+      /* Backward shift deletion, entries which follow the slot are moved closer to their home slot */
+      for (triton::usize next = (index + 1) & mask; this->table[next].second != nullptr; next = (next + 1) & mask) {
+        triton::usize home = this->table[next].first & mask;
+        if (((next - home) & mask) >= ((next - index) & mask)) {
+          this->table[index] = this->table[next];
+          index = next;
+        }
+      }
+
+      this->table[index] = std::make_pair(0, nullptr);
+      this->tableEntries--;
+      node->setInDictionaries(false, 0);
+
+      return true;
     }
 
 
     std::map<std::string, triton::usize> AstDictionaries::getAstDictionariesStats(void) const {
       std::map<std::string, triton::usize> stats;
-      stats["assert"]                 = this->assertDictionary.size();
-      stats["bvadd"]                  = this->bvaddDictionary.size();
-      stats["bvand"]                  = this->bvandDictionary.size();
-      stats["bvashr"]                 = this->bvashrDictionary.size();
-      stats["bvdecl"]                 = this->bvdeclDictionary.size();
-      stats["bvlshr"]                 = this->bvlshrDictionary.size();
-      stats["bvmul"]                  = this->bvmulDictionary.size();
-      stats["bvnand"]                 = this->bvnandDictionary.size();
-      stats["bvneg"]                  = this->bvnegDictionary.size();
-      stats["bvnor"]                  = this->bvnorDictionary.size();
-      stats["bvnot"]                  = this->bvnotDictionary.size();
-      stats["bvor"]                   = this->bvorDictionary.size();
-      stats["bvrol"]                  = this->bvrolDictionary.size();
-      stats["bvror"]                  = this->bvrorDictionary.size();
-      stats["bvsdiv"]                 = this->bvsdivDictionary.size();
-      stats["bvsge"]                  = this->bvsgeDictionary.size();
-      stats["bvsgt"]                  = this->bvsgtDictionary.size();
-      stats["bvshl"]                  = this->bvshlDictionary.size();
-      stats["bvsle"]                  = this->bvsleDictionary.size();
-      stats["bvslt"]                  = this->bvsltDictionary.size();
-      stats["bvsmod"]                 = this->bvsmodDictionary.size();
-      stats["bvsrem"]                 = this->bvsremDictionary.size();
-      stats["bvsub"]                  = this->bvsubDictionary.size();
-      stats["bvudiv"]                 = this->bvudivDictionary.size();
-      stats["bvuge"]                  = this->bvugeDictionary.size();
-      stats["bvugt"]                  = this->bvugtDictionary.size();
-      stats["bvule"]                  = this->bvuleDictionary.size();
-      stats["bvult"]                  = this->bvultDictionary.size();
-      stats["bvurem"]                 = this->bvuremDictionary.size();
-      stats["bvxnor"]                 = this->bvxnorDictionary.size();
-      stats["bvxor"]                  = this->bvxorDictionary.size();
-      stats["bv"]                     = this->bvDictionary.size();
-      stats["compound"]               = this->compoundDictionary.size();
-      stats["concat"]                 = this->concatDictionary.size();
-      stats["decimal"]                = this->decimalDictionary.size();
-      stats["declareFunction"]        = this->declareFunctionDictionary.size();
-      stats["distinct"]               = this->distinctDictionary.size();
-      stats["equal"]                  = this->equalDictionary.size();
-      stats["extract"]                = this->extractDictionary.size();
-      stats["ite"]                    = this->iteDictionary.size();
-      stats["land"]                   = this->landDictionary.size();
-      stats["let"]                    = this->letDictionary.size();
-      stats["lnot"]                   = this->lnotDictionary.size();
-      stats["lor"]                    = this->lorDictionary.size();
-      stats["reference"]              = this->referenceDictionary.size();
-      stats["string"]                 = this->stringDictionary.size();
-      stats["sx"]                     = this->sxDictionary.size();
-      stats["variable"]               = this->variableDictionary.size();
-      stats["zx"]                     = this->zxDictionary.size();
-      stats["allocatedDictionaries"]  = this->allocatedDictionaries.size();
+      std::map<triton::uint32, triton::usize> kinds;
+      triton::usize capacity  = this->table.size();
+      triton::usize maxProbe  = 0;
+      triton::usize sumProbe  = 0;
+
+      for (triton::usize index = 0; index < capacity; index++) {
+        triton::ast::AbstractNode* node = this->table[index].second;
+        if (node == nullptr)
+          continue;
+
+        /* Number of slots visited from the home slot to reach the entry */
+        triton::usize probe = ((index - (this->table[index].first & (capacity - 1))) & (capacity - 1)) + 1;
+        maxProbe  = std::max(maxProbe, probe);
+        sumProbe += probe;
+
+        kinds[node->getKind()]++;
+      }
+
+      for (auto& kind : kindNames)
+        stats[kind.second] = kinds[kind.first];
+
+      stats["allocatedDictionaries"]  = this->tableEntries;
       stats["allocatedNodes"]         = this->allocatedNodes;
+      stats["capacity"]               = capacity;
+      stats["loadFactor"]             = capacity ? (this->tableEntries * 100) / capacity : 0;
+      stats["maxProbeLength"]         = maxProbe;
+      stats["totalProbeLength"]       = sumProbe;
+
       return stats;
     }
 
   }; /* ast namespace */
 }; /*triton namespace */
-
@@ -5,6 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <triton/astAllocator.hpp>
 #include <triton/astGarbageCollector.hpp>
 #include <triton/exceptions.hpp>
 
@@ -13,80 +14,158 @@
 namespace triton {
   namespace ast {
 
-    AstGarbageCollector::AstGarbageCollector(triton::modes::Modes* modes, bool isBackup)
-      : triton::ast::AstDictionaries(isBackup) {
+    AstGarbageCollector::AstGarbageCollector(triton::modes::Modes* modes)
+      : triton::ast::AstDictionaries() {
 
       if (modes == nullptr)
         throw triton::exceptions::AstGarbageCollector("AstGarbageCollector::AstGarbageCollector(): The modes API cannot be null.");
 
-      this->backupFlag = isBackup;
-      this->modes      = modes;
+      this->allocatedNodes  = nullptr;
+      this->modes           = modes;
+      this->temporaryFlag   = false;
     }
 
 
-    AstGarbageCollector::AstGarbageCollector(const AstGarbageCollector& other)
-      : triton::ast::AstDictionaries(other) {
-      this->copy(other);
+    AstGarbageCollector::~AstGarbageCollector() {
+      this->freeAllAstNodes();
     }
 
 
-    void AstGarbageCollector::operator=(const AstGarbageCollector& other) {
-      triton::ast::AstDictionaries::operator=(other);
-      this->copy(other);
+    bool AstGarbageCollector::isRecorded(triton::ast::AbstractNode* node) const {
+      return (node->getPrevRecorded() != nullptr || this->allocatedNodes == node);
     }
 
 
-    void AstGarbageCollector::copy(const AstGarbageCollector& other) {
-      /* Remove unused nodes before the assignation */
-      for (auto it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++) {
-        if (other.allocatedNodes.find(*it) == other.allocatedNodes.end())
-          delete *it;
-      }
-      this->allocatedNodes  = other.allocatedNodes;
-      this->backupFlag      = true;
-      this->modes           = other.modes;
-      this->variableNodes   = other.variableNodes;
+    void AstGarbageCollector::linkAstNode(triton::ast::AbstractNode* node) {
+      if (this->allocatedNodes != nullptr)
+        this->allocatedNodes->setRecorded(node, this->allocatedNodes->getNextRecorded());
+      node->setRecorded(nullptr, this->allocatedNodes);
+      this->allocatedNodes = node;
     }
 
 
-    AstGarbageCollector::~AstGarbageCollector() {
-      if (this->backupFlag == false)
-        this->freeAllAstNodes();
+    void AstGarbageCollector::unlinkAstNode(triton::ast::AbstractNode* node) {
+      triton::ast::AbstractNode* prev = node->getPrevRecorded();
+      triton::ast::AbstractNode* next = node->getNextRecorded();
+
+      if (!this->isRecorded(node))
+        return;
+
+      if (prev != nullptr)
+        prev->setRecorded(prev->getPrevRecorded(), next);
+      else
+        this->allocatedNodes = next;
+
+      if (next != nullptr)
+        next->setRecorded(prev, next->getNextRecorded());
+
+      node->setRecorded(nullptr, nullptr);
     }
 
 
     void AstGarbageCollector::freeAllAstNodes(void) {
-      for (auto it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++)
-        delete *it;
+      triton::ast::AstAllocator& allocator = triton::ast::astAllocator();
+      triton::ast::AbstractNode* node      = this->allocatedNodes;
+
+      /* All nodes of the dictionaries are in the list */
+      this->clearAstDictionaries();
 
+      while (node != nullptr) {
+        triton::ast::AbstractNode* next = node->getNextRecorded();
+        node->setRecorded(nullptr, nullptr);
+
+        /* Referenced nodes are detached, they are deleted with their last reference */
+        if (node->getRefCount() != 0)
+          node->release();
+
+        /* The block is not given back to its free list, its slab is released as a whole below */
+        else if (allocator.owns(node)) {
+          node->~AbstractNode();
+          allocator.discard(node);
+        }
+
+        /* The node has been allocated by another thread */
+        else
+          delete node;
+
+        node = next;
+      }
+
+      this->allocatedNodes = nullptr;
+      this->temporaryNodes.clear();
       this->variableNodes.clear();
-      this->allocatedNodes.clear();
+
+      /* Most of slabs are now empty, give them back as a whole */
+      allocator.releaseFreeSlabs();
     }
 
 
     void AstGarbageCollector::freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes) {
       std::set<triton::ast::AbstractNode*>::iterator it;
 
-      /* Do not delete AST nodes if the AST_DICTIONARIES optimization is enabled */
-      if (this->modes->isModeEnabled(triton::modes::AST_DICTIONARIES))
+      /* Nodes are shared if the AST_DICTIONARIES optimization is enabled */
+      if (this->modes->isModeEnabled(triton::modes::AST_DICTIONARIES)) {
+        this->sweepAstNodes(nodes);
         return;
+      }
 
       for (it = nodes.begin(); it != nodes.end(); it++) {
-        /* Remove the node from the global set */
-        this->allocatedNodes.erase(*it);
+        /* Remove the node from the global list (and from the dictionaries if it has been recorded while they were enabled) */
+        this->removeFromAstDictionaries(*it);
+        this->unlinkAstNode(*it);
 
         /* Remove the node from the global variables map */
         if ((*it)->getKind() == triton::ast::VARIABLE_NODE)
           this->variableNodes.erase(reinterpret_cast<triton::ast::VariableNode*>(*it)->getValue());
 
-        /* Delete the node */
-        delete *it;
+        /* Delete the node (or detach it if it is still referenced) */
+        (*it)->release();
       }
 
       nodes.clear();
     }
 
 
+    void AstGarbageCollector::sweepAstNodes(std::set<triton::ast::AbstractNode*>& nodes) {
+      /*
+       * A shared node is deleted only if it is neither referenced nor used by a parent.
+       * Deleting a node unlinks it from its childs which may become unused in turn.
+       */
+      while (!nodes.empty()) {
+        triton::ast::AbstractNode* node = *nodes.begin();
+        nodes.erase(nodes.begin());
+
+        if (node->getRefCount() != 0 || !node->getParents().empty())
+          continue;
+
+        /* Remove the node from the dictionaries and from the global list */
+        this->removeFromAstDictionaries(node);
+        this->unlinkAstNode(node);
+
+        /* Remove the node from the global variables map */
+        if (node->getKind() == triton::ast::VARIABLE_NODE) {
+          auto var = this->variableNodes.find(reinterpret_cast<triton::ast::VariableNode*>(node)->getValue());
+          if (var != this->variableNodes.end() && var->second == node)
+            this->variableNodes.erase(var);
+        }
+
+        for (auto child = node->getChilds().begin(); child != node->getChilds().end(); child++) {
+          (*child)->removeParent(node);
+          nodes.insert(*child);
+        }
+
+        /* A reference node is also a parent of the AST it references which may become unused in turn */
+        if (node->getKind() == triton::ast::REFERENCE_NODE) {
+          triton::ast::AbstractNode* ast = reinterpret_cast<triton::ast::ReferenceNode*>(node)->detach();
+          if (ast != nullptr)
+            nodes.insert(ast);
+        }
+
+        delete node;
+      }
+    }
+
+
     void AstGarbageCollector::extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const {
       if (root == nullptr)
         return;
@@ -104,21 +183,40 @@ namespace triton {
         if (ret != nullptr)
           return ret;
       }
-      else {
-        /* Record the node */
-        this->allocatedNodes.insert(node);
-      }
+      else if (this->temporaryFlag)
+        this->temporaryNodes.insert(node);
+
+      /* Record the node */
+      this->linkAstNode(node);
       return node;
     }
 
 
+    void AstGarbageCollector::beginTemporaryAstNodes(void) {
+      this->temporaryNodes.clear();
+      this->temporaryFlag = true;
+    }
+
+
+    void AstGarbageCollector::endTemporaryAstNodes(std::set<triton::ast::AbstractNode*>& nodes) {
+      nodes.insert(this->temporaryNodes.begin(), this->temporaryNodes.end());
+      this->temporaryNodes.clear();
+      this->temporaryFlag = false;
+    }
+
+
     void AstGarbageCollector::recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node) {
       this->variableNodes[name] = node;
     }
 
 
-    const std::set<triton::ast::AbstractNode*>& AstGarbageCollector::getAllocatedAstNodes(void) const {
-      return this->allocatedNodes;
+    std::set<triton::ast::AbstractNode*> AstGarbageCollector::getAllocatedAstNodes(void) const {
+      std::set<triton::ast::AbstractNode*> nodes;
+
+      for (triton::ast::AbstractNode* node = this->allocatedNodes; node != nullptr; node = node->getNextRecorded())
+        nodes.insert(node);
+
+      return nodes;
     }
 
 
@@ -135,12 +233,23 @@ namespace triton {
 
 
     void AstGarbageCollector::setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
+      triton::ast::AbstractNode* node = this->allocatedNodes;
+
       /* Remove unused nodes before the assignation */
-      for (auto it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++) {
-        if (nodes.find(*it) == nodes.end())
-          delete *it;
+      while (node != nullptr) {
+        triton::ast::AbstractNode* next = node->getNextRecorded();
+        if (nodes.find(node) == nodes.end()) {
+          this->removeFromAstDictionaries(node);
+          this->unlinkAstNode(node);
+          node->release();
+        }
+        node = next;
+      }
+
+      for (auto it = nodes.begin(); it != nodes.end(); it++) {
+        if (!this->isRecorded(*it))
+          this->linkAstNode(*it);
       }
-      this->allocatedNodes = nodes;
     }
 
 
@@ -0,0 +1,128 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/astNodeList.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* Number of parents from which the index is built */
+    static const triton::usize INDEX_THRESHOLD = 8;
+
+
+    AstParentList::AstParentList() {
+      this->index = nullptr;
+    }
+
+
+    AstParentList::AstParentList(const AstParentList& other) {
+      this->index = nullptr;
+      this->copy(other);
+    }
+
+
+    AstParentList::~AstParentList() {
+      delete this->index;
+    }
+
+
+    void AstParentList::operator=(const AstParentList& other) {
+      if (this != &other)
+        this->copy(other);
+    }
+
+
+    void AstParentList::copy(const AstParentList& other) {
+      this->clear();
+      for (auto it = other.begin(); it != other.end(); it++)
+        this->insert(*it);
+    }
+
+
+    triton::sint64 AstParentList::find(AbstractNode* node) const {
+      if (this->index != nullptr) {
+        auto it = this->index->find(node);
+        if (it == this->index->end())
+          return -1;
+        return it->second;
+      }
+
+      for (triton::uint32 position = 0; position < this->nodes.size(); position++) {
+        if (this->nodes[position] == node)
+          return position;
+      }
+
+      return -1;
+    }
+
+
+    AstParentList::const_iterator AstParentList::begin(void) const {
+      return this->nodes.begin();
+    }
+
+
+    AstParentList::const_iterator AstParentList::end(void) const {
+      return this->nodes.end();
+    }
+
+
+    triton::usize AstParentList::size(void) const {
+      return this->nodes.size();
+    }
+
+
+    bool AstParentList::empty(void) const {
+      return this->nodes.empty();
+    }
+
+
+    void AstParentList::insert(AbstractNode* node) {
+      if (this->find(node) != -1)
+        return;
+
+      this->nodes.push_back(node);
+
+      if (this->index != nullptr) {
+        (*this->index)[node] = this->nodes.size() - 1;
+      }
+
+      else if (this->nodes.size() > INDEX_THRESHOLD) {
+        this->index = new std::unordered_map<AbstractNode*, triton::uint32>();
+        for (triton::uint32 position = 0; position < this->nodes.size(); position++)
+          (*this->index)[this->nodes[position]] = position;
+      }
+    }
+
+
+    void AstParentList::erase(AbstractNode* node) {
+      triton::sint64 position = this->find(node);
+
+      if (position == -1)
+        return;
+
+      /* The order does not matter, the last parent takes the place of the removed one */
+      AbstractNode* last = this->nodes[this->nodes.size() - 1];
+      this->nodes[position] = last;
+      this->nodes.pop_back();
+
+      if (this->index != nullptr) {
+        (*this->index)[last] = position;
+        this->index->erase(node);
+      }
+    }
+
+
+    void AstParentList::clear(void) {
+      this->nodes.clear();
+      delete this->index;
+      this->index = nullptr;
+    }
+
+  }; /* ast namespace */
+}; /*triton namespace */
@@ -5,6 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <utility>
+#include <vector>
+
 #include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/tritonToZ3Ast.hpp>
@@ -24,15 +27,141 @@ namespace triton {
 
 
     TritonToZ3Ast::~TritonToZ3Ast() {
+      this->clearTranslations();
     }
 
 
     Z3Result& TritonToZ3Ast::eval(triton::ast::AbstractNode& e) {
-      e.accept(*this);
+      /* Leftovers of a translation which has thrown */
+      this->symbols.clear();
+      this->scopes.clear();
+
+      z3::expr expr = this->translate(&e);
+      this->result.setExpr(expr);
+
       return this->result;
     }
 
 
+    z3::expr TritonToZ3Ast::translate(triton::ast::AbstractNode* node) {
+      std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+      std::vector<triton::ast::AbstractNode*> dependencies;
+
+      /*
+       * Post-order walk of the DAG. A node is translated once all its
+       * dependencies are in the memo, thus each node is translated once
+       * whatever the number of paths which lead to it.
+       */
+      worklist.push_back(std::make_pair(node, false));
+      while (!worklist.empty()) {
+        triton::ast::AbstractNode* current = worklist.back().first;
+
+        if (this->getMemo().find(current) != this->getMemo().end()) {
+          worklist.pop_back();
+          continue;
+        }
+
+        if (worklist.back().second == false) {
+          worklist.back().second = true;
+          this->getDependencies(current, dependencies);
+          for (auto it = dependencies.rbegin(); it != dependencies.rend(); it++) {
+            if (this->getMemo().find(*it) == this->getMemo().end())
+              worklist.push_back(std::make_pair(*it, false));
+          }
+          continue;
+        }
+
+        worklist.pop_back();
+        current->accept(*this);
+
+        /* Symbols of let nodes are scoped, nodes translated under a let are only kept for this let */
+        if (this->scopes.empty()) {
+          this->translations.emplace(current, this->result.getExpr());
+          current->incRefCount();
+        }
+        else
+          this->scopes.back().emplace(current, this->result.getExpr());
+      }
+
+      return this->getTranslation(node);
+    }
+
+
+    std::unordered_map<triton::ast::AbstractNode*, z3::expr>& TritonToZ3Ast::getMemo(void) {
+      if (this->scopes.empty())
+        return this->translations;
+      return this->scopes.back();
+    }
+
+
+    void TritonToZ3Ast::getDependencies(triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& dependencies) {
+      dependencies.clear();
+
+      switch (node->getKind()) {
+        /* Translated in the scope of the let (see operator()(LetNode)) */
+        case triton::ast::LET_NODE:
+          break;
+
+        case triton::ast::REFERENCE_NODE: {
+          triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue();
+          triton::engines::symbolic::SymbolicExpression* refNode = this->symbolicEngine->getSymbolicExpressionFromId(id);
+          if (refNode == nullptr)
+            throw triton::exceptions::AstTranslations("TritonToZ3Ast::ReferenceNode(): Reference node not found.");
+          dependencies.push_back(refNode->getAst());
+          break;
+        }
+
+        case triton::ast::STRING_NODE: {
+          auto symbol = this->symbols.find(reinterpret_cast<triton::ast::StringNode*>(node)->getValue());
+          if (symbol == this->symbols.end())
+            throw triton::exceptions::AstTranslations("TritonToZ3Ast::StringNode(): Symbols not found.");
+          dependencies.push_back(symbol->second);
+          break;
+        }
+
+        /* Decimal nodes are read directly by their parents */
+        default:
+          for (auto child : node->getChilds()) {
+            if (child->getKind() != triton::ast::DECIMAL_NODE)
+              dependencies.push_back(child);
+          }
+          break;
+      }
+    }
+
+
+    z3::expr& TritonToZ3Ast::getTranslation(triton::ast::AbstractNode* node) {
+      auto it = this->getMemo().find(node);
+      if (it == this->getMemo().end())
+        throw triton::exceptions::AstTranslations("TritonToZ3Ast::getTranslation(): The node has not been translated.");
+      return it->second;
+    }
+
+
+    triton::uint32 TritonToZ3Ast::getDecimalValue(triton::ast::AbstractNode* node) const {
+      if (node->getKind() != triton::ast::DECIMAL_NODE)
+        throw triton::exceptions::AstTranslations("TritonToZ3Ast::getDecimalValue(): The node must be a decimal node.");
+      return reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue().convert_to<triton::uint32>();
+    }
+
+
+    z3::context& TritonToZ3Ast::getContext(void) {
+      return this->result.getContext();
+    }
+
+
+    void TritonToZ3Ast::clearTranslations(void) {
+      for (auto it = this->translations.begin(); it != this->translations.end(); it++)
+        it->first->decRefCount();
+      this->translations.clear();
+    }
+
+
+    triton::usize TritonToZ3Ast::getNumberOfTranslations(void) const {
+      return this->translations.size();
+    }
+
+
     void TritonToZ3Ast::operator()(triton::ast::AbstractNode& e) {
       e.accept(*this);
     }
@@ -44,27 +173,27 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvaddNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvadd(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvadd(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvand(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvand(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvashrNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvashr(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvashr(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
@@ -76,18 +205,18 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvlshrNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvlshr(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvlshr(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvmulNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvmul(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvmul(this->result.getContext(), op1, op2));
 
 
       this->result.setExpr(newexpr);
@@ -95,225 +224,224 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsmodNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsmod(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsmod(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnand(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnand(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnegNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvneg(this->result.getContext(), op1.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvneg(this->result.getContext(), op1));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnor(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnotNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnot(this->result.getContext(), op1.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnot(this->result.getContext(), op1));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvor(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvrolNode& e) {
-      triton::uint32 op1  = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
-      Z3Result op2        = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_left(this->result.getContext(), op1, op2.getExpr()));
+      triton::uint32 op1  = this->getDecimalValue(e.getChilds()[0]);
+      z3::expr op2        = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_left(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvrorNode& e) {
-      triton::uint32 op1  = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
-      Z3Result op2        = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_right(this->result.getContext(), op1, op2.getExpr()));
+      triton::uint32 op1  = this->getDecimalValue(e.getChilds()[0]);
+      z3::expr op2        = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_right(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsdivNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsdiv(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsdiv(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsgeNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsge(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsge(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsgtNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsgt(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsgt(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvshlNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvshl(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvshl(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsleNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsle(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsle(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsltNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvslt(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvslt(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsremNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsrem(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsrem(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsubNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsub(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsub(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvudivNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvudiv(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvudiv(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvugeNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvuge(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvuge(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvugtNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvugt(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvugt(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvuleNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvule(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvule(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvultNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvult(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvult(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvuremNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvurem(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvurem(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvxnorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxnor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxnor(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvxorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxor(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvNode& e) {
-      Z3Result value        = this->eval(*e.getChilds()[0]);
-      Z3Result size         = this->eval(*e.getChilds()[1]);
-      triton::uint32 bvsize = static_cast<triton::uint32>(size.getUintValue());
+      std::string value(reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue());
+      triton::uint32 bvsize = this->getDecimalValue(e.getChilds()[1]);
 
-      z3::expr newexpr = this->result.getContext().bv_val(value.getStringValue().c_str(), bvsize);
+      z3::expr newexpr = this->result.getContext().bv_val(value.c_str(), bvsize);
 
       this->result.setExpr(newexpr);
     }
@@ -325,16 +453,16 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::ConcatNode& e) {
-      std::vector<triton::ast::AbstractNode*> childs = e.getChilds();
+      triton::ast::AstChildList& childs = e.getChilds();
 
       triton::uint32 idx;
 
       z3::expr nextValue(this->result.getContext());
-      z3::expr currentValue = eval(*childs[0]).getExpr();
+      z3::expr currentValue = this->getTranslation(childs[0]);
 
       //Child[0] is the LSB
       for (idx = 1; idx < childs.size(); idx++) {
-          nextValue = eval(*childs[idx]).getExpr();
+          nextValue = this->getTranslation(childs[idx]);
           currentValue = to_expr(this->result.getContext(), Z3_mk_concat(this->result.getContext(), currentValue, nextValue));
       }
 
@@ -355,9 +483,9 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::DistinctNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      Z3_ast ops[]      = {op1, op2};
       z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_distinct(this->result.getContext(), 2, ops));
 
       this->result.setExpr(newexpr);
@@ -365,40 +493,38 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::EqualNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_eq(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_eq(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::ExtractNode& e) {
-      Z3Result high     = this->eval(*e.getChilds()[0]);
-      Z3Result low      = this->eval(*e.getChilds()[1]);
-      Z3Result value    = this->eval(*e.getChilds()[2]);
-      triton::uint32 hv = static_cast<triton::uint32>(high.getUintValue());
-      triton::uint32 lv = static_cast<triton::uint32>(low.getUintValue());
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_extract(this->result.getContext(), hv, lv, value.getExpr()));
+      triton::uint32 hv = this->getDecimalValue(e.getChilds()[0]);
+      triton::uint32 lv = this->getDecimalValue(e.getChilds()[1]);
+      z3::expr value    = this->getTranslation(e.getChilds()[2]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_extract(this->result.getContext(), hv, lv, value));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::IteNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]); // condition
-      Z3Result op2      = this->eval(*e.getChilds()[1]); // if true
-      Z3Result op3      = this->eval(*e.getChilds()[2]); // if false
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_ite(this->result.getContext(), op1.getExpr(), op2.getExpr(), op3.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]); // condition
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]); // if true
+      z3::expr op3      = this->getTranslation(e.getChilds()[2]); // if false
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_ite(this->result.getContext(), op1, op2, op3));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      Z3_ast ops[]      = {op1, op2};
       z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_and(this->result.getContext(), 2, ops));
 
       this->result.setExpr(newexpr);
@@ -407,25 +533,36 @@ namespace triton {
 
     void TritonToZ3Ast::operator()(triton::ast::LetNode& e) {
       std::string symbol    = reinterpret_cast<triton::ast::StringNode*>(e.getChilds()[0])->getValue();
+      auto previous         = this->symbols.find(symbol);
+      triton::ast::AbstractNode* shadowed = (previous != this->symbols.end()) ? previous->second : nullptr;
+
       this->symbols[symbol] = e.getChilds()[1];
-      Z3Result op2          = this->eval(*e.getChilds()[2]);
+      this->scopes.push_back(std::unordered_map<triton::ast::AbstractNode*, z3::expr>());
+      z3::expr op2          = this->translate(e.getChilds()[2]);
+      this->scopes.pop_back();
 
-      this->result.setExpr(op2.getExpr());
+      /* The symbol is only bound in the body of the let */
+      if (shadowed != nullptr)
+        this->symbols[symbol] = shadowed;
+      else
+        this->symbols.erase(symbol);
+
+      this->result.setExpr(op2);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LnotNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_not(this->result.getContext(), op1.getExpr()));
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_not(this->result.getContext(), op1));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
+      z3::expr op1      = this->getTranslation(e.getChilds()[0]);
+      z3::expr op2      = this->getTranslation(e.getChilds()[1]);
+      Z3_ast ops[]      = {op1, op2};
       z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_or(this->result.getContext(), 2, ops));
 
       this->result.setExpr(newexpr);
@@ -436,24 +573,21 @@ namespace triton {
       triton::engines::symbolic::SymbolicExpression* refNode = this->symbolicEngine->getSymbolicExpressionFromId(e.getValue());
       if (refNode == nullptr)
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::ReferenceNode(): Reference node not found.");
-      Z3Result op1 = this->eval(*(refNode->getAst()));
-      this->result.setExpr(op1.getExpr());
+      this->result.setExpr(this->getTranslation(refNode->getAst()));
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::StringNode& e) {
       if (this->symbols.find(e.getValue()) == this->symbols.end())
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::StringNode(): Symbols not found.");
-      Z3Result op1 = this->eval(*(this->symbols[e.getValue()]));
-      this->result.setExpr(op1.getExpr());
+      this->result.setExpr(this->getTranslation(this->symbols[e.getValue()]));
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::SxNode& e) {
-      Z3Result ext        = this->eval(*e.getChilds()[0]);
-      Z3Result value      = this->eval(*e.getChilds()[1]);
-      triton::uint32 extv = static_cast<triton::uint32>(ext.getUintValue());
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_sign_ext(this->result.getContext(), extv, value.getExpr()));
+      triton::uint32 extv = this->getDecimalValue(e.getChilds()[0]);
+      z3::expr value      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_sign_ext(this->result.getContext(), extv, value));
 
       this->result.setExpr(newexpr);
     }
@@ -466,11 +600,11 @@ namespace triton {
       if (symVar == nullptr)
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::VariableNode(): Can't get the symbolic variable (nullptr).");
 
-      if (symVar->getSize() > QWORD_SIZE_BIT)
-        throw triton::exceptions::AstTranslations("TritonToZ3Ast::VariableNode(): Size above 64 bits is not supported yet.");
-
       /* If the conversion is used to evaluate a node, we concretize symbolic variables */
       if (this->isEval) {
+        if (symVar->getSize() > QWORD_SIZE_BIT)
+          throw triton::exceptions::AstTranslations("TritonToZ3Ast::VariableNode(): Size above 64 bits is not supported yet.");
+
         if (symVar->getKind() == triton::engines::symbolic::MEM) {
           triton::uint32 memSize   = symVar->getSize();
           triton::uint512 memValue = symVar->getConcreteValue();
@@ -497,10 +631,9 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::ZxNode& e) {
-      Z3Result ext        = this->eval(*e.getChilds()[0]);
-      Z3Result value      = this->eval(*e.getChilds()[1]);
-      triton::uint32 extv = static_cast<triton::uint32>(ext.getUintValue());
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_zero_ext(this->result.getContext(), extv, value.getExpr()));
+      triton::uint32 extv = this->getDecimalValue(e.getChilds()[0]);
+      z3::expr value      = this->getTranslation(e.getChilds()[1]);
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_zero_ext(this->result.getContext(), extv, value));
 
       this->result.setExpr(newexpr);
     }
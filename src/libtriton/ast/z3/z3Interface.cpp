@@ -16,10 +16,16 @@
 namespace triton {
   namespace ast {
 
-    Z3Interface::Z3Interface(triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
+    /* Number of memoized translations from which the memo is flushed */
+    static const triton::usize CACHE_THRESHOLD = 1 << 16;
+
+
+    Z3Interface::Z3Interface(triton::engines::symbolic::SymbolicEngine* symbolicEngine)
+      : translator(symbolicEngine, false) {
       if (symbolicEngine == nullptr)
         throw triton::exceptions::AstTranslations("Z3Interface::Z3Interface(): The symbolicEngine API cannot be null.");
       this->symbolicEngine = symbolicEngine;
+      this->astRevision    = this->symbolicEngine->getAstRevision();
     }
 
 
@@ -28,12 +34,20 @@ namespace triton {
 
 
     triton::ast::AbstractNode* Z3Interface::simplify(triton::ast::AbstractNode* node) const {
-      triton::ast::TritonToZ3Ast  z3Ast{this->symbolicEngine, false};
-      triton::ast::Z3ToTritonAst  tritonAst{this->symbolicEngine};
-      triton::ast::Z3Result       result = z3Ast.eval(*node);
+      triton::usize revision = this->symbolicEngine->getAstRevision();
+      triton::ast::Z3ToTritonAst tritonAst{this->symbolicEngine};
+
+      if (node == nullptr)
+        throw triton::exceptions::AstTranslations("Z3Interface::simplify(): node cannot be null.");
+
+      /* A symbolic expression has a new AST, memoized references may be outdated. The memo also keeps its nodes alive, thus it is bounded. */
+      if (revision != this->astRevision || this->translator.getNumberOfTranslations() > CACHE_THRESHOLD) {
+        this->translator.clearTranslations();
+        this->astRevision = revision;
+      }
 
       /* Simplify and convert back to Triton's AST */
-      z3::expr expr = result.getExpr().simplify();
+      z3::expr expr = this->translator.eval(*node).getExpr().simplify();
       tritonAst.setExpr(expr);
       node = tritonAst.convert();
 
@@ -45,8 +59,9 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::AstTranslations("Z3Interface::evaluate(): node cannot be null.");
 
+      /* Symbolic variables are concretized, the memo can't be kept between calls */
       triton::ast::TritonToZ3Ast z3ast{this->symbolicEngine};
-      triton::ast::Z3Result result = z3ast.eval(*node);
+      triton::ast::Z3Result& result = z3ast.eval(*node);
       triton::uint512 nbResult{result.getStringValue()};
 
       return nbResult;
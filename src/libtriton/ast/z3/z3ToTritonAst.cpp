@@ -6,6 +6,8 @@
 */
 
 #include <list>
+#include <utility>
+#include <vector>
 
 #include <triton/exceptions.hpp>
 #include <triton/z3ToTritonAst.hpp>
@@ -50,7 +52,49 @@ namespace triton {
 
 
     AbstractNode* Z3ToTritonAst::convert(void) {
-      return this->visit(this->expr);
+      std::vector<std::pair<z3::expr, bool>> worklist;
+      AbstractNode* node = nullptr;
+
+      /*
+       * Post-order walk of the DAG. Each Z3 node is converted once, the
+       * Triton's node is shared by all its parents.
+       */
+      this->translations.clear();
+      worklist.push_back(std::make_pair(this->expr, false));
+      while (!worklist.empty()) {
+        z3::expr current = worklist.back().first;
+
+        if (this->translations.find(Z3_get_ast_id(current.ctx(), current)) != this->translations.end()) {
+          worklist.pop_back();
+          continue;
+        }
+
+        if (worklist.back().second == false) {
+          worklist.back().second = true;
+          /* Arguments of uninterpreted functions are not converted (see visit()) */
+          if (current.is_app() && current.decl().decl_kind() != Z3_OP_UNINTERPRETED) {
+            for (triton::uint32 i = current.num_args(); i > 0; i--)
+              worklist.push_back(std::make_pair(current.arg(i - 1), false));
+          }
+          continue;
+        }
+
+        worklist.pop_back();
+        this->translations[Z3_get_ast_id(current.ctx(), current)] = this->visit(current);
+      }
+
+      node = this->getTranslation(this->expr);
+      this->translations.clear();
+
+      return node;
+    }
+
+
+    AbstractNode* Z3ToTritonAst::getTranslation(z3::expr const& expr) {
+      auto it = this->translations.find(Z3_get_ast_id(expr.ctx(), expr));
+      if (it == this->translations.end())
+        throw triton::exceptions::AstTranslations("Z3ToTritonAst::getTranslation(): The expression has not been converted.");
+      return it->second;
     }
 
 
@@ -73,41 +117,41 @@ namespace triton {
         case Z3_OP_EQ: {
           if (expr.num_args() != 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_EQ must contain two arguments.");
-          node = triton::ast::equal(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::equal(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           break;
         }
 
         case Z3_OP_DISTINCT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_DISTINCT must contain at least two arguments.");
-          node = triton::ast::distinct(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::distinct(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::distinct(node, this->visit(expr.arg(i)));
+            node = triton::ast::distinct(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_ITE: {
           if (expr.num_args() != 3)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ITE must contain three arguments.");
-          node = triton::ast::ite(this->visit(expr.arg(0)), this->visit(expr.arg(1)), this->visit(expr.arg(2)));
+          node = triton::ast::ite(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)), this->getTranslation(expr.arg(2)));
           break;
         }
 
         case Z3_OP_AND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_AND must contain at least two arguments.");
-          node = triton::ast::land(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::land(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::land(node, this->visit(expr.arg(i)));
+            node = triton::ast::land(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_OR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_OR must contain at least two arguments.");
-          node = triton::ast::lor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::lor(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::lor(node, this->visit(expr.arg(i)));
+            node = triton::ast::lor(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
@@ -115,12 +159,12 @@ namespace triton {
         case Z3_OP_NOT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_NOT must contain one argument.");
-          node = triton::ast::lnot(this->visit(expr.arg(0)));
+          node = triton::ast::lnot(this->getTranslation(expr.arg(0)));
           break;
         }
 
         case Z3_OP_BNUM: {
-          std::string stringValue = Z3_get_numeral_string(this->context, expr);
+          std::string stringValue = Z3_get_numeral_string(expr.ctx(), expr);
           triton::uint512 intValue{stringValue};
           node = triton::ast::bv(intValue, expr.get_sort().bv_size());
           break;
@@ -129,34 +173,34 @@ namespace triton {
         case Z3_OP_BNEG: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNEG must contain one argument.");
-          node = triton::ast::bvneg(this->visit(expr.arg(0)));
+          node = triton::ast::bvneg(this->getTranslation(expr.arg(0)));
           break;
         }
 
         case Z3_OP_BADD: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BADD must contain at least two arguments.");
-          node = triton::ast::bvadd(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvadd(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvadd(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvadd(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BSUB: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSUB must contain at least two arguments.");
-          node = triton::ast::bvsub(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsub(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsub(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsub(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BMUL: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BMUL must contain at least two arguments.");
-          node = triton::ast::bvmul(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvmul(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvmul(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvmul(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
@@ -164,9 +208,9 @@ namespace triton {
         case Z3_OP_BSDIV: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSDIV must contain at least two arguments.");
-          node = triton::ast::bvsdiv(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsdiv(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsdiv(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsdiv(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
@@ -174,9 +218,9 @@ namespace triton {
         case Z3_OP_BUDIV: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BUDIV must contain at least two arguments.");
-          node = triton::ast::bvudiv(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvudiv(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvudiv(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvudiv(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
@@ -184,9 +228,9 @@ namespace triton {
         case Z3_OP_BSREM: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSREM must contain at least two arguments.");
-          node = triton::ast::bvsrem(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsrem(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsrem(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsrem(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
@@ -194,9 +238,9 @@ namespace triton {
         case Z3_OP_BUREM: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BUREM must contain at least two arguments.");
-          node = triton::ast::bvurem(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvurem(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvurem(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvurem(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
@@ -204,142 +248,142 @@ namespace triton {
         case Z3_OP_BSMOD: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSMOD must contain at least two arguments.");
-          node = triton::ast::bvsmod(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsmod(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsmod(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsmod(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_ULEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ULEQ must contain at least two arguments.");
-          node = triton::ast::bvule(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvule(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvule(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvule(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_SLEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SLEQ must contain at least two arguments.");
-          node = triton::ast::bvsle(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsle(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsle(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsle(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_UGEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_UGEQ must contain at least two arguments.");
-          node = triton::ast::bvuge(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvuge(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvuge(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvuge(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_SGEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SGEQ must contain at least two arguments.");
-          node = triton::ast::bvsge(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsge(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsge(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsge(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_ULT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ULT must contain at least two arguments.");
-          node = triton::ast::bvult(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvult(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvult(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvult(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_SLT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SLT must contain at least two arguments.");
-          node = triton::ast::bvslt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvslt(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvslt(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvslt(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_UGT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_UGT must contain at least two arguments.");
-          node = triton::ast::bvugt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvugt(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvugt(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvugt(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_SGT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SGT must contain at least two arguments.");
-          node = triton::ast::bvsgt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvsgt(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsgt(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvsgt(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BAND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BAND must contain at least two arguments.");
-          node = triton::ast::bvand(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvand(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvand(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvand(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BOR must contain at least two arguments.");
-          node = triton::ast::bvor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvor(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvor(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvor(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BNOT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNOT must contain one argument.");
-          node = triton::ast::bvnot(this->visit(expr.arg(0)));
+          node = triton::ast::bvnot(this->getTranslation(expr.arg(0)));
           break;
         }
 
         case Z3_OP_BXOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BXOR must contain at least two arguments.");
-          node = triton::ast::bvxor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvxor(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvxor(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvxor(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BNAND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNAND must contain at least two arguments.");
-          node = triton::ast::bvnand(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvnand(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvnand(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvnand(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BNOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNOR must contain at least two arguments.");
-          node = triton::ast::bvnor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvnor(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvnor(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvnor(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BXNOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BXNOR must contain at least two arguments.");
-          node = triton::ast::bvxnor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvxnor(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvxnor(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvxnor(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
@@ -349,7 +393,7 @@ namespace triton {
 
           std::list<AbstractNode*> args;
           for (triton::uint32 i = 0; i < expr.num_args(); i++) {
-            args.push_back(this->visit(expr.arg(i)));
+            args.push_back(this->getTranslation(expr.arg(i)));
           }
 
           node = triton::ast::concat(args);
@@ -359,62 +403,62 @@ namespace triton {
         case Z3_OP_SIGN_EXT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SIGN_EXT must contain one argument.");
-          node = triton::ast::sx(expr.hi(), this->visit(expr.arg(0)));
+          node = triton::ast::sx(expr.hi(), this->getTranslation(expr.arg(0)));
           break;
         }
 
         case Z3_OP_ZERO_EXT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ZERO_EXT must contain one argument.");
-          node = triton::ast::zx(expr.hi(), this->visit(expr.arg(0)));
+          node = triton::ast::zx(expr.hi(), this->getTranslation(expr.arg(0)));
           break;
         }
 
         case Z3_OP_EXTRACT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_EXTRACT must contain one argument.");
-          node = triton::ast::extract(expr.hi(), expr.lo(), this->visit(expr.arg(0)));
+          node = triton::ast::extract(expr.hi(), expr.lo(), this->getTranslation(expr.arg(0)));
           break;
         }
 
         case Z3_OP_BSHL: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSHL must contain at least two arguments.");
-          node = triton::ast::bvshl(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvshl(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvshl(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvshl(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BLSHR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BLSHR must contain at least two arguments.");
-          node = triton::ast::bvlshr(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvlshr(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvlshr(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvlshr(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BASHR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BASHR must contain at least two arguments.");
-          node = triton::ast::bvashr(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = triton::ast::bvashr(this->getTranslation(expr.arg(0)), this->getTranslation(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvashr(node, this->visit(expr.arg(i)));
+            node = triton::ast::bvashr(node, this->getTranslation(expr.arg(i)));
           break;
         }
 
         case Z3_OP_ROTATE_LEFT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ROTATE_LEFT must contain one argument.");
-          node = triton::ast::bvrol(expr.hi(), this->visit(expr.arg(0)));
+          node = triton::ast::bvrol(expr.hi(), this->getTranslation(expr.arg(0)));
           break;
         }
 
         case Z3_OP_ROTATE_RIGHT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ROTATE_RIGHT must contain one argument.");
-          node = triton::ast::bvror(expr.hi(), this->visit(expr.arg(0)));
+          node = triton::ast::bvror(expr.hi(), this->getTranslation(expr.arg(0)));
           break;
         }
 
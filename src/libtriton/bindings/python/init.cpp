@@ -89,6 +89,18 @@ namespace triton {
         initElfNamespace(elfDict);
         PyObject* idElfDictClass = xPyClass_New(nullptr, elfDict, xPyString_FromString("ELF"));
 
+        /* Create the EMULATION namespace ============================================================ */
+
+        PyObject* emulationDict = xPyDict_New();
+        initEmulationNamespace(emulationDict);
+        PyObject* idEmulationDictClass = xPyClass_New(nullptr, emulationDict, xPyString_FromString("EMULATION"));
+
+        /* Create the LOADER namespace =============================================================== */
+
+        PyObject* loaderDict = xPyDict_New();
+        initLoaderNamespace(loaderDict);
+        PyObject* idLoaderDictClass = xPyClass_New(nullptr, loaderDict, xPyString_FromString("LOADER"));
+
         /* Create the OPCODE namespace =============================================================== */
 
         triton::bindings::python::opcodesDict = xPyDict_New();
@@ -150,6 +162,8 @@ namespace triton {
         PyModule_AddObject(triton::bindings::python::tritonModule, "CALLBACK",            idCallbackDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "CPUSIZE",             idCpuSizeClass);            /* Empty: filled on the fly */
         PyModule_AddObject(triton::bindings::python::tritonModule, "ELF",                 idElfDictClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "EMULATION",           idEmulationDictClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "LOADER",              idLoaderDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "MODE",                idModeClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "OPCODE",              idOpcodesClass);            /* Empty: filled on the fly */
         PyModule_AddObject(triton::bindings::python::tritonModule, "OPERAND",             idOperandClass);
@@ -15,6 +15,7 @@
 #include <triton/immediate.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/register.hpp>
+#include <triton/traceWriter.hpp>
 
 
 
@@ -78,6 +79,9 @@ If you want to use the libTriton without Python bindings, recompile the project
 - <b>void addCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Adds a callback at specific internal points. Your callback will be called each time the point is reached.
 
+- <b>void addSolverConstraint(\ref py_AstNode_page node)</b><br>
+Adds a constraint to the current scope of the solver session. It holds for all next queries (getModel(), getModels(), isSat()) until its scope is popped.
+
 - <b>void assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
 The symbolic expression (`symExpr`) must be aligned to the memory access.
@@ -142,11 +146,23 @@ Returns the new symbolic volatile expression and links this expression to the in
 - <b>void disassembly(\ref py_Instruction_page inst)</b><br>
 Disassembles the instruction and setup operands. You must define an architecture before.
 
+- <b>void discardSnapshot(void)</b><br>
+Discards the snapshot taken by takeSnapshot(). The pages saved since the snapshot are released.
+
+- <b>\ref py_EMULATION_page emulate(integer startAddress, [integer, ...] breakpoints=[], integer maxInstructions=0, dict hooks={})</b><br>
+Emulates natively the code from `startAddress`: the opcodes are fetched from the concrete memory, processed and the concrete program
+counter is followed. Returns the reason why the emulation stopped: after `maxInstructions` instructions (0 means no limit), after a
+system call, before a breakpoint or an unsupported instruction, on an unmapped program counter or when a hook returns `False`.
+The `hooks` dictionary maps addresses to Python callbacks which are called with the address before the execution of the
+instruction, a hook may modify the program counter to skip it. Breakpoints and hooks are not applied on `startAddress`, thus
+an emulation can be resumed where it stopped.
+
 - <b>void enableMode(\ref py_MODE_page mode, bool flag)</b><br>
 Enables or disables a specific mode.
 
 - <b>void enableSymbolicEngine(bool flag)</b><br>
-Enables or disables the symbolic execution engine.
+Enables or disables the symbolic execution engine. Without symbolic engine, the instructions supported by the concrete
+fast path (see MODE.CONCRETE_FAST_PATH in \ref py_MODE_page) only spread the taint and do not build any AST.
 
 - <b>void enableTaintEngine(bool flag)</b><br>
 Enables or disables the taint engine.
@@ -154,14 +170,24 @@ Enables or disables the taint engine.
 - <b>integer evaluateAstViaZ3(\ref py_AstNode_page node)</b><br>
 Evaluates an AST via Z3 and returns the symbolic value.
 
+- <b>void flushDisassemblyCache(void)</b><br>
+Removes all decoded instructions from the disassembly cache and resets its statistics.
+
+- <b>void flushSolverCache(void)</b><br>
+Removes all cached queries and models from the solver cache.
+
 - <b>[\ref py_Register_page, ...] getAllRegisters(void)</b><br>
 Returns the list of all registers. Each item of this list is a \ref py_Register_page.
 
 - <b>\ref py_ARCH_page getArchitecture(void)</b><br>
 Returns the current architecture used.
 
+- <b>dict getAstAllocatorStats(void)</b><br>
+Returns a dictionary which contains the state of the allocator of AST nodes: `bytes`, `slabs` and `usedBlocks`. The allocator is shared by all instances.
+
 - <b>dict getAstDictionariesStats(void)</b><br>
-Returns a dictionary which contains all information about number of nodes allocated via AST dictionaries.
+Returns a dictionary which contains all information about number of nodes allocated via AST dictionaries. It also reports the state of the
+hash-consing table: `capacity`, `loadFactor` (in percent), `maxProbeLength` and `totalProbeLength`.
 
 - <b>\ref py_AstNode_page getAstFromId(integer symExprId)</b><br>
 Returns the partial AST from a symbolic expression id.
@@ -181,6 +207,9 @@ Returns the concrete value of memory cells.
 - <b>integer getConcreteRegisterValue(\ref py_REG_page reg)</b><br>
 Returns the concrete value of a register.
 
+- <b>dict getDisassemblyCacheStats(void)</b><br>
+Returns a dictionary which contains the statistics of the disassembly cache (`entries`, `hits`, `misses` and `hitRate` as percentage).
+
 - <b>\ref py_AstNode_page getFullAst(\ref py_AstNode_page node)</b><br>
 Returns the full AST without SSA form from a given root node.
 
@@ -193,6 +222,16 @@ Computes and returns a model as a dictionary of {integer symVarId : \ref py_Solv
 - <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit)</b><br>
 Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
 
+- <b>[dict, ...] getNegatedBranchModels([integer, ...] indexes, integer threads, integer timeout)</b><br>
+Computes a model per negated branch of the path constraints, in the order of `indexes` (all multiple branches path constraints which have a branch
+not taken if empty or omitted).
+The query of a branch is the conjunction of the previous path constraints and of the branch which has not been taken. Queries are solved by `threads`
+workers (0 or omitted for one per core) with a time limit of `timeout` milliseconds per query (0 or omitted for none). An unsat query (or a query out
+of time) has an empty dictionary as model.
+
+- <b>integer getNumberOfSolverScopes(void)</b><br>
+Returns the number of scopes pushed in the solver session.
+
 - <b>[\ref py_Register_page, ...] getParentRegisters(void)</b><br>
 Returns the list of parent registers. Each item of this list is a \ref py_Register_page.
 
@@ -208,6 +247,9 @@ Returns the max size (in bit) of the CPU register (GPR).
 - <b>integer getRegisterSize(void)</b><br>
 Returns the max size (in byte) of the CPU register (GPR).
 
+- <b>dict getSolverCacheStats(void)</b><br>
+Returns a dictionary which contains the statistics of the solver cache (`entries`, `hits`, `counterexampleHits`, `misses` and `hitRate` as percentage).
+
 - <b>\ref py_SymbolicExpression_page getSymbolicExpressionFromId(intger symExprId)</b><br>
 Returns the symbolic expression corresponding to an id.
 
@@ -247,6 +289,9 @@ Returns all symbolic variable as a dictionary of {integer SymVarId : \ref py_Sym
 - <b>[intger, ...] getTaintedMemory(void)</b><br>
 Returns the list of all tainted addresses.
 
+- <b>dict getTaintedMemoryRanges(integer baseAddr=None, integer size=None)</b><br>
+Returns the tainted spans of the memory as a dictionary `{start address: size}`. If `baseAddr` and `size` are defined, only spans which intersect the range `[baseAddr:size]` are returned, clipped to this range.
+
 - <b>[\ref py_Register_page, ...] getTaintedRegisters(void)</b><br>
 Returns the list of all tainted registers.
 
@@ -260,7 +305,7 @@ Returns true if the architecture is valid.
 Returns true if the register id is a flag.
 
 - <b>bool isMemoryMapped(integer baseAddr, integer size=1)</b><br>
-Returns true if the range `[baseAddr:size]` is mapped into the internal memory representation.
+Returns true if all pages covering the range `[baseAddr:size]` are mapped into the internal memory representation. The memory is mapped per page of 4 KiB.
 
 - <b>bool isMemorySymbolized(integer addr)</b><br>
 Returns true if the memory cell expression contains a symbolic variable.
@@ -289,6 +334,12 @@ Returns true if the register is tainted.
 - <b>bool isRegisterValid(\ref py_REG_page reg)</b><br>
 Returns true if the register id is valid.
 
+- <b>bool isSat(\ref py_AstNode_page node=None)</b><br>
+Returns true if the constraints of the solver session and the `node` (if any) are satisfiable.
+
+- <b>bool isSnapshotEnabled(void)</b><br>
+Returns true if a snapshot is taken.
+
 - <b>bool isSymbolicEngineEnabled(void)</b><br>
 Returns true if the symbolic execution engine is enabled.
 
@@ -298,24 +349,53 @@ Returns true if the symbolic expression id exists.
 - <b>bool isTaintEngineEnabled(void)</b><br>
 Returns true if the taint engine is enabled.
 
+- <b>void loadBinary(\ref py_Elf_page binary)</b><br>
+- <b>void loadBinary(\ref py_Pe_page binary)</b><br>
+Loads the memory areas of a binary into the concrete memory. The pages share the binary file until their first write
+and the zero-filled parts (e.g. `.bss`) are only allocated on their first write.
+
 - <b>\ref py_SymbolicExpression_page newSymbolicExpression(\ref py_AstNode_page node, string comment)</b><br>
 Returns a new symbolic expression. Note that if there are simplification passes recorded, simplifications will be applied.
 
 - <b>\ref py_SymbolicVariable_page newSymbolicVariable(intger varSize, string comment)</b><br>
 Returns a new symbolic variable.
 
+- <b>void popSolverScope(void)</b><br>
+Removes the constraints added to the solver session since the last pushSolverScope().
+
 - <b>bool processing(\ref py_Instruction_page inst)</b><br>
 Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
 
+- <b>void pushSolverScope(void)</b><br>
+Creates a new scope of constraints in the solver session.
+
 - <b>void removeAllCallbacks(void)</b><br>
 Removes all recorded callbacks.
 
 - <b>void removeCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Removes a recorded callback.
 
+- <b>void removeSymbolicExpression(integer symExprId)</b><br>
+Removes a symbolic expression. The register or the memory assigned to it is concretized. With the `MODE.LAZY_FLAGS`
+mode, the flags whose deferred expression refers to it are concretized too.
+
+- <b>integer replayTrace(string path, dict hooks={})</b><br>
+Replays a binary trace recorded by writeTrace() and returns the number of processed instructions. The whole replay
+is done natively, the `hooks` dictionary maps addresses to Python callbacks which are called with the \ref py_Instruction_page
+just processed at these addresses. A callback returning `False` stops the replay. If the architecture is not defined, the
+architecture of the trace is used.
+
 - <b>void resetEngines(void)</b><br>
 Resets everything.
 
+- <b>void resetSolverSession(void)</b><br>
+Removes all scopes and constraints of the solver session.
+
+- <b>void restoreSnapshot(void)</b><br>
+Restores the registers, the memory, the taint state and the symbolic state as they were when the snapshot has been taken.
+The snapshot is kept, thus it can be restored several times. Note that the symbolic expressions created since the snapshot
+are deleted (the \ref py_SymbolicExpression_page objects which point to them must not be used anymore).
+
 - <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -383,6 +463,9 @@ Taints an address. Returns true if the address is tainted.
 - <b>bool taintMemory(\ref py_MemoryAccess_page mem)</b><br>
 Taints a memory. Returns true if the memory is tainted.
 
+- <b>bool taintMemoryArea(integer baseAddr, integer size)</b><br>
+Taints the range `[baseAddr:size]`. Returns true if the range is tainted.
+
 - <b>bool taintRegister(\ref py_REG_page reg)</b><br>
 Taints a register. Returns true if the register is tainted.
 
@@ -408,8 +491,13 @@ tainted. Returns true if `regDst` is tainted.
 Taints `regDst` from `regSrc` with an union - `regDst` is tainted if `regDst` or `regSrc` are
 tainted. Returns true if `regDst` is tainted.
 
+- <b>void takeSnapshot(void)</b><br>
+Takes a snapshot of the registers, the memory, the taint state and the symbolic state (symbolic registers, symbolic memory and
+path constraints). The snapshot is copy-on-write: a memory page is only saved on its first write, thus taking a snapshot is cheap and
+restoring it only costs the pages modified since. A previous snapshot is discarded.
+
 - <b>void unmapMemory(integer baseAddr, integer size=1)</b><br>
-Removes the range `[baseAddr:size]` from the internal memory representation.
+Removes all pages covering the range `[baseAddr:size]` from the internal memory representation.
 
 - <b>bool untaintMemory(intger addr)</b><br>
 Untaints an address. Returns true if the address is still tainted.
@@ -417,6 +505,9 @@ Untaints an address. Returns true if the address is still tainted.
 - <b>bool untaintMemory(\ref py_MemoryAccess_page mem)</b><br>
 Untaints a memory. Returns true if the memory is still tainted.
 
+- <b>bool untaintMemoryArea(integer baseAddr, integer size)</b><br>
+Untaints the range `[baseAddr:size]`. Returns true if the range is still tainted.
+
 - <b>bool untaintRegister(\ref py_REG_page reg)</b><br>
 Untaints a register. Returns true if the register is still tainted.
 
@@ -429,6 +520,8 @@ Untaints a register. Returns true if the register is still tainted.
 - \ref py_CALLBACK_page
 - \ref py_CPUSIZE_page
 - \ref py_ELF_page
+- \ref py_EMULATION_page
+- \ref py_LOADER_page
 - \ref py_MODE_page
 - \ref py_OPCODE_page
 - \ref py_OPERAND_page
@@ -569,6 +662,12 @@ Creates a snaphost at this program point.
 - \ref py_INSERT_POINT_page
 - \ref py_STANDARD_page
 
+- <b>void writeTrace(string path, [\ref py_Instruction_page, ...] instructions)</b><br>
+Records a list of instructions into a binary trace which can be replayed by replayTrace(). The address, the opcodes and the
+concrete context (see the `updateContext()` method of \ref py_Instruction_page) of each instruction are recorded. The context is
+the state before the execution. For a processed instruction, the memory it has loaded is recorded (not its stores). Registers are
+only recorded when their value changes.
+
 */
 
 
@@ -577,13 +676,25 @@ namespace triton {
   namespace bindings {
     namespace python {
 
-      static PyObject* triton_Elf(PyObject* self, PyObject* path) {
-        /* Check if the first arg is a integer */
+      static PyObject* triton_Elf(PyObject* self, PyObject* args) {
+        PyObject* path = nullptr;
+        PyObject* mode = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &path, &mode);
+
+        /* Check if the first arg is a string */
         if (path == nullptr || !PyString_Check(path))
           return PyErr_Format(PyExc_TypeError, "Elf(): Expects a string as first argument.");
 
+        /* Check if the second arg is a LOADER */
+        if (mode != nullptr && (!PyLong_Check(mode) && !PyInt_Check(mode)))
+          return PyErr_Format(PyExc_TypeError, "Elf(): Expects a LOADER as second argument.");
+
         try {
-          return PyElf(PyString_AsString(path));
+          if (mode == nullptr)
+            return PyElf(PyString_AsString(path));
+          return PyElf(PyString_AsString(path), static_cast<triton::format::loader_e>(PyLong_AsUint32(mode)));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -837,6 +948,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_addSolverConstraint(PyObject* self, PyObject* node) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addSolverConstraint(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "addSolverConstraint(): Expects a AstNode as argument.");
+
+        try {
+          triton::api.addSolverConstraint(PyAstNode_AsAstNode(node));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_assignSymbolicExpressionToMemory(PyObject* self, PyObject* args) {
         PyObject* se  = nullptr;
         PyObject* mem = nullptr;
@@ -1332,6 +1463,103 @@ namespace triton {
       }
 
 
+      static PyObject* triton_discardSnapshot(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "discardSnapshot(): Architecture is not defined.");
+
+        try {
+          triton::api.discardSnapshot();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_emulate(PyObject* self, PyObject* args) {
+        std::map<triton::uint64, triton::arch::emulationHookCallback> hooks;
+        std::set<triton::uint64> breakpoints;
+        PyObject* startAddress    = nullptr;
+        PyObject* pyBreakpoints   = nullptr;
+        PyObject* maxInstructions = nullptr;
+        PyObject* pyHooks         = nullptr;
+        PyObject* key             = nullptr;
+        PyObject* function        = nullptr;
+        Py_ssize_t pos            = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOO", &startAddress, &pyBreakpoints, &maxInstructions, &pyHooks);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "emulate(): Architecture is not defined.");
+
+        if (startAddress == nullptr || (!PyLong_Check(startAddress) && !PyInt_Check(startAddress)))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects an integer as first argument.");
+
+        if (pyBreakpoints != nullptr && pyBreakpoints != Py_None && !PyList_Check(pyBreakpoints))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects a list of integers as second argument.");
+
+        if (maxInstructions != nullptr && maxInstructions != Py_None && !PyLong_Check(maxInstructions) && !PyInt_Check(maxInstructions))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects an integer as third argument.");
+
+        if (pyHooks != nullptr && pyHooks != Py_None && !PyDict_Check(pyHooks))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects a dictionary as fourth argument.");
+
+        if (pyBreakpoints != nullptr && pyBreakpoints != Py_None) {
+          for (Py_ssize_t i = 0; i < PyList_Size(pyBreakpoints); i++) {
+            PyObject* item = PyList_GetItem(pyBreakpoints, i);
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              return PyErr_Format(PyExc_TypeError, "emulate(): Expects a list of integers as second argument.");
+            breakpoints.insert(PyLong_AsUint64(item));
+          }
+        }
+
+        if (pyHooks != nullptr && pyHooks != Py_None) {
+          while (PyDict_Next(pyHooks, &pos, &key, &function)) {
+            if ((!PyLong_Check(key) && !PyInt_Check(key)) || !PyCallable_Check(function))
+              return PyErr_Format(PyExc_TypeError, "emulate(): Expects a dictionary of {integer: function}.");
+
+            hooks[PyLong_AsUint64(key)] = [function](triton::uint64 address) {
+              /********* Lambda *********/
+              PyObject* args = triton::bindings::python::xPyTuple_New(1);
+              PyTuple_SetItem(args, 0, triton::bindings::python::PyLong_FromUint64(address));
+
+              /* Call the hook */
+              PyObject* ret = PyObject_CallObject(function, args);
+              Py_DECREF(args);
+
+              /* Check the call */
+              if (ret == nullptr) {
+                PyErr_Print();
+                throw triton::exceptions::Callbacks("API::emulate(): Fail to call the python hook.");
+              }
+
+              /* Only an explicit False stops the emulation */
+              bool next = (ret != Py_False);
+              Py_DECREF(ret);
+              return next;
+              /********* End of lambda *********/
+            };
+          }
+        }
+
+        try {
+          triton::usize max = 0;
+          if (maxInstructions != nullptr && maxInstructions != Py_None)
+            max = PyLong_AsUsize(maxInstructions);
+          return PyLong_FromUint32(triton::api.emulate(PyLong_AsUint64(startAddress), breakpoints, max, hooks));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_enableMode(PyObject* self, PyObject* args) {
         PyObject* mode = nullptr;
         PyObject* flag = nullptr;
@@ -1424,6 +1652,40 @@ namespace triton {
       }
 
 
+      static PyObject* triton_flushDisassemblyCache(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "flushDisassemblyCache(): Architecture is not defined.");
+
+        try {
+          triton::api.flushDisassemblyCache();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_flushSolverCache(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "flushSolverCache(): Architecture is not defined.");
+
+        try {
+          triton::api.flushSolverCache();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_getAllRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
@@ -1452,6 +1714,24 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getAstAllocatorStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        try {
+          std::map<std::string, triton::usize> stats = triton::api.getAstAllocatorStats();
+
+          ret = xPyDict_New();
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getAstDictionariesStats(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
@@ -1568,6 +1848,28 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getDisassemblyCacheStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getDisassemblyCacheStats(): Architecture is not defined.");
+
+        try {
+          std::map<std::string, triton::usize> stats = triton::api.getDisassemblyCacheStats();
+
+          ret = xPyDict_New();
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getFullAst(PyObject* self, PyObject* node) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1669,6 +1971,73 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getNegatedBranchModels(PyObject* self, PyObject* args) {
+        std::vector<triton::usize> indexes;
+        PyObject* ret       = nullptr;
+        PyObject* pyIndexes = nullptr;
+        PyObject* threads   = nullptr;
+        PyObject* timeout   = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &pyIndexes, &threads, &timeout);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getNegatedBranchModels(): Architecture is not defined.");
+
+        if (pyIndexes != nullptr && pyIndexes != Py_None && !PyList_Check(pyIndexes))
+          return PyErr_Format(PyExc_TypeError, "getNegatedBranchModels(): Expects a list of integers as first argument.");
+
+        if (threads != nullptr && (!PyLong_Check(threads) && !PyInt_Check(threads)))
+          return PyErr_Format(PyExc_TypeError, "getNegatedBranchModels(): Expects an integer as second argument.");
+
+        if (timeout != nullptr && (!PyLong_Check(timeout) && !PyInt_Check(timeout)))
+          return PyErr_Format(PyExc_TypeError, "getNegatedBranchModels(): Expects an integer as third argument.");
+
+        if (pyIndexes != nullptr && pyIndexes != Py_None) {
+          for (Py_ssize_t i = 0; i < PyList_Size(pyIndexes); i++) {
+            PyObject* item = PyList_GetItem(pyIndexes, i);
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              return PyErr_Format(PyExc_TypeError, "getNegatedBranchModels(): Each index must be an integer.");
+            indexes.push_back(PyLong_AsUsize(item));
+          }
+        }
+
+        try {
+          auto models = triton::api.getNegatedBranchModels(indexes,
+                                                           (threads != nullptr) ? PyLong_AsUint32(threads) : 0,
+                                                           (timeout != nullptr) ? PyLong_AsUint32(timeout) : 0);
+
+          ret = xPyList_New(models.size());
+          for (triton::usize index = 0; index < models.size(); index++) {
+            PyObject* mdict = xPyDict_New();
+            for (auto it = models[index].begin(); it != models[index].end(); it++)
+              PyDict_SetItem(mdict, PyLong_FromUint32(it->first), PySolverModel(it->second));
+            PyList_SetItem(ret, index, mdict);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getNumberOfSolverScopes(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getNumberOfSolverScopes(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::api.getNumberOfSolverScopes());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_getParentRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
@@ -1739,6 +2108,28 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getSolverCacheStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSolverCacheStats(): Architecture is not defined.");
+
+        try {
+          std::map<std::string, triton::usize> stats = triton::api.getSolverCacheStats();
+
+          ret = xPyDict_New();
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1978,6 +2369,44 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getTaintedMemoryRanges(PyObject* self, PyObject* args) {
+        PyObject* baseAddr = nullptr;
+        PyObject* size     = nullptr;
+        PyObject* ret      = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getTaintedMemoryRanges(): Architecture is not defined.");
+
+        if (baseAddr != nullptr && !PyLong_Check(baseAddr) && !PyInt_Check(baseAddr))
+          return PyErr_Format(PyExc_TypeError, "getTaintedMemoryRanges(): Expects a base address (integer) as first argument.");
+
+        if ((baseAddr == nullptr) != (size == nullptr) || (size != nullptr && !PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "getTaintedMemoryRanges(): Expects a size (integer) as second argument.");
+
+        try {
+          std::map<triton::uint64, triton::usize> ranges;
+
+          if (baseAddr != nullptr)
+            ranges = triton::api.getTaintedMemoryRanges(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size));
+          else
+            ranges = triton::api.getTaintedMemoryRanges();
+
+          ret = xPyDict_New();
+          for (auto it = ranges.begin(); it != ranges.end(); it++)
+            PyDict_SetItem(ret, PyLong_FromUint64(it->first), PyLong_FromUsize(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getTaintedRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
         triton::usize size = 0, index = 0;
@@ -2184,6 +2613,40 @@ namespace triton {
       }
 
 
+      static PyObject* triton_isSat(PyObject* self, PyObject* args) {
+        PyObject* node = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|O", &node);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isSat(): Architecture is not defined.");
+
+        if (node != nullptr && node != Py_None && !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "isSat(): Expects a AstNode as argument.");
+
+        try {
+          if (triton::api.isSat((node != nullptr && node != Py_None) ? PyAstNode_AsAstNode(node) : nullptr) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_isSnapshotEnabled(PyObject* self, PyObject* noarg) {
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isSnapshotEnabled(): Architecture is not defined.");
+
+        if (triton::api.isSnapshotEnabled() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
       static PyObject* triton_isSymbolicEngineEnabled(PyObject* self, PyObject* noarg) {
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "isSymbolicEngineEnabled(): Architecture is not defined.");
@@ -2230,6 +2693,29 @@ namespace triton {
       }
 
 
+      static PyObject* triton_loadBinary(PyObject* self, PyObject* binary) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "loadBinary(): Architecture is not defined.");
+
+        if (binary == nullptr || (!PyElf_Check(binary) && !PyPe_Check(binary)))
+          return PyErr_Format(PyExc_TypeError, "loadBinary(): Expects an Elf or a Pe as argument.");
+
+        try {
+          if (PyElf_Check(binary))
+            triton::api.loadBinary(*PyElf_AsElf(binary));
+          else
+            triton::api.loadBinary(*PyPe_AsPe(binary));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_newSymbolicExpression(PyObject* self, PyObject* args) {
         PyObject* node          = nullptr;
         PyObject* comment       = nullptr;
@@ -2290,6 +2776,23 @@ namespace triton {
       }
 
 
+      static PyObject* triton_popSolverScope(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "popSolverScope(): Architecture is not defined.");
+
+        try {
+          triton::api.popSolverScope();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_processing(PyObject* self, PyObject* inst) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2309,6 +2812,23 @@ namespace triton {
       }
 
 
+      static PyObject* triton_pushSolverScope(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "pushSolverScope(): Architecture is not defined.");
+
+        try {
+          triton::api.pushSolverScope();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_removeAllCallbacks(PyObject* self, PyObject* noarg) {
         try {
           triton::api.removeAllCallbacks();
@@ -2363,6 +2883,81 @@ namespace triton {
       }
 
 
+      static PyObject* triton_removeSymbolicExpression(PyObject* self, PyObject* symExprId) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "removeSymbolicExpression(): Architecture is not defined.");
+
+        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "removeSymbolicExpression(): Expects an integer as argument.");
+
+        try {
+          triton::api.removeSymbolicExpression(PyLong_AsUsize(symExprId));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_replayTrace(PyObject* self, PyObject* args) {
+        std::map<triton::uint64, triton::format::trace::replayHookCallback> hooks;
+        PyObject* path          = nullptr;
+        PyObject* pyHooks       = nullptr;
+        PyObject* key           = nullptr;
+        PyObject* function      = nullptr;
+        Py_ssize_t pos          = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &path, &pyHooks);
+
+        if (path == nullptr || !PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "replayTrace(): Expects a string as first argument.");
+
+        if (pyHooks != nullptr && pyHooks != Py_None && !PyDict_Check(pyHooks))
+          return PyErr_Format(PyExc_TypeError, "replayTrace(): Expects a dictionary as second argument.");
+
+        if (pyHooks != nullptr && pyHooks != Py_None) {
+          while (PyDict_Next(pyHooks, &pos, &key, &function)) {
+            if ((!PyLong_Check(key) && !PyInt_Check(key)) || !PyCallable_Check(function))
+              return PyErr_Format(PyExc_TypeError, "replayTrace(): Expects a dictionary of {integer: function}.");
+
+            hooks[PyLong_AsUint64(key)] = [function](triton::arch::Instruction& inst) {
+              /********* Lambda *********/
+              PyObject* args = triton::bindings::python::xPyTuple_New(1);
+              PyTuple_SetItem(args, 0, triton::bindings::python::PyInstruction(inst));
+
+              /* Call the hook */
+              PyObject* ret = PyObject_CallObject(function, args);
+              Py_DECREF(args);
+
+              /* Check the call */
+              if (ret == nullptr) {
+                PyErr_Print();
+                throw triton::exceptions::Callbacks("API::replayTrace(): Fail to call the python hook.");
+              }
+
+              /* Only an explicit False stops the replay */
+              bool next = (ret != Py_False);
+              Py_DECREF(ret);
+              return next;
+              /********* End of lambda *********/
+            };
+          }
+        }
+
+        try {
+          return PyLong_FromUsize(triton::api.replayTrace(PyString_AsString(path), hooks));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_resetEngines(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2380,6 +2975,40 @@ namespace triton {
       }
 
 
+      static PyObject* triton_resetSolverSession(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "resetSolverSession(): Architecture is not defined.");
+
+        try {
+          triton::api.resetSolverSession();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_restoreSnapshot(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "restoreSnapshot(): Architecture is not defined.");
+
+        try {
+          triton::api.restoreSnapshot();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as argument.");
@@ -2851,6 +3480,34 @@ namespace triton {
       }
 
 
+      static PyObject* triton_taintMemoryArea(PyObject* self, PyObject* args) {
+        PyObject* baseAddr = nullptr;
+        PyObject* size     = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "taintMemoryArea(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryArea(): Expects a base address (integer) as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryArea(): Expects a size (integer) as second argument.");
+
+        try {
+          if (triton::api.taintMemoryArea(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_taintRegister(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -3020,6 +3677,23 @@ namespace triton {
       }
 
 
+      static PyObject* triton_takeSnapshot(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "takeSnapshot(): Architecture is not defined.");
+
+        try {
+          triton::api.takeSnapshot();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_unmapMemory(PyObject* self, PyObject* args) {
         PyObject* baseAddr        = nullptr;
         PyObject* size            = nullptr;
@@ -3080,6 +3754,34 @@ namespace triton {
       }
 
 
+      static PyObject* triton_untaintMemoryArea(PyObject* self, PyObject* args) {
+        PyObject* baseAddr = nullptr;
+        PyObject* size     = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryArea(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryArea(): Expects a base address (integer) as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryArea(): Expects a size (integer) as second argument.");
+
+        try {
+          if (triton::api.untaintMemoryArea(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_untaintRegister(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -3099,14 +3801,51 @@ namespace triton {
       }
 
 
+      static PyObject* triton_writeTrace(PyObject* self, PyObject* args) {
+        PyObject* path          = nullptr;
+        PyObject* instructions  = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &path, &instructions);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "writeTrace(): Architecture is not defined.");
+
+        if (path == nullptr || !PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "writeTrace(): Expects a string as first argument.");
+
+        if (instructions == nullptr || !PyList_Check(instructions))
+          return PyErr_Format(PyExc_TypeError, "writeTrace(): Expects a list of Instruction as second argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(instructions); i++) {
+          if (!PyInstruction_Check(PyList_GetItem(instructions, i)))
+            return PyErr_Format(PyExc_TypeError, "writeTrace(): Expects a list of Instruction as second argument.");
+        }
+
+        try {
+          triton::format::trace::TraceWriter trace(PyString_AsString(path), triton::api.getArchitecture());
+          for (Py_ssize_t i = 0; i < PyList_Size(instructions); i++)
+            trace.addInstruction(*PyInstruction_AsInstruction(PyList_GetItem(instructions, i)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       PyMethodDef tritonCallbacks[] = {
-        {"Elf",                                 (PyCFunction)triton_Elf,                                    METH_O,             ""},
+        {"Elf",                                 (PyCFunction)triton_Elf,                                    METH_VARARGS,       ""},
         {"Immediate",                           (PyCFunction)triton_Immediate,                              METH_VARARGS,       ""},
         {"Instruction",                         (PyCFunction)triton_Instruction,                            METH_VARARGS,       ""},
         {"MemoryAccess",                        (PyCFunction)triton_MemoryAccess,                           METH_VARARGS,       ""},
         {"Pe",                                  (PyCFunction)triton_Pe,                                     METH_O,             ""},
         {"Register",                            (PyCFunction)triton_Register,                               METH_VARARGS,       ""},
         {"addCallback",                         (PyCFunction)triton_addCallback,                            METH_VARARGS,       ""},
+        {"addSolverConstraint",                 (PyCFunction)triton_addSolverConstraint,                    METH_O,             ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)triton_assignSymbolicExpressionToMemory,       METH_VARARGS,       ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)triton_assignSymbolicExpressionToRegister,     METH_VARARGS,       ""},
         {"buildSemantics",                      (PyCFunction)triton_buildSemantics,                         METH_O,             ""},
@@ -3126,27 +3865,36 @@ namespace triton {
         {"createSymbolicRegisterExpression",    (PyCFunction)triton_createSymbolicRegisterExpression,       METH_VARARGS,       ""},
         {"createSymbolicVolatileExpression",    (PyCFunction)triton_createSymbolicVolatileExpression,       METH_VARARGS,       ""},
         {"disassembly",                         (PyCFunction)triton_disassembly,                            METH_O,             ""},
+        {"discardSnapshot",                     (PyCFunction)triton_discardSnapshot,                        METH_NOARGS,        ""},
+        {"emulate",                             (PyCFunction)triton_emulate,                                METH_VARARGS,       ""},
         {"enableMode",                          (PyCFunction)triton_enableMode,                             METH_VARARGS,       ""},
         {"enableSymbolicEngine",                (PyCFunction)triton_enableSymbolicEngine,                   METH_O,             ""},
         {"enableTaintEngine",                   (PyCFunction)triton_enableTaintEngine,                      METH_O,             ""},
         {"evaluateAstViaZ3",                    (PyCFunction)triton_evaluateAstViaZ3,                       METH_O,             ""},
+        {"flushDisassemblyCache",               (PyCFunction)triton_flushDisassemblyCache,                  METH_NOARGS,        ""},
+        {"flushSolverCache",                    (PyCFunction)triton_flushSolverCache,                       METH_NOARGS,        ""},
         {"getAllRegisters",                     (PyCFunction)triton_getAllRegisters,                        METH_NOARGS,        ""},
         {"getArchitecture",                     (PyCFunction)triton_getArchitecture,                        METH_NOARGS,        ""},
+        {"getAstAllocatorStats",                (PyCFunction)triton_getAstAllocatorStats,                   METH_NOARGS,        ""},
         {"getAstDictionariesStats",             (PyCFunction)triton_getAstDictionariesStats,                METH_NOARGS,        ""},
         {"getAstFromId",                        (PyCFunction)triton_getAstFromId,                           METH_O,             ""},
         {"getAstRepresentationMode",            (PyCFunction)triton_getAstRepresentationMode,               METH_NOARGS,        ""},
         {"getConcreteMemoryAreaValue",          (PyCFunction)triton_getConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"getConcreteMemoryValue",              (PyCFunction)triton_getConcreteMemoryValue,                 METH_O,             ""},
         {"getConcreteRegisterValue",            (PyCFunction)triton_getConcreteRegisterValue,               METH_O,             ""},
+        {"getDisassemblyCacheStats",            (PyCFunction)triton_getDisassemblyCacheStats,               METH_NOARGS,        ""},
         {"getFullAst",                          (PyCFunction)triton_getFullAst,                             METH_O,             ""},
         {"getFullAstFromId",                    (PyCFunction)triton_getFullAstFromId,                       METH_O,             ""},
         {"getModel",                            (PyCFunction)triton_getModel,                               METH_O,             ""},
         {"getModels",                           (PyCFunction)triton_getModels,                              METH_VARARGS,       ""},
+        {"getNegatedBranchModels",              (PyCFunction)triton_getNegatedBranchModels,                 METH_VARARGS,       ""},
+        {"getNumberOfSolverScopes",             (PyCFunction)triton_getNumberOfSolverScopes,                METH_NOARGS,        ""},
         {"getParentRegisters",                  (PyCFunction)triton_getParentRegisters,                     METH_NOARGS,        ""},
         {"getPathConstraints",                  (PyCFunction)triton_getPathConstraints,                     METH_NOARGS,        ""},
         {"getPathConstraintsAst",               (PyCFunction)triton_getPathConstraintsAst,                  METH_NOARGS,        ""},
         {"getRegisterBitSize",                  (PyCFunction)triton_getRegisterBitSize,                     METH_NOARGS,        ""},
         {"getRegisterSize",                     (PyCFunction)triton_getRegisterSize,                        METH_NOARGS,        ""},
+        {"getSolverCacheStats",                 (PyCFunction)triton_getSolverCacheStats,                    METH_NOARGS,        ""},
         {"getSymbolicExpressionFromId",         (PyCFunction)triton_getSymbolicExpressionFromId,            METH_O,             ""},
         {"getSymbolicExpressions",              (PyCFunction)triton_getSymbolicExpressions,                 METH_NOARGS,        ""},
         {"getSymbolicMemory",                   (PyCFunction)triton_getSymbolicMemory,                      METH_NOARGS,        ""},
@@ -3159,6 +3907,7 @@ namespace triton {
         {"getSymbolicVariableFromName",         (PyCFunction)triton_getSymbolicVariableFromName,            METH_O,             ""},
         {"getSymbolicVariables",                (PyCFunction)triton_getSymbolicVariables,                   METH_NOARGS,        ""},
         {"getTaintedMemory",                    (PyCFunction)triton_getTaintedMemory,                       METH_NOARGS,        ""},
+        {"getTaintedMemoryRanges",              (PyCFunction)triton_getTaintedMemoryRanges,                 METH_VARARGS,       ""},
         {"getTaintedRegisters",                 (PyCFunction)triton_getTaintedRegisters,                    METH_NOARGS,        ""},
         {"getTaintedSymbolicExpressions",       (PyCFunction)triton_getTaintedSymbolicExpressions,          METH_NOARGS,        ""},
         {"isArchitectureValid",                 (PyCFunction)triton_isArchitectureValid,                    METH_NOARGS,        ""},
@@ -3171,15 +3920,24 @@ namespace triton {
         {"isRegisterSymbolized",                (PyCFunction)triton_isRegisterSymbolized,                   METH_O,             ""},
         {"isRegisterTainted",                   (PyCFunction)triton_isRegisterTainted,                      METH_O,             ""},
         {"isRegisterValid",                     (PyCFunction)triton_isRegisterValid,                        METH_O,             ""},
+        {"isSat",                               (PyCFunction)triton_isSat,                                  METH_VARARGS,       ""},
+        {"isSnapshotEnabled",                   (PyCFunction)triton_isSnapshotEnabled,                      METH_NOARGS,        ""},
         {"isSymbolicEngineEnabled",             (PyCFunction)triton_isSymbolicEngineEnabled,                METH_NOARGS,        ""},
         {"isSymbolicExpressionIdExists",        (PyCFunction)triton_isSymbolicExpressionIdExists,           METH_O,             ""},
         {"isTaintEngineEnabled",                (PyCFunction)triton_isTaintEngineEnabled,                   METH_NOARGS,        ""},
+        {"loadBinary",                          (PyCFunction)triton_loadBinary,                             METH_O,             ""},
         {"newSymbolicExpression",               (PyCFunction)triton_newSymbolicExpression,                  METH_VARARGS,       ""},
         {"newSymbolicVariable",                 (PyCFunction)triton_newSymbolicVariable,                    METH_VARARGS,       ""},
+        {"popSolverScope",                      (PyCFunction)triton_popSolverScope,                         METH_NOARGS,        ""},
         {"processing",                          (PyCFunction)triton_processing,                             METH_O,             ""},
+        {"pushSolverScope",                     (PyCFunction)triton_pushSolverScope,                        METH_NOARGS,        ""},
         {"removeAllCallbacks",                  (PyCFunction)triton_removeAllCallbacks,                     METH_NOARGS,        ""},
         {"removeCallback",                      (PyCFunction)triton_removeCallback,                         METH_VARARGS,       ""},
+        {"removeSymbolicExpression",            (PyCFunction)triton_removeSymbolicExpression,               METH_O,             ""},
+        {"replayTrace",                         (PyCFunction)triton_replayTrace,                            METH_VARARGS,       ""},
         {"resetEngines",                        (PyCFunction)triton_resetEngines,                           METH_NOARGS,        ""},
+        {"resetSolverSession",                  (PyCFunction)triton_resetSolverSession,                     METH_NOARGS,        ""},
+        {"restoreSnapshot",                     (PyCFunction)triton_restoreSnapshot,                        METH_NOARGS,        ""},
         {"setArchitecture",                     (PyCFunction)triton_setArchitecture,                        METH_O,             ""},
         {"setAstRepresentationMode",            (PyCFunction)triton_setAstRepresentationMode,               METH_O,             ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)triton_setConcreteMemoryAreaValue,             METH_VARARGS,       ""},
@@ -3196,6 +3954,7 @@ namespace triton {
         {"taintAssignmentRegisterMemory",       (PyCFunction)triton_taintAssignmentRegisterMemory,          METH_VARARGS,       ""},
         {"taintAssignmentRegisterRegister",     (PyCFunction)triton_taintAssignmentRegisterRegister,        METH_VARARGS,       ""},
         {"taintMemory",                         (PyCFunction)triton_taintMemory,                            METH_O,             ""},
+        {"taintMemoryArea",                     (PyCFunction)triton_taintMemoryArea,                        METH_VARARGS,       ""},
         {"taintRegister",                       (PyCFunction)triton_taintRegister,                          METH_O,             ""},
         {"taintUnionMemoryImmediate",           (PyCFunction)triton_taintUnionMemoryImmediate,              METH_O,             ""},
         {"taintUnionMemoryMemory",              (PyCFunction)triton_taintUnionMemoryMemory,                 METH_VARARGS,       ""},
@@ -3203,9 +3962,12 @@ namespace triton {
         {"taintUnionRegisterImmediate",         (PyCFunction)triton_taintUnionRegisterImmediate,            METH_O,             ""},
         {"taintUnionRegisterMemory",            (PyCFunction)triton_taintUnionRegisterMemory,               METH_VARARGS,       ""},
         {"taintUnionRegisterRegister",          (PyCFunction)triton_taintUnionRegisterRegister,             METH_VARARGS,       ""},
+        {"takeSnapshot",                        (PyCFunction)triton_takeSnapshot,                           METH_NOARGS,        ""},
         {"unmapMemory",                         (PyCFunction)triton_unmapMemory,                            METH_VARARGS,       ""},
         {"untaintMemory",                       (PyCFunction)triton_untaintMemory,                          METH_O,             ""},
+        {"untaintMemoryArea",                   (PyCFunction)triton_untaintMemoryArea,                      METH_VARARGS,       ""},
         {"untaintRegister",                     (PyCFunction)triton_untaintRegister,                        METH_O,             ""},
+        {"writeTrace",                          (PyCFunction)triton_writeTrace,                             METH_VARARGS,       ""},
         {nullptr,                               nullptr,                                                    0,                  nullptr}
 
       };
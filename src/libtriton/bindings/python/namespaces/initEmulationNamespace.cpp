@@ -0,0 +1,71 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/architecture.hpp>
+
+
+
+/*! \page py_EMULATION_page EMULATION
+    \brief [**python api**] All information about the EMULATION python namespace.
+
+\tableofcontents
+
+\section EMULATION_py_description Description
+<hr>
+
+The EMULATION namespace contains all reasons why an emulation stops (see `emulate()`).
+
+\subsection EMULATION_py_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> if emulate(0x400000, [0x400100], 1000000) == EMULATION.SYSCALL:
+...     handle_syscall()
+~~~~~~~~~~~~~
+
+\section EMULATION_py_api Python API - Items of the EMULATION namespace
+<hr>
+
+- **EMULATION.BREAKPOINT**<br>
+The program counter has reached a breakpoint. The instruction at the breakpoint has not been executed.
+
+- **EMULATION.HOOK**<br>
+A hook has returned `False`. The instruction at the hook address has not been executed.
+
+- **EMULATION.MAX_INSTRUCTIONS**<br>
+The maximum number of instructions has been executed.
+
+- **EMULATION.SYSCALL**<br>
+A system call instruction has been executed. The program counter points to the next instruction.
+
+- **EMULATION.UNMAPPED**<br>
+The program counter points to an unmapped memory.
+
+- **EMULATION.UNSUPPORTED**<br>
+The instruction cannot be disassembled or its semantics is not supported. The instruction has not been executed.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initEmulationNamespace(PyObject* emulationDict) {
+        PyDict_SetItemString(emulationDict, "BREAKPOINT",       PyLong_FromUint32(triton::arch::EMULATION_BREAKPOINT));
+        PyDict_SetItemString(emulationDict, "HOOK",             PyLong_FromUint32(triton::arch::EMULATION_HOOK));
+        PyDict_SetItemString(emulationDict, "MAX_INSTRUCTIONS", PyLong_FromUint32(triton::arch::EMULATION_MAX_INSTRUCTIONS));
+        PyDict_SetItemString(emulationDict, "SYSCALL",          PyLong_FromUint32(triton::arch::EMULATION_SYSCALL));
+        PyDict_SetItemString(emulationDict, "UNMAPPED",         PyLong_FromUint32(triton::arch::EMULATION_UNMAPPED));
+        PyDict_SetItemString(emulationDict, "UNSUPPORTED",      PyLong_FromUint32(triton::arch::EMULATION_UNSUPPORTED));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
@@ -0,0 +1,56 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/mappedFile.hpp>
+
+
+
+/*! \page py_LOADER_page LOADER
+    \brief [**python api**] All information about the LOADER python namespace.
+
+\tableofcontents
+
+\section LOADER_py_description Description
+<hr>
+
+The LOADER namespace contains all the ways to load a binary file (see \ref py_Elf_page).
+
+\subsection LOADER_py_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> binary = Elf('/usr/bin/gdb', LOADER.READ)
+>>> binary.isMapped()
+False
+~~~~~~~~~~~~~
+
+\section LOADER_py_api Python API - Items of the LOADER namespace
+<hr>
+
+- **LOADER.MMAP**<br>
+The file is mapped read-only, its pages are loaded on demand. If the file cannot be mapped, it is read into memory.
+
+- **LOADER.READ**<br>
+The file is read into memory.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initLoaderNamespace(PyObject* loaderDict) {
+        PyDict_SetItemString(loaderDict, "MMAP", PyLong_FromUint32(triton::format::LOADER_MMAP));
+        PyDict_SetItemString(loaderDict, "READ", PyLong_FromUint32(triton::format::LOADER_READ));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
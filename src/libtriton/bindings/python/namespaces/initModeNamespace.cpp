@@ -36,6 +36,27 @@ Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory
 - **MODE.AST_DICTIONARIES**<br>
 Enabled, Triton will record all AST nodes into several dictionaries and try to return node already allocated instead of allocate twice the same node.
 
+- **MODE.AST_SIMPLIFICATION**<br>
+Enabled, Triton will simplify the AST of each new symbolic expression with its built-in rules (constant folding, algebraic identities, ...)
+before the simplification callbacks. See \ref SMT_simplification_page.
+
+- **MODE.CONCRETE_FAST_PATH**<br>
+Enabled, when none of the registers and memory cells read by an instruction is symbolized or tainted, Triton updates the
+concrete state with native arithmetic and builds no AST at all. The instruction then has no symbolic expression and adds no
+path constraint. As soon as an input is symbolized or tainted (or the instruction is not handled natively), the full symbolic
+semantics are used. Only a subset of common x86 instructions (`mov`, `lea`, arithmetic, logic, stack and branches) is handled natively.
+
+- **MODE.LAZY_EVALUATION**<br>
+Enabled, when a node is modified (e.g. a symbolic variable gets a new concrete value), its ancestors are only marked as dirty.
+They are evaluated again when they are queried (`evaluate()`, `isSymbolized()`, ...) instead of being evaluated again at once.
+
+- **MODE.LAZY_FLAGS**<br>
+Enabled, the arithmetic flags (`af`, `cf`, `of`, `pf`, `sf` and `zf`) set by the common instructions (`add`, `sub`, `cmp`, `and`, `xor`, ...)
+are not built at once. Their concrete values and their taint are updated, but their symbolic expressions are only built when they
+are read (`jcc`, `setcc`, `cmovcc`, `adc`, `pushfq`, ...) or queried (`getSymbolicRegisterId()`, `getSymbolicRegisters()`, ...).
+Flags overwritten before being read never get a symbolic expression. These flags are not part of the symbolic expressions
+nor of the written registers of the instruction which set them.
+
 - **MODE.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
 
@@ -56,6 +77,10 @@ namespace triton {
       void initModeNamespace(PyObject* modeDict) {
         PyDict_SetItemString(modeDict, "ALIGNED_MEMORY",         PyLong_FromUint32(triton::modes::ALIGNED_MEMORY));
         PyDict_SetItemString(modeDict, "AST_DICTIONARIES",       PyLong_FromUint32(triton::modes::AST_DICTIONARIES));
+        PyDict_SetItemString(modeDict, "AST_SIMPLIFICATION",     PyLong_FromUint32(triton::modes::AST_SIMPLIFICATION));
+        PyDict_SetItemString(modeDict, "CONCRETE_FAST_PATH",     PyLong_FromUint32(triton::modes::CONCRETE_FAST_PATH));
+        PyDict_SetItemString(modeDict, "LAZY_EVALUATION",        PyLong_FromUint32(triton::modes::LAZY_EVALUATION));
+        PyDict_SetItemString(modeDict, "LAZY_FLAGS",             PyLong_FromUint32(triton::modes::LAZY_FLAGS));
         PyDict_SetItemString(modeDict, "ONLY_ON_SYMBOLIZED",     PyLong_FromUint32(triton::modes::ONLY_ON_SYMBOLIZED));
         PyDict_SetItemString(modeDict, "ONLY_ON_TAINTED",        PyLong_FromUint32(triton::modes::ONLY_ON_TAINTED));
         PyDict_SetItemString(modeDict, "PC_TRACKING_SYMBOLIC",   PyLong_FromUint32(triton::modes::PC_TRACKING_SYMBOLIC));
@@ -60,7 +60,7 @@ Returns the node vector size.
 Returns the list of child nodes.
 
 - <b>integer getHash(void)</b><br>
-Returns the hash (signature) of the AST .
+Returns the structural hash (64 bits) of the AST. It is cached in the node, thus it is not computed again.
 
 - <b>\ref py_AST_NODE_page getKind(void)</b><br>
 Returns the kind of the node.<br>
@@ -118,6 +118,7 @@ namespace triton {
       //! AstNode destructor.
       void AstNode_dealloc(PyObject* self) {
         std::cout << std::flush;
+        PyAstNode_AsAstNode(self)->decRefCount();
         Py_DECREF(self);
       }
 
@@ -188,7 +189,7 @@ namespace triton {
 
       static PyObject* AstNode_getHash(PyObject* self, PyObject* noarg) {
         try {
-          return PyLong_FromUint512(PyAstNode_AsAstNode(self)->hash(1));
+          return PyLong_FromUint64(PyAstNode_AsAstNode(self)->getHash());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -209,10 +210,10 @@ namespace triton {
       static PyObject* AstNode_getParents(PyObject* self, PyObject* noarg) {
         try {
           PyObject* ret = nullptr;
-          std::set<triton::ast::AbstractNode*>& parents = PyAstNode_AsAstNode(self)->getParents();
+          triton::ast::AstParentList& parents = PyAstNode_AsAstNode(self)->getParents();
           ret = xPyList_New(parents.size());
           triton::uint32 index = 0;
-          for (std::set<triton::ast::AbstractNode*>::iterator it = parents.begin(); it != parents.end(); it++)
+          for (auto it = parents.begin(); it != parents.end(); it++)
             PyList_SetItem(ret, index++, PyAstNode(*it));
           return ret;
           }
@@ -306,7 +307,7 @@ namespace triton {
 
 
       static int AstNode_cmp(AstNode_Object* a, AstNode_Object* b) {
-        return !(a->node->hash(1) == b->node->hash(1));
+        return !(a->node->equalTo(b->node));
       }
 
 
@@ -664,8 +665,10 @@ namespace triton {
 
         PyType_Ready(&AstNode_Type);
         object = PyObject_NEW(AstNode_Object, &AstNode_Type);
-        if (object != NULL)
+        if (object != NULL) {
           object->node = node;
+          object->node->incRefCount();
+        }
 
         return (PyObject*)object;
       }
@@ -78,8 +78,11 @@ libc.so.6
 
 ~~~~~~~~~~~~~{.py}
 >>> binary = Elf('/usr/bin/gdb')
+>>> binary = Elf('/usr/bin/gdb', LOADER.READ)
 ~~~~~~~~~~~~~
 
+The optional second argument is the \ref py_LOADER_page which defines how the file is loaded (`LOADER.MMAP` by default).
+
 \section Elf_py_api Python API - Methods of the Elf class
 <hr>
 
@@ -115,6 +118,9 @@ Returns the binary size.
 - <b>[\ref py_ElfSymbolTable_page, ...] getSymbolsTable(void)</b><br>
 Returns the list of symbols table entries.
 
+- <b>bool isMapped(void)</b><br>
+Returns true if the binary file is mapped (see \ref py_LOADER_page).
+
 */
 
 
@@ -263,6 +269,18 @@ namespace triton {
       }
 
 
+      static PyObject* Elf_isMapped(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyElf_AsElf(self)->isMapped() == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* Elf_getSymbolsTable(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
@@ -293,6 +311,7 @@ namespace triton {
         {"getSharedLibraries",    Elf_getSharedLibraries,   METH_NOARGS,     ""},
         {"getSize",               Elf_getSize,              METH_NOARGS,     ""},
         {"getSymbolsTable",       Elf_getSymbolsTable,      METH_NOARGS,     ""},
+        {"isMapped",              Elf_isMapped,             METH_NOARGS,     ""},
         {nullptr,                 nullptr,                  0,               nullptr}
       };
 
@@ -349,13 +368,13 @@ namespace triton {
       };
 
 
-      PyObject* PyElf(const std::string& path) {
+      PyObject* PyElf(const std::string& path, triton::format::loader_e mode) {
         Elf_Object* object;
 
         PyType_Ready(&Elf_Type);
         object = PyObject_NEW(Elf_Object, &Elf_Type);
         if (object != NULL)
-          object->elf = new triton::format::elf::Elf(path);
+          object->elf = new triton::format::elf::Elf(path, mode);
 
         return (PyObject*)object;
       }
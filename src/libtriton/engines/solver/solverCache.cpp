@@ -0,0 +1,632 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <set>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <triton/exceptions.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/symbolicEnums.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Number of cached queries (or hashes) from which the caches are flushed */
+      static const triton::usize CACHE_THRESHOLD = 1 << 16;
+
+      /* Number of models kept as counterexamples */
+      static const triton::usize COUNTEREXAMPLES = 16;
+
+
+      /* Mixes the bits of a 64-bit value (splitmix64 finalizer) */
+      static triton::uint64 mix(triton::uint64 value) {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ULL;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebULL;
+        value ^= value >> 31;
+        return value;
+      }
+
+
+      /* Folds a 512-bit value into 64 bits */
+      static triton::uint64 fold(triton::uint512 value) {
+        triton::uint64 h = 0;
+
+        while (value != 0) {
+          h = mix(h ^ (value & std::numeric_limits<triton::uint64>::max()).convert_to<triton::uint64>());
+          value >>= 64;
+        }
+
+        return h;
+      }
+
+
+      /* Returns true if the operands of a node may be swapped */
+      static bool isCommutative(triton::ast::AbstractNode* node) {
+        switch (node->getKind()) {
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVXNOR_NODE:
+          case triton::ast::BVXOR_NODE:
+          case triton::ast::DISTINCT_NODE:
+          case triton::ast::EQUAL_NODE:
+          case triton::ast::LAND_NODE:
+          case triton::ast::LOR_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      /* Interprets a bitvector as a signed integer */
+      static triton::sint512 toSigned(const triton::uint512& value, triton::uint32 size, const triton::uint512& mask) {
+        if (((value >> (size - 1)) & 1) == 0)
+          return value.convert_to<triton::sint512>();
+        return -(((~value) + 1) & mask).convert_to<triton::sint512>();
+      }
+
+
+      /* Converts a signed integer into a bitvector */
+      static triton::uint512 fromSigned(const triton::sint512& value, const triton::uint512& mask) {
+        if (value >= 0)
+          return value.convert_to<triton::uint512>() & mask;
+        return ((~(-value).convert_to<triton::uint512>()) + 1) & mask;
+      }
+
+
+      /* Returns the value of a decimal node */
+      static triton::uint32 getDecimal(triton::ast::AbstractNode* node) {
+        return reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue().convert_to<triton::uint32>();
+      }
+
+
+      SolverCache::SolverCache(triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
+        if (symbolicEngine == nullptr)
+          throw triton::exceptions::SolverEngine("SolverCache::SolverCache(): The symbolicEngine API cannot be null.");
+
+        this->symbolicEngine     = symbolicEngine;
+        this->astRevision        = this->symbolicEngine->getAstRevision();
+        this->hits               = 0;
+        this->counterexampleHits = 0;
+        this->misses             = 0;
+      }
+
+
+      SolverCache::~SolverCache() {
+        this->flush();
+      }
+
+
+      void SolverCache::flush(void) {
+        for (auto it = this->queries.begin(); it != this->queries.end(); it++)
+          it->second.query->decRefCount();
+        this->queries.clear();
+        this->counterexamples.clear();
+
+        for (auto it = this->hashes.begin(); it != this->hashes.end(); it++)
+          it->first->decRefCount();
+        this->hashes.clear();
+      }
+
+
+      void SolverCache::clear(void) {
+        this->flush();
+        this->astRevision        = this->symbolicEngine->getAstRevision();
+        this->hits               = 0;
+        this->counterexampleHits = 0;
+        this->misses             = 0;
+      }
+
+
+      void SolverCache::checkRevision(void) {
+        triton::usize revision = this->symbolicEngine->getAstRevision();
+
+        if (revision != this->astRevision || this->queries.size() > CACHE_THRESHOLD || this->hashes.size() > CACHE_THRESHOLD) {
+          this->flush();
+          this->astRevision = revision;
+        }
+      }
+
+
+      triton::uint64 SolverCache::getHash(triton::ast::AbstractNode* node) {
+        std::unordered_map<triton::ast::AbstractNode*, triton::uint64> local;
+
+        auto cached = this->hashes.find(node);
+        if (cached != this->hashes.end())
+          return cached->second;
+
+        triton::uint64 h = this->computeHash(node, local);
+        node->incRefCount();
+        this->hashes[node] = h;
+
+        return h;
+      }
+
+
+      triton::uint64 SolverCache::computeHash(triton::ast::AbstractNode* node, std::unordered_map<triton::ast::AbstractNode*, triton::uint64>& local) {
+        std::unordered_set<triton::ast::AbstractNode*> targets;
+        std::vector<triton::ast::AbstractNode*> worklist;
+
+        auto lookup = [this, &local](triton::ast::AbstractNode* n, triton::uint64& h) {
+          auto it = this->hashes.find(n);
+          if (it != this->hashes.end()) {
+            h = it->second;
+            return true;
+          }
+          auto it2 = local.find(n);
+          if (it2 != local.end()) {
+            h = it2->second;
+            return true;
+          }
+          return false;
+        };
+
+        /*
+         * Post-order on the DAG. The hashes of the referenced expressions are
+         * kept for the next queries, the others only in `local`.
+         */
+        worklist.push_back(node);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          triton::ast::AbstractNode* target  = nullptr;
+          triton::uint64 h                   = 0;
+          bool ready                         = true;
+
+          if (lookup(current, h)) {
+            worklist.pop_back();
+            continue;
+          }
+
+          if (current->getKind() == triton::ast::REFERENCE_NODE) {
+            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue();
+            target = this->symbolicEngine->getSymbolicExpressionFromId(id)->getAst();
+            if (!lookup(target, h)) {
+              targets.insert(target);
+              worklist.push_back(target);
+              continue;
+            }
+            /* A reference has the hash of its expression */
+            local[current] = h;
+            worklist.pop_back();
+            continue;
+          }
+
+          for (auto it = current->getChilds().begin(); it != current->getChilds().end(); it++) {
+            triton::uint64 ch = 0;
+            if (!lookup(*it, ch)) {
+              worklist.push_back(*it);
+              ready = false;
+            }
+          }
+
+          if (!ready)
+            continue;
+
+          h = mix(current->getKind() ^ (static_cast<triton::uint64>(current->getBitvectorSize()) << 32));
+
+          switch (current->getKind()) {
+            case triton::ast::DECIMAL_NODE:
+              h = mix(h ^ fold(reinterpret_cast<triton::ast::DecimalNode*>(current)->getValue()));
+              break;
+
+            case triton::ast::STRING_NODE:
+              h = mix(h ^ std::hash<std::string>()(reinterpret_cast<triton::ast::StringNode*>(current)->getValue()));
+              break;
+
+            case triton::ast::VARIABLE_NODE:
+              h = mix(h ^ std::hash<std::string>()(reinterpret_cast<triton::ast::VariableNode*>(current)->getValue()));
+              break;
+
+            default: {
+              std::vector<triton::uint64> childs;
+              for (auto it = current->getChilds().begin(); it != current->getChilds().end(); it++) {
+                triton::uint64 ch = 0;
+                lookup(*it, ch);
+                childs.push_back(ch);
+              }
+              if (isCommutative(current))
+                std::sort(childs.begin(), childs.end());
+              for (auto it = childs.begin(); it != childs.end(); it++)
+                h = mix(h ^ *it) + 0x9e3779b97f4a7c15ULL;
+              break;
+            }
+          }
+
+          worklist.pop_back();
+
+          /* The hash of an expression is shared by all queries */
+          if (targets.find(current) != targets.end() && current != node) {
+            current->incRefCount();
+            this->hashes[current] = h;
+          }
+          else
+            local[current] = h;
+        }
+
+        triton::uint64 hash = 0;
+        lookup(node, hash);
+
+        return hash;
+      }
+
+
+      bool SolverCache::isSameQuery(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2) {
+        std::unordered_map<triton::ast::AbstractNode*, triton::uint64> local;
+        std::set<std::pair<triton::ast::AbstractNode*, triton::ast::AbstractNode*>> visited;
+        std::vector<std::pair<triton::ast::AbstractNode*, triton::ast::AbstractNode*>> worklist;
+
+        /* Follows the references up to the AST of the expression */
+        auto resolve = [this](triton::ast::AbstractNode* n) {
+          while (n->getKind() == triton::ast::REFERENCE_NODE)
+            n = this->symbolicEngine->getSymbolicExpressionFromId(reinterpret_cast<triton::ast::ReferenceNode*>(n)->getValue())->getAst();
+          return n;
+        };
+
+        /* The operands of commutative operators are sorted by hash, two operands with the same hash may only lead to a miss */
+        auto order = [this, &local](triton::ast::AbstractNode* a, triton::ast::AbstractNode* b) {
+          return this->computeHash(a, local) < this->computeHash(b, local);
+        };
+
+        worklist.push_back(std::make_pair(node1, node2));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* n1 = resolve(worklist.back().first);
+          triton::ast::AbstractNode* n2 = resolve(worklist.back().second);
+          worklist.pop_back();
+
+          if (n1 == n2 || visited.insert(std::make_pair(n1, n2)).second == false)
+            continue;
+
+          if (n1->getKind() != n2->getKind() || n1->getBitvectorSize() != n2->getBitvectorSize() || n1->getChilds().size() != n2->getChilds().size())
+            return false;
+
+          switch (n1->getKind()) {
+            case triton::ast::DECIMAL_NODE:
+              if (reinterpret_cast<triton::ast::DecimalNode*>(n1)->getValue() != reinterpret_cast<triton::ast::DecimalNode*>(n2)->getValue())
+                return false;
+              break;
+
+            case triton::ast::STRING_NODE:
+              if (reinterpret_cast<triton::ast::StringNode*>(n1)->getValue() != reinterpret_cast<triton::ast::StringNode*>(n2)->getValue())
+                return false;
+              break;
+
+            case triton::ast::VARIABLE_NODE:
+              if (reinterpret_cast<triton::ast::VariableNode*>(n1)->getValue() != reinterpret_cast<triton::ast::VariableNode*>(n2)->getValue())
+                return false;
+              break;
+
+            default:
+              break;
+          }
+
+          std::vector<triton::ast::AbstractNode*> childs1(n1->getChilds().begin(), n1->getChilds().end());
+          std::vector<triton::ast::AbstractNode*> childs2(n2->getChilds().begin(), n2->getChilds().end());
+
+          if (isCommutative(n1)) {
+            std::sort(childs1.begin(), childs1.end(), order);
+            std::sort(childs2.begin(), childs2.end(), order);
+          }
+
+          for (triton::usize index = 0; index < childs1.size(); index++)
+            worklist.push_back(std::make_pair(childs1[index], childs2[index]));
+        }
+
+        return true;
+      }
+
+
+      bool SolverCache::evaluate(triton::ast::AbstractNode* node, const std::map<triton::uint32, SolverModel>& model, bool& value, std::map<triton::uint32, SolverModel>& used) const {
+        std::unordered_map<triton::ast::AbstractNode*, triton::uint512> values;
+        std::vector<triton::ast::AbstractNode*> worklist;
+
+        worklist.push_back(node);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          std::vector<triton::uint512> v;
+          triton::uint512 result = 0;
+          bool ready             = true;
+
+          if (values.find(current) != values.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          /* A concrete subtree does not depend on the model */
+          if (!current->isSymbolized()) {
+            values[current] = current->evaluate();
+            worklist.pop_back();
+            continue;
+          }
+
+          switch (current->getKind()) {
+            case triton::ast::VARIABLE_NODE: {
+              std::string name  = reinterpret_cast<triton::ast::VariableNode*>(current)->getValue();
+              triton::uint32 id = std::atoi(name.c_str() + TRITON_SYMVAR_NAME_SIZE);
+              auto it           = model.find(id);
+              result            = ((it != model.end()) ? it->second.getValue() : current->evaluate()) & current->getBitvectorMask();
+              used[id]          = SolverModel(name, result);
+              values[current]   = result;
+              worklist.pop_back();
+              continue;
+            }
+
+            case triton::ast::REFERENCE_NODE: {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue();
+              triton::ast::AbstractNode* target = this->symbolicEngine->getSymbolicExpressionFromId(id)->getAst();
+              auto it = values.find(target);
+              if (it == values.end()) {
+                worklist.push_back(target);
+                continue;
+              }
+              values[current] = it->second;
+              worklist.pop_back();
+              continue;
+            }
+
+            case triton::ast::COMPOUND_NODE:
+            case triton::ast::DECLARE_FUNCTION_NODE:
+            case triton::ast::LET_NODE:
+              return false;
+
+            default:
+              break;
+          }
+
+          for (auto it = current->getChilds().begin(); it != current->getChilds().end(); it++) {
+            auto child = values.find(*it);
+            if (child == values.end()) {
+              worklist.push_back(*it);
+              ready = false;
+            }
+            else
+              v.push_back(child->second);
+          }
+
+          if (!ready)
+            continue;
+
+          const triton::ast::AstChildList& childs = current->getChilds();
+          triton::uint32 size  = current->getBitvectorSize();
+          triton::uint512 mask = current->getBitvectorMask();
+
+          switch (current->getKind()) {
+            case triton::ast::ASSERT_NODE:  result = (v[0] != 0); break;
+            case triton::ast::BVADD_NODE:   result = (v[0] + v[1]) & mask; break;
+            case triton::ast::BVAND_NODE:   result = v[0] & v[1]; break;
+            case triton::ast::BVMUL_NODE:   result = (v[0] * v[1]) & mask; break;
+            case triton::ast::BVNAND_NODE:  result = ~(v[0] & v[1]) & mask; break;
+            case triton::ast::BVNEG_NODE:   result = (~v[0] + 1) & mask; break;
+            case triton::ast::BVNOR_NODE:   result = ~(v[0] | v[1]) & mask; break;
+            case triton::ast::BVNOT_NODE:   result = ~v[0] & mask; break;
+            case triton::ast::BVOR_NODE:    result = v[0] | v[1]; break;
+            case triton::ast::BVSUB_NODE:   result = (v[0] - v[1]) & mask; break;
+            case triton::ast::BVXNOR_NODE:  result = ~(v[0] ^ v[1]) & mask; break;
+            case triton::ast::BVXOR_NODE:   result = v[0] ^ v[1]; break;
+            case triton::ast::BVUDIV_NODE:  result = (v[1] == 0) ? mask : v[0] / v[1]; break;
+            case triton::ast::BVUREM_NODE:  result = (v[1] == 0) ? v[0] : v[0] % v[1]; break;
+            case triton::ast::BVSHL_NODE:   result = (v[1] >= size) ? 0 : (v[0] << v[1].convert_to<triton::uint32>()) & mask; break;
+            case triton::ast::BVLSHR_NODE:  result = (v[1] >= size) ? 0 : (v[0] >> v[1].convert_to<triton::uint32>()); break;
+            case triton::ast::BVUGE_NODE:   result = (v[0] >= v[1]); break;
+            case triton::ast::BVUGT_NODE:   result = (v[0] > v[1]); break;
+            case triton::ast::BVULE_NODE:   result = (v[0] <= v[1]); break;
+            case triton::ast::BVULT_NODE:   result = (v[0] < v[1]); break;
+            case triton::ast::EQUAL_NODE:   result = (v[0] == v[1]); break;
+            case triton::ast::DISTINCT_NODE:result = (v[0] != v[1]); break;
+            case triton::ast::ITE_NODE:     result = (v[0] != 0) ? v[1] : v[2]; break;
+            case triton::ast::LNOT_NODE:    result = (v[0] == 0); break;
+            case triton::ast::ZX_NODE:      result = v[1]; break;
+
+            case triton::ast::LAND_NODE:
+              result = 1;
+              for (auto it = v.begin(); it != v.end(); it++)
+                result = (result != 0 && *it != 0);
+              break;
+
+            case triton::ast::LOR_NODE:
+              result = 0;
+              for (auto it = v.begin(); it != v.end(); it++)
+                result = (result != 0 || *it != 0);
+              break;
+
+            case triton::ast::BVASHR_NODE: {
+              triton::uint512 msb = (v[0] >> (size - 1)) & 1;
+              if (v[1] >= size)
+                result = (msb != 0) ? mask : 0;
+              else if (msb != 0)
+                result = ~((~v[0] & mask) >> v[1].convert_to<triton::uint32>()) & mask;
+              else
+                result = v[0] >> v[1].convert_to<triton::uint32>();
+              break;
+            }
+
+            case triton::ast::BVSDIV_NODE:
+            case triton::ast::BVSREM_NODE:
+            case triton::ast::BVSMOD_NODE: {
+              triton::sint512 op1 = toSigned(v[0], size, mask);
+              triton::sint512 op2 = toSigned(v[1], size, mask);
+              if (op2 == 0)
+                result = (current->getKind() != triton::ast::BVSDIV_NODE) ? v[0] : ((op1 < 0) ? triton::uint512(1) : mask);
+              else if (current->getKind() == triton::ast::BVSDIV_NODE)
+                result = fromSigned(op1 / op2, mask);
+              else {
+                triton::sint512 rem = op1 % op2;
+                /* The modulo takes the sign of the divisor */
+                if (current->getKind() == triton::ast::BVSMOD_NODE && rem != 0 && ((rem < 0) != (op2 < 0)))
+                  rem += op2;
+                result = fromSigned(rem, mask);
+              }
+              break;
+            }
+
+            case triton::ast::BVSGE_NODE:
+            case triton::ast::BVSGT_NODE:
+            case triton::ast::BVSLE_NODE:
+            case triton::ast::BVSLT_NODE: {
+              triton::uint32 csize  = childs[0]->getBitvectorSize();
+              triton::uint512 cmask = childs[0]->getBitvectorMask();
+              triton::sint512 op1   = toSigned(v[0], csize, cmask);
+              triton::sint512 op2   = toSigned(v[1], csize, cmask);
+              switch (current->getKind()) {
+                case triton::ast::BVSGE_NODE: result = (op1 >= op2); break;
+                case triton::ast::BVSGT_NODE: result = (op1 > op2); break;
+                case triton::ast::BVSLE_NODE: result = (op1 <= op2); break;
+                default:                      result = (op1 < op2); break;
+              }
+              break;
+            }
+
+            case triton::ast::BVROL_NODE:
+            case triton::ast::BVROR_NODE: {
+              triton::uint32 rot = getDecimal(childs[0]) % size;
+              if (rot == 0)
+                result = v[1];
+              else if (current->getKind() == triton::ast::BVROL_NODE)
+                result = ((v[1] << rot) | (v[1] >> (size - rot))) & mask;
+              else
+                result = ((v[1] >> rot) | (v[1] << (size - rot))) & mask;
+              break;
+            }
+
+            case triton::ast::CONCAT_NODE:
+              result = v[0];
+              for (triton::uint32 index = 1; index < v.size(); index++)
+                result = (result << childs[index]->getBitvectorSize()) | v[index];
+              break;
+
+            case triton::ast::EXTRACT_NODE:
+              result = (v[2] >> getDecimal(childs[1])) & mask;
+              break;
+
+            case triton::ast::SX_NODE:
+              if (((v[1] >> (childs[1]->getBitvectorSize() - 1)) & 1) != 0)
+                result = (v[1] | ~childs[1]->getBitvectorMask()) & mask;
+              else
+                result = v[1];
+              break;
+
+            default:
+              return false;
+          }
+
+          values[current] = result;
+          worklist.pop_back();
+        }
+
+        value = (values[node] != 0);
+
+        return true;
+      }
+
+
+      bool SolverCache::find(triton::ast::AbstractNode* node, bool needModel, bool& sat, std::map<triton::uint32, SolverModel>& model) {
+        std::map<triton::uint32, SolverModel> used;
+        bool value = false;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverCache::find(): node cannot be null.");
+
+        this->checkRevision();
+
+        /* The same query has already been solved */
+        auto entry = this->queries.find(this->getHash(node));
+        if (entry != this->queries.end() && (!needModel || !entry->second.sat || entry->second.hasModel)) {
+          /* On a hash collision, the query differs. A model must still satisfy it, otherwise the structure must be the same */
+          bool same = false;
+          if (entry->second.hasModel && this->evaluate(node, entry->second.model, value, used))
+            same = value;
+          else
+            same = this->isSameQuery(node, entry->second.query);
+
+          if (same) {
+            sat   = entry->second.sat;
+            model = entry->second.model;
+            this->hits++;
+            return true;
+          }
+        }
+
+        /* A recent model may satisfy the query */
+        for (auto it = this->counterexamples.begin(); it != this->counterexamples.end(); it++) {
+          used.clear();
+          if (this->evaluate(node, *it, value, used) && value) {
+            sat   = true;
+            model = used;
+            this->counterexampleHits++;
+            this->record(node, true, true, used);
+            return true;
+          }
+        }
+
+        this->misses++;
+
+        return false;
+      }
+
+
+      void SolverCache::record(triton::ast::AbstractNode* node, bool sat, bool hasModel, const std::map<triton::uint32, SolverModel>& model) {
+        Entry entry;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverCache::record(): node cannot be null.");
+
+        this->checkRevision();
+
+        entry.sat      = sat;
+        entry.hasModel = (sat && hasModel);
+        entry.query    = node;
+        if (entry.hasModel)
+          entry.model = model;
+
+        /* The previous query of the same hash is not referenced anymore */
+        triton::uint64 hash = this->getHash(node);
+        auto previous = this->queries.find(hash);
+        node->incRefCount();
+        if (previous != this->queries.end())
+          previous->second.query->decRefCount();
+
+        this->queries[hash] = entry;
+
+        if (entry.hasModel && !model.empty()) {
+          this->counterexamples.push_front(model);
+          if (this->counterexamples.size() > COUNTEREXAMPLES)
+            this->counterexamples.pop_back();
+        }
+      }
+
+
+      std::map<std::string, triton::usize> SolverCache::getStats(void) const {
+        std::map<std::string, triton::usize> stats;
+        triton::usize lookups = this->hits + this->counterexampleHits + this->misses;
+
+        stats["entries"]            = this->queries.size();
+        stats["hits"]               = this->hits;
+        stats["counterexampleHits"] = this->counterexampleHits;
+        stats["misses"]             = this->misses;
+        stats["hitRate"]            = (lookups ? ((this->hits + this->counterexampleHits) * 100) / lookups : 0);
+
+        return stats;
+      }
+
+    };
+  };
+};
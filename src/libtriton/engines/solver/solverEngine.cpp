@@ -5,12 +5,13 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <new>
+#include <tuple>
+
 #include <triton/ast.hpp>
-#include <triton/astRepresentation.hpp>
 #include <triton/exceptions.hpp>
+#include <triton/solverPool.hpp>
 #include <triton/solverEngine.hpp>
-#include <triton/tritonToZ3Ast.hpp>
-#include <triton/z3Result.hpp>
 
 
 
@@ -55,6 +56,54 @@ as Triton AST (See: \ref py_ast_page). The AST representation as string looks li
 (assert (= (ite ...)))
 ~~~~~~~~~~~~~
 
+\section solver_interface_session Solver session
+<hr>
+
+Queries are not sent as SMT2 scripts. The solver engine keeps a long-lived triton::engines::solver::SolverSession which translates
+the ASTs directly to Z3 and memoizes each translated node, thus the subtrees shared between queries (e.g. the path predicate) are
+translated only once. Constraints may be added in scopes (triton::API::pushSolverScope(), triton::API::addSolverConstraint(),
+triton::API::popSolverScope()) and all next queries (triton::API::getModel(), triton::API::isSat()) are solved incrementally on top of them.
+
+~~~~~~~~~~~~~{cpp}
+  api.pushSolverScope();
+  api.addSolverConstraint(pathConstraint);
+  for (auto branch : branches) {
+    if (api.isSat(branch))
+      auto model = api.getModel(branch);
+  }
+  api.popSolverScope();
+~~~~~~~~~~~~~
+
+\section solver_interface_partition Independent constraints
+<hr>
+
+Before asking a single model, a query is split by triton::engines::solver::SolverPartition into clusters of constraints which
+do not share any symbolic variable (e.g. the path predicate of an input parser and a negated branch). Only the clusters which
+changed since the previous queries are sent to the solver, the models of the other clusters are reused and all models are merged.
+The symbolic variables of each node are cached, thus splitting a long path predicate is cheap. The partition is not used when
+constraints have been added to the solver session, they may link the clusters.
+
+\section solver_interface_cache Cache of queries
+<hr>
+
+Before being solved, a query is looked up in a triton::engines::solver::SolverCache. Queries are keyed by a structural hash of
+their DAG (references are followed), thus a formula built twice is solved once. If the query is unknown, the cache evaluates it
+under the last models found: a model which already satisfies the query is returned without calling the solver. The statistics
+of the cache are returned by triton::API::getSolverCacheStats().
+
+\section solver_interface_pool Batch of queries
+<hr>
+
+Several independent queries (e.g. the negation of each branch of a path with triton::API::getNegatedBranchModels()) are solved
+by a triton::engines::solver::SolverPool. Each worker thread has its own Z3 context and takes the next query when it is done,
+the models are returned in the order of the queries. The queries of a batch are solved on their own, without the constraints
+of the solver session, and a time limit may be given per query.
+
+~~~~~~~~~~~~~{cpp}
+  // One model per multiple branch of the path, 8 threads, 500 ms per query
+  auto models = api.getNegatedBranchModels({}, 8, 500);
+~~~~~~~~~~~~~
+
 \section solver_interface_examples C++ example
 <hr>
 
@@ -95,112 +144,227 @@ namespace triton {
   namespace engines {
     namespace solver {
 
-      z3::expr mk_or(z3::expr_vector args) {
-        std::vector<Z3_ast> array;
-
-        for (triton::uint32 i = 0; i < args.size(); i++)
-          array.push_back(args[i]);
-
-        return to_expr(args.ctx(), Z3_mk_or(args.ctx(), static_cast<triton::uint32>(array.size()), &(array[0])));
+      /* Returns the result of a conjunction of independent queries */
+      static inline status_e mergeStatus(status_e first, status_e second) {
+        if (first == STATUS_UNSAT || second == STATUS_UNSAT)
+          return STATUS_UNSAT;
+        if (first == STATUS_UNKNOWN || second == STATUS_UNKNOWN)
+          return STATUS_UNKNOWN;
+        return STATUS_SAT;
       }
 
 
       SolverEngine::SolverEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
         if (symbolicEngine == nullptr)
           throw triton::exceptions::SolverEngine("SolverEngine::SolverEngine(): The symbolicEngine API cannot be null.");
+        this->cache = nullptr;
+        this->partition = nullptr;
+        this->session = nullptr;
         this->symbolicEngine = symbolicEngine;
       }
 
 
       SolverEngine::~SolverEngine() {
+        delete this->cache;
+        delete this->partition;
+        delete this->session;
+      }
+
+
+      SolverSession* SolverEngine::getSession(void) const {
+        if (this->session == nullptr) {
+          this->session = new(std::nothrow) SolverSession(this->symbolicEngine);
+          if (this->session == nullptr)
+            throw triton::exceptions::SolverEngine("SolverEngine::getSession(): No enough memory.");
+        }
+        return this->session;
+      }
+
+
+      SolverCache* SolverEngine::getCache(void) const {
+        if (this->cache == nullptr) {
+          this->cache = new(std::nothrow) SolverCache(this->symbolicEngine);
+          if (this->cache == nullptr)
+            throw triton::exceptions::SolverEngine("SolverEngine::getCache(): No enough memory.");
+        }
+        return this->cache;
+      }
+
+
+      SolverPartition* SolverEngine::getPartition(void) const {
+        if (this->partition == nullptr) {
+          this->partition = new(std::nothrow) SolverPartition(this->symbolicEngine);
+          if (this->partition == nullptr)
+            throw triton::exceptions::SolverEngine("SolverEngine::getPartition(): No enough memory.");
+        }
+        return this->partition;
+      }
+
+
+      status_e SolverEngine::solveCluster(const SolverPartition::Cluster& cluster, std::map<triton::uint32, SolverModel>& model) const {
+        SolverPartition* partition = this->getPartition();
+        SolverSession* session     = this->getSession();
+        status_e status            = STATUS_SAT;
+        bool sat                   = false;
+
+        if (partition->findModel(cluster, sat, model))
+          return (sat ? STATUS_SAT : STATUS_UNSAT);
+
+        /* Constraints without variable have no model, only check them */
+        if (partition->getVariables(cluster.front()).empty()) {
+          for (auto it = cluster.begin(); it != cluster.end() && status != STATUS_UNSAT; it++)
+            status = mergeStatus(status, session->check(*it));
+        }
+
+        else {
+          std::list<std::map<triton::uint32, SolverModel>> models = session->getModels(cluster, 1, &status);
+          if (models.size() > 0)
+            model = models.front();
+        }
+
+        /* The solver may succeed later on an unknown result */
+        if (status != STATUS_UNKNOWN)
+          partition->recordModel(cluster, (status == STATUS_SAT), model);
+
+        return status;
       }
 
 
       std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const {
         std::list<std::map<triton::uint32, SolverModel>> ret;
-        std::ostringstream formula;
-        z3::context ctx;
-        z3::solver solver(ctx);
-        triton::uint32 representationMode = triton::ast::representations::astRepresentation.getMode();
+        std::map<triton::uint32, SolverModel> model;
+        status_e status = STATUS_UNKNOWN;
+        bool sat = false;
 
         if (node == nullptr)
           throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
 
-        /* Switch into the SMT mode */
-        triton::ast::representations::astRepresentation.setMode(triton::ast::representations::SMT_REPRESENTATION);
+        /*
+         * Constraints of the session change the result of a query, the cache and
+         * the partition are only used for a single model of a query on its own.
+         */
+        if (limit != 1 || this->getSession()->getNumberOfConstraints() != 0)
+          return this->getSession()->getModels(node, limit);
+
+        /* A satisfiable query without variable has no model */
+        if (this->getCache()->find(node, true, sat, model)) {
+          if (sat && !model.empty())
+            ret.push_back(model);
+          return ret;
+        }
 
-        /* First, set the QF_AUFBV flag  */
-        formula << "(set-logic QF_BV)";
+        ret = this->solve(node, status);
 
-        /* Then, delcare all symbolic variables */
-        formula << this->symbolicEngine->getVariablesDeclaration();
+        /* Unsat results are recorded as well, unknown ones are not */
+        if (status != STATUS_UNKNOWN)
+          this->getCache()->record(node, (status == STATUS_SAT), true, (ret.size() > 0 ? ret.front() : model));
 
-        /* And concat the user expression */
-        formula << this->symbolicEngine->getFullAst(node);
+        return ret;
+      }
 
-        /* Create the context and AST */
-        Z3_ast ast = Z3_parse_smtlib2_string(ctx, formula.str().c_str(), 0, 0, 0, 0, 0, 0);
-        z3::expr eq(ctx, ast);
 
-        /* Create a solver and add the expression */
-        solver.add(eq);
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::solve(triton::ast::AbstractNode* node, status_e& status) const {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+        std::map<triton::uint32, SolverModel> merged;
+
+        std::vector<SolverPartition::Cluster> clusters = this->getPartition()->split(node);
+        if (clusters.size() <= 1)
+          return this->getSession()->getModels(node, 1, &status);
+
+        /* Each cluster is solved on its own (or reused) and the models are merged */
+        status = STATUS_SAT;
+        for (auto it = clusters.begin(); it != clusters.end() && status != STATUS_UNSAT; it++) {
+          std::map<triton::uint32, SolverModel> model;
+          status = mergeStatus(status, this->solveCluster(*it, model));
+          merged.insert(model.begin(), model.end());
+        }
 
-        /* Check if it is sat */
-        while (solver.check() == z3::sat && limit >= 1) {
+        if (status == STATUS_SAT && merged.size() > 0)
+          ret.push_back(merged);
 
-          /* Get model */
-          z3::model m = solver.get_model();
+        return ret;
+      }
 
-          /* Traversing the model */
-          std::map<triton::uint32, SolverModel> smodel;
-          z3::expr_vector args(ctx);
-          for (triton::uint32 i = 0; i < m.size(); i++) {
 
-            /* Get the z3 variable */
-            z3::func_decl z3Variable = m[i];
+      std::vector<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(const std::vector<triton::ast::AbstractNode*>& nodes, triton::uint32 threads, triton::uint32 timeout) const {
+        std::vector<std::map<triton::uint32, SolverModel>> ret(nodes.size());
+        std::vector<std::map<triton::uint32, SolverModel>> models;
+        std::vector<triton::ast::AbstractNode*> queries;
+        std::vector<triton::usize> indexes;
+        SolverPool pool(this->symbolicEngine);
 
-            /* Get the name as std::string from a z3 variable */
-            std::string varName = z3Variable.name().str();
+        /* The queries already known are answered by the cache */
+        for (triton::usize index = 0; index < nodes.size(); index++) {
+          bool sat = false;
 
-            /* Get z3 expr */
-            z3::expr exp = m.get_const_interp(z3Variable);
+          if (nodes[index] == nullptr)
+            throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
 
-            /* Get the size of a z3 expr */
-            triton::uint32 bvSize = exp.get_sort().bv_size();
+          if (!this->getCache()->find(nodes[index], true, sat, ret[index])) {
+            queries.push_back(nodes[index]);
+            indexes.push_back(index);
+          }
+        }
 
-            /* Get the value of a z3 expr */
-            std::string svalue = Z3_get_numeral_string(ctx, exp);
+        models = pool.getModels(queries, threads, timeout);
 
-            /* Convert a string value to a integer value */
-            triton::uint512 value = triton::uint512(svalue);
+        for (triton::usize index = 0; index < models.size(); index++) {
+          ret[indexes[index]] = models[index];
+          if (models[index].size() > 0)
+            this->getCache()->record(queries[index], true, true, models[index]);
+        }
 
-            /* Create a triton model */
-            SolverModel trionModel = SolverModel(varName, value);
+        return ret;
+      }
 
-            /* Map the result */
-            smodel[trionModel.getId()] = trionModel;
 
-            /* Uniq result */
-            if (exp.get_sort().is_bv())
-              args.push_back(ctx.bv_const(varName.c_str(), bvSize) != ctx.bv_val(svalue.c_str(), bvSize));
+      /* Returns the constraint of the first branch which has not been taken, null if all of them have been taken */
+      static triton::ast::AbstractNode* getNotTakenBranch(const triton::engines::symbolic::PathConstraint& pc) {
+        const auto& branches = pc.getBranchConstraints();
 
-          }
+        for (auto it = branches.begin(); it != branches.end(); it++) {
+          if (std::get<0>(*it) == false)
+            return std::get<3>(*it);
+        }
+
+        return nullptr;
+      }
 
-          /* Escape last models */
-          solver.add(triton::engines::solver::mk_or(args));
 
-          /* If there is model available */
-          if (smodel.size() > 0)
-            ret.push_back(smodel);
+      std::vector<std::map<triton::uint32, SolverModel>> SolverEngine::getNegatedBranchModels(const std::vector<triton::usize>& indexes, triton::uint32 threads, triton::uint32 timeout) const {
+        const std::vector<triton::engines::symbolic::PathConstraint>& pcs = this->symbolicEngine->getPathConstraints();
+        std::vector<triton::ast::AbstractNode*> prefixes;
+        std::vector<triton::ast::AbstractNode*> queries;
+        std::vector<triton::usize> selected = indexes;
 
-          /* Decrement the limit */
-          limit--;
+        /* By default, all multiple branches which have a branch not taken are negated (a jump to the next instruction has none) */
+        if (selected.empty()) {
+          for (triton::usize index = 0; index < pcs.size(); index++) {
+            if (pcs[index].isMultipleBranches() && getNotTakenBranch(pcs[index]) != nullptr)
+              selected.push_back(index);
+          }
         }
 
-        /* Restore the representation mode */
-        triton::ast::representations::astRepresentation.setMode(representationMode);
+        /* The prefix of a constraint is the conjunction of the previous ones. By default PC is T (top). */
+        prefixes.push_back(triton::ast::equal(triton::ast::bvtrue(), triton::ast::bvtrue()));
+        for (auto it = pcs.begin(); it != pcs.end(); it++)
+          prefixes.push_back(triton::ast::land(prefixes.back(), it->getTakenPathConstraintAst()));
 
-        return ret;
+        for (auto it = selected.begin(); it != selected.end(); it++) {
+          if (*it >= pcs.size())
+            throw triton::exceptions::SolverEngine("SolverEngine::getNegatedBranchModels(): Invalid path constraint index.");
+
+          if (!pcs[*it].isMultipleBranches())
+            throw triton::exceptions::SolverEngine("SolverEngine::getNegatedBranchModels(): The path constraint has a single branch.");
+
+          triton::ast::AbstractNode* branch = getNotTakenBranch(pcs[*it]);
+          if (branch == nullptr)
+            throw triton::exceptions::SolverEngine("SolverEngine::getNegatedBranchModels(): All the branches of the path constraint have been taken.");
+
+          queries.push_back(triton::ast::land(prefixes[*it], branch));
+        }
+
+        return this->getModels(queries, threads, timeout);
       }
 
 
@@ -215,6 +379,82 @@ namespace triton {
         return ret;
       }
 
+
+      bool SolverEngine::isSat(triton::ast::AbstractNode* node) const {
+        std::map<triton::uint32, SolverModel> model;
+        status_e status = STATUS_SAT;
+        bool sat = false;
+
+        if (node == nullptr || this->getSession()->getNumberOfConstraints() != 0)
+          return this->getSession()->isSat(node);
+
+        if (this->getCache()->find(node, false, sat, model))
+          return sat;
+
+        std::vector<SolverPartition::Cluster> clusters = this->getPartition()->split(node);
+        if (clusters.size() <= 1)
+          status = this->getSession()->check(node);
+
+        else {
+          for (auto it = clusters.begin(); it != clusters.end() && status != STATUS_UNSAT; it++) {
+            model.clear();
+            status = mergeStatus(status, this->solveCluster(*it, model));
+          }
+          model.clear();
+        }
+
+        /* An unknown result is not cached, the solver may succeed later */
+        if (status != STATUS_UNKNOWN)
+          this->getCache()->record(node, (status == STATUS_SAT), false, model);
+
+        return (status == STATUS_SAT);
+      }
+
+
+      void SolverEngine::push(void) {
+        this->getSession()->push();
+      }
+
+
+      void SolverEngine::pop(void) {
+        this->getSession()->pop();
+      }
+
+
+      triton::usize SolverEngine::getNumberOfScopes(void) const {
+        if (this->session == nullptr)
+          return 0;
+        return this->session->getNumberOfScopes();
+      }
+
+
+      void SolverEngine::addConstraint(triton::ast::AbstractNode* node) {
+        this->getSession()->addConstraint(node);
+      }
+
+
+      void SolverEngine::resetSession(void) {
+        if (this->session != nullptr)
+          this->session->reset();
+        if (this->partition != nullptr)
+          this->partition->clear();
+        if (this->cache != nullptr)
+          this->cache->clear();
+      }
+
+
+      std::map<std::string, triton::usize> SolverEngine::getCacheStats(void) const {
+        return this->getCache()->getStats();
+      }
+
+
+      void SolverEngine::flushCache(void) {
+        if (this->cache != nullptr)
+          this->cache->clear();
+        if (this->partition != nullptr)
+          this->partition->clear();
+      }
+
     };
   };
 };
@@ -0,0 +1,275 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <unordered_set>
+
+#include <triton/exceptions.hpp>
+#include <triton/solverPartition.hpp>
+#include <triton/symbolicEnums.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Number of cached nodes from which the caches are flushed */
+      static const triton::usize CACHE_THRESHOLD = 1 << 16;
+
+
+      SolverPartition::SolverPartition(triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
+        if (symbolicEngine == nullptr)
+          throw triton::exceptions::SolverEngine("SolverPartition::SolverPartition(): The symbolicEngine API cannot be null.");
+
+        this->symbolicEngine = symbolicEngine;
+        this->astRevision    = this->symbolicEngine->getAstRevision();
+      }
+
+
+      SolverPartition::~SolverPartition() {
+        this->clear();
+      }
+
+
+      void SolverPartition::clear(void) {
+        this->models.clear();
+
+        for (auto it = this->variables.begin(); it != this->variables.end(); it++)
+          it->first->decRefCount();
+        this->variables.clear();
+      }
+
+
+      void SolverPartition::checkRevision(void) {
+        triton::usize revision = this->symbolicEngine->getAstRevision();
+
+        if (revision != this->astRevision || this->variables.size() > CACHE_THRESHOLD) {
+          this->clear();
+          this->astRevision = revision;
+        }
+      }
+
+
+      std::vector<triton::ast::AbstractNode*> SolverPartition::collect(triton::ast::AbstractNode* node, std::vector<triton::uint32>& vars) const {
+        std::vector<triton::ast::AbstractNode*> references;
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+
+        worklist.push_back(node);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          if (visited.insert(current).second == false)
+            continue;
+
+          /* A node walked by a previous query */
+          if (current != node) {
+            auto cached = this->variables.find(current);
+            if (cached != this->variables.end()) {
+              vars.insert(vars.end(), cached->second.begin(), cached->second.end());
+              continue;
+            }
+          }
+
+          switch (current->getKind()) {
+            case triton::ast::VARIABLE_NODE: {
+              std::string name = reinterpret_cast<triton::ast::VariableNode*>(current)->getValue();
+              vars.push_back(std::atoi(name.c_str() + TRITON_SYMVAR_NAME_SIZE));
+              break;
+            }
+
+            case triton::ast::REFERENCE_NODE: {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue();
+              references.push_back(this->symbolicEngine->getSymbolicExpressionFromId(id)->getAst());
+              break;
+            }
+
+            default:
+              for (auto it = current->getChilds().begin(); it != current->getChilds().end(); it++)
+                worklist.push_back(*it);
+              break;
+          }
+        }
+
+        return references;
+      }
+
+
+      const std::vector<triton::uint32>& SolverPartition::getVariables(triton::ast::AbstractNode* node) {
+        std::unordered_map<triton::ast::AbstractNode*, std::pair<std::vector<triton::uint32>, std::vector<triton::ast::AbstractNode*>>> pending;
+        std::vector<triton::ast::AbstractNode*> worklist;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverPartition::getVariables(): node cannot be null.");
+
+        this->checkRevision();
+
+        auto cached = this->variables.find(node);
+        if (cached != this->variables.end())
+          return cached->second;
+
+        /*
+         * Post-order on the node and the ASTs of its references. The variables of
+         * an expression are cached once, even if it is referenced by several nodes.
+         */
+        worklist.push_back(node);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+
+          if (this->variables.find(current) != this->variables.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          auto state = pending.find(current);
+          if (state == pending.end()) {
+            std::vector<triton::uint32> vars;
+            std::vector<triton::ast::AbstractNode*> references = this->collect(current, vars);
+            state = pending.insert(std::make_pair(current, std::make_pair(vars, references))).first;
+
+            bool ready = true;
+            for (auto it = references.begin(); it != references.end(); it++) {
+              if (this->variables.find(*it) == this->variables.end()) {
+                worklist.push_back(*it);
+                ready = false;
+              }
+            }
+            if (!ready)
+              continue;
+          }
+
+          /* All references are cached */
+          std::vector<triton::uint32>& vars = state->second.first;
+          for (auto it = state->second.second.begin(); it != state->second.second.end(); it++) {
+            const std::vector<triton::uint32>& refVars = this->variables[*it];
+            vars.insert(vars.end(), refVars.begin(), refVars.end());
+          }
+
+          std::sort(vars.begin(), vars.end());
+          vars.erase(std::unique(vars.begin(), vars.end()), vars.end());
+
+          current->incRefCount();
+          this->variables[current] = vars;
+          pending.erase(state);
+          worklist.pop_back();
+        }
+
+        return this->variables[node];
+      }
+
+
+      std::vector<SolverPartition::Cluster> SolverPartition::split(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*> conjuncts;
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+        std::map<triton::uint32, triton::usize> owners;
+        std::vector<triton::usize> parents;
+        std::map<triton::usize, Cluster> clusters;
+        std::vector<Cluster> ret;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverPartition::split(): node cannot be null.");
+
+        /* The assert is implicit */
+        if (node->getKind() == triton::ast::ASSERT_NODE)
+          node = node->getChilds()[0];
+
+        /* Flatten the conjunctions (e.g. the path predicate is a chain of land) */
+        worklist.push_back(node);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          if (visited.insert(current).second == false)
+            continue;
+
+          if (current->getKind() == triton::ast::LAND_NODE) {
+            const triton::ast::AstChildList& childs = current->getChilds();
+            for (triton::usize index = childs.size(); index > 0; index--)
+              worklist.push_back(childs[index - 1]);
+            continue;
+          }
+
+          conjuncts.push_back(current);
+        }
+
+        /* Union-find on the conjuncts, two conjuncts sharing a variable are in the same cluster */
+        for (triton::usize index = 0; index < conjuncts.size(); index++)
+          parents.push_back(index);
+
+        auto find = [&parents](triton::usize index) {
+          while (parents[index] != index) {
+            parents[index] = parents[parents[index]];
+            index = parents[index];
+          }
+          return index;
+        };
+
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          const std::vector<triton::uint32>& vars = this->getVariables(conjuncts[index]);
+
+          /* Constraints without variable are solved together */
+          if (vars.empty()) {
+            auto owner = owners.find(static_cast<triton::uint32>(-1));
+            if (owner == owners.end())
+              owners[static_cast<triton::uint32>(-1)] = index;
+            else
+              parents[find(index)] = find(owner->second);
+            continue;
+          }
+
+          for (auto var = vars.begin(); var != vars.end(); var++) {
+            auto owner = owners.find(*var);
+            if (owner == owners.end())
+              owners[*var] = index;
+            else
+              parents[find(index)] = find(owner->second);
+          }
+        }
+
+        for (triton::usize index = 0; index < conjuncts.size(); index++)
+          clusters[find(index)].push_back(conjuncts[index]);
+
+        for (auto it = clusters.begin(); it != clusters.end(); it++) {
+          std::sort(it->second.begin(), it->second.end());
+          ret.push_back(it->second);
+        }
+
+        return ret;
+      }
+
+
+      bool SolverPartition::findModel(const Cluster& cluster, bool& sat, std::map<triton::uint32, SolverModel>& model) const {
+        auto it = this->models.find(cluster);
+
+        if (it == this->models.end())
+          return false;
+
+        sat   = it->second.first;
+        model = it->second.second;
+
+        return true;
+      }
+
+
+      void SolverPartition::recordModel(const Cluster& cluster, bool sat, const std::map<triton::uint32, SolverModel>& model) {
+        /* The conjuncts of a cluster are referenced by the cache of variables */
+        for (auto it = cluster.begin(); it != cluster.end(); it++) {
+          if (this->variables.find(*it) == this->variables.end())
+            return;
+        }
+
+        this->models[cluster] = std::make_pair(sat, model);
+      }
+
+    };
+  };
+};
@@ -0,0 +1,152 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <thread>
+
+#include <z3++.h>
+
+#include <triton/exceptions.hpp>
+#include <triton/solverPool.hpp>
+#include <triton/solverSession.hpp>
+#include <triton/tritonToZ3Ast.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverPool::SolverPool(triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
+        if (symbolicEngine == nullptr)
+          throw triton::exceptions::SolverEngine("SolverPool::SolverPool(): The symbolicEngine API cannot be null.");
+
+        this->symbolicEngine = symbolicEngine;
+      }
+
+
+      SolverPool::~SolverPool() {
+      }
+
+
+      std::vector<std::map<triton::uint32, SolverModel>> SolverPool::getModels(const std::vector<triton::ast::AbstractNode*>& nodes, triton::uint32 threads, triton::uint32 timeout) const {
+        std::vector<std::map<triton::uint32, SolverModel>> ret(nodes.size());
+        std::vector<triton::ast::TritonToZ3Ast*> translators;
+        std::vector<std::thread> workers;
+        std::atomic<triton::usize> next(0);
+        std::exception_ptr error = nullptr;
+        std::mutex lock;
+
+        for (auto it = nodes.begin(); it != nodes.end(); it++) {
+          if (*it == nullptr)
+            throw triton::exceptions::SolverEngine("SolverPool::getModels(): node cannot be null.");
+        }
+
+        if (threads == 0)
+          threads = std::thread::hardware_concurrency();
+
+        if (threads == 0)
+          threads = 1;
+
+        if (threads > nodes.size())
+          threads = static_cast<triton::uint32>(nodes.size());
+
+        /* The contexts are created (and destroyed) by this thread, the workers only use them */
+        for (triton::uint32 index = 0; index < threads; index++) {
+          triton::ast::TritonToZ3Ast* translator = new(std::nothrow) triton::ast::TritonToZ3Ast(this->symbolicEngine, false);
+          if (translator == nullptr) {
+            for (auto it = translators.begin(); it != translators.end(); it++)
+              delete *it;
+            throw triton::exceptions::SolverEngine("SolverPool::getModels(): No enough memory.");
+          }
+          translators.push_back(translator);
+        }
+
+        auto work = [&](triton::ast::TritonToZ3Ast* translator) {
+          try {
+            z3::context& ctx = translator->getContext();
+            z3::solver solver(ctx);
+
+            if (timeout != 0)
+              solver.set("timeout", timeout);
+
+            while (true) {
+              triton::usize index = next++;
+              z3::expr expr(ctx);
+
+              if (index >= nodes.size())
+                break;
+
+              /* Triton's ASTs are read by one worker at a time */
+              {
+                std::lock_guard<std::mutex> guard(lock);
+                triton::ast::AbstractNode* node = nodes[index];
+
+                if (error != nullptr)
+                  break;
+
+                /* The assert is implicit */
+                if (node->getKind() == triton::ast::ASSERT_NODE)
+                  node = node->getChilds()[0];
+
+                expr = translator->eval(*node).getExpr();
+              }
+
+              if (!expr.is_bool())
+                throw triton::exceptions::SolverEngine("SolverPool::getModels(): The constraint must be a logical node.");
+
+              solver.push();
+              solver.add(expr);
+              if (solver.check() == z3::sat) {
+                z3::model m = solver.get_model();
+                ret[index] = triton::engines::solver::convertModel(ctx, m);
+              }
+              solver.pop();
+            }
+          }
+          catch (...) {
+            std::lock_guard<std::mutex> guard(lock);
+            if (error == nullptr)
+              error = std::current_exception();
+          }
+        };
+
+        /* A single worker runs on this thread */
+        if (threads == 1)
+          work(translators[0]);
+
+        else {
+          try {
+            for (triton::uint32 index = 0; index < threads; index++)
+              workers.push_back(std::thread(work, translators[index]));
+          }
+          catch (const std::system_error&) {
+            /* No more thread available, the running workers take all queries */
+            if (workers.empty())
+              work(translators[0]);
+          }
+
+          for (auto it = workers.begin(); it != workers.end(); it++)
+            it->join();
+        }
+
+        for (auto it = translators.begin(); it != translators.end(); it++)
+          delete *it;
+
+        if (error != nullptr)
+          std::rethrow_exception(error);
+
+        return ret;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,273 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <string>
+#include <vector>
+
+#include <triton/exceptions.hpp>
+#include <triton/solverSession.hpp>
+#include <triton/symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Number of memoized translations from which the memo is flushed */
+      static const triton::usize CACHE_THRESHOLD = 1 << 16;
+
+
+      z3::expr mk_or(z3::expr_vector args) {
+        std::vector<Z3_ast> array;
+
+        for (triton::uint32 i = 0; i < args.size(); i++)
+          array.push_back(args[i]);
+
+        return to_expr(args.ctx(), Z3_mk_or(args.ctx(), static_cast<triton::uint32>(array.size()), &(array[0])));
+      }
+
+
+      /* Converts the result of a Z3 check */
+      static inline status_e toStatus(z3::check_result result) {
+        switch (result) {
+          case z3::sat:   return STATUS_SAT;
+          case z3::unsat: return STATUS_UNSAT;
+          default:
+            return STATUS_UNKNOWN;
+        }
+      }
+
+
+      std::map<triton::uint32, SolverModel> convertModel(z3::context& ctx, z3::model& m, z3::expr_vector* blocking) {
+        std::map<triton::uint32, SolverModel> smodel;
+
+        for (triton::uint32 i = 0; i < m.size(); i++) {
+
+          /* Get the z3 variable */
+          z3::func_decl z3Variable = m[i];
+
+          /* Get the name as std::string from a z3 variable */
+          std::string varName = z3Variable.name().str();
+
+          /* Get z3 expr */
+          z3::expr exp = m.get_const_interp(z3Variable);
+
+          /* Only bitvectors are symbolic variables */
+          if (!exp.get_sort().is_bv())
+            continue;
+
+          /* Get the size of a z3 expr */
+          triton::uint32 bvSize = exp.get_sort().bv_size();
+
+          /* Get the value of a z3 expr */
+          std::string svalue = Z3_get_numeral_string(ctx, exp);
+
+          /* Convert a string value to a integer value */
+          triton::uint512 value = 0;
+          for (auto it = svalue.begin(); it != svalue.end(); it++)
+            value = (value * 10) + (*it - '0');
+
+          /* Create a triton model */
+          SolverModel trionModel = SolverModel(varName, value);
+
+          /* Map the result */
+          smodel[trionModel.getId()] = trionModel;
+
+          /* Uniq result */
+          if (blocking != nullptr)
+            blocking->push_back(ctx.bv_const(varName.c_str(), bvSize) != ctx.bv_val(svalue.c_str(), bvSize));
+        }
+
+        return smodel;
+      }
+
+
+      SolverSession::SolverSession(triton::engines::symbolic::SymbolicEngine* symbolicEngine)
+        : translator(symbolicEngine, false),
+          solver(translator.getContext()) {
+
+        if (symbolicEngine == nullptr)
+          throw triton::exceptions::SolverEngine("SolverSession::SolverSession(): The symbolicEngine API cannot be null.");
+
+        this->symbolicEngine = symbolicEngine;
+        this->astRevision    = this->symbolicEngine->getAstRevision();
+        this->constraints.push_back(0);
+      }
+
+
+      SolverSession::~SolverSession() {
+      }
+
+
+      z3::expr SolverSession::translate(triton::ast::AbstractNode* node) {
+        triton::usize revision = this->symbolicEngine->getAstRevision();
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverSession::translate(): node cannot be null.");
+
+        /*
+         * A symbolic expression has a new AST, memoized references may be outdated. The memo also
+         * keeps its nodes alive, thus it is bounded while no scope is pushed.
+         */
+        if (revision != this->astRevision || (this->constraints.size() == 1 && this->translator.getNumberOfTranslations() > CACHE_THRESHOLD)) {
+          this->translator.clearTranslations();
+          this->astRevision = revision;
+        }
+
+        /* The assert is implicit */
+        if (node->getKind() == triton::ast::ASSERT_NODE)
+          node = node->getChilds()[0];
+
+        z3::expr expr = this->translator.eval(*node).getExpr();
+        if (!expr.is_bool())
+          throw triton::exceptions::SolverEngine("SolverSession::translate(): The constraint must be a logical node.");
+
+        return expr;
+      }
+
+
+      void SolverSession::push(void) {
+        this->solver.push();
+        this->constraints.push_back(0);
+      }
+
+
+      void SolverSession::pop(void) {
+        if (this->constraints.size() == 1)
+          throw triton::exceptions::SolverEngine("SolverSession::pop(): No scope to pop.");
+
+        this->solver.pop();
+        this->constraints.pop_back();
+      }
+
+
+      triton::usize SolverSession::getNumberOfScopes(void) const {
+        return this->constraints.size() - 1;
+      }
+
+
+      triton::usize SolverSession::getNumberOfConstraints(void) const {
+        triton::usize count = 0;
+
+        for (auto it = this->constraints.begin(); it != this->constraints.end(); it++)
+          count += *it;
+
+        return count;
+      }
+
+
+      void SolverSession::addConstraint(triton::ast::AbstractNode* node) {
+        this->solver.add(this->translate(node));
+        this->constraints.back()++;
+      }
+
+
+      status_e SolverSession::check(triton::ast::AbstractNode* node) {
+        status_e status = STATUS_UNKNOWN;
+
+        this->solver.push();
+        try {
+          if (node != nullptr)
+            this->solver.add(this->translate(node));
+          status = toStatus(this->solver.check());
+        }
+        catch (...) {
+          this->solver.pop();
+          throw;
+        }
+        this->solver.pop();
+
+        return status;
+      }
+
+
+      bool SolverSession::isSat(triton::ast::AbstractNode* node) {
+        return (this->check(node) == STATUS_SAT);
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverSession::getModels(triton::ast::AbstractNode* node, triton::uint32 limit, status_e* status) {
+        std::vector<triton::ast::AbstractNode*> nodes;
+
+        if (node != nullptr)
+          nodes.push_back(node);
+
+        return this->getModels(nodes, limit, status);
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverSession::getModels(const std::vector<triton::ast::AbstractNode*>& nodes, triton::uint32 limit, status_e* status) {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+        z3::context& ctx = this->translator.getContext();
+
+        if (status != nullptr)
+          *status = STATUS_UNKNOWN;
+
+        /* The nodes and the blocking clauses only live in this scope */
+        this->solver.push();
+
+        try {
+          for (auto it = nodes.begin(); it != nodes.end(); it++)
+            this->solver.add(this->translate(*it));
+
+          /* Check if it is sat */
+          for (triton::uint32 count = 0; count < limit; count++) {
+            z3::check_result result = this->solver.check();
+
+            /* The status of the query is the one of its first check */
+            if (count == 0 && status != nullptr)
+              *status = toStatus(result);
+
+            if (result != z3::sat)
+              break;
+
+            /* Get model */
+            z3::model m = this->solver.get_model();
+
+            /* Traversing the model */
+            z3::expr_vector args(ctx);
+            std::map<triton::uint32, SolverModel> smodel = triton::engines::solver::convertModel(ctx, m, &args);
+
+            /* If there is no variable, there is no other model */
+            if (args.size() == 0)
+              break;
+
+            /* Escape last models */
+            this->solver.add(triton::engines::solver::mk_or(args));
+
+            /* If there is model available */
+            ret.push_back(smodel);
+          }
+        }
+        catch (...) {
+          this->solver.pop();
+          throw;
+        }
+
+        this->solver.pop();
+
+        return ret;
+      }
+
+
+      triton::usize SolverSession::getNumberOfTranslations(void) const {
+        return this->translator.getNumberOfTranslations();
+      }
+
+
+      void SolverSession::reset(void) {
+        this->solver.reset();
+        this->translator.clearTranslations();
+        this->astRevision = this->symbolicEngine->getAstRevision();
+        this->constraints.clear();
+        this->constraints.push_back(0);
+      }
+
+    };
+  };
+};
@@ -0,0 +1,158 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <set>
+
+#include <triton/deferredExpression.hpp>
+#include <triton/symbolicEnums.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      DeferredExpression::DeferredExpression(const deferredBuilder& builder,
+                                             SymbolicExpression* parent,
+                                             triton::ast::AbstractNode* op1,
+                                             triton::ast::AbstractNode* op2,
+                                             const std::string& comment) {
+        this->builder   = builder;
+        this->comment   = comment;
+        this->nodes[0]  = (parent != nullptr ? parent->getAst() : nullptr);
+        this->nodes[1]  = op1;
+        this->nodes[2]  = op2;
+        this->parentId  = (parent != nullptr ? parent->getId() : triton::engines::symbolic::UNSET);
+        this->tainted   = (parent != nullptr ? parent->isTainted : false);
+
+        for (triton::uint32 i = 0; i < 3; i++) {
+          if (this->nodes[i] != nullptr)
+            this->nodes[i]->incRefCount();
+        }
+
+        /* The builder refers to the parent expression and to the expressions referenced by the operands */
+        if (this->parentId != triton::engines::symbolic::UNSET)
+          this->references.push_back(this->parentId);
+        this->collectReferences(this->nodes[1]);
+        this->collectReferences(this->nodes[2]);
+      }
+
+
+      DeferredExpression::DeferredExpression(const DeferredExpression& other) {
+        this->copy(other);
+      }
+
+
+      DeferredExpression::~DeferredExpression() {
+        this->release();
+      }
+
+
+      void DeferredExpression::copy(const DeferredExpression& other) {
+        this->builder     = other.builder;
+        this->comment     = other.comment;
+        this->parentId    = other.parentId;
+        this->references  = other.references;
+        this->tainted     = other.tainted;
+
+        for (triton::uint32 i = 0; i < 3; i++) {
+          this->nodes[i] = other.nodes[i];
+          if (this->nodes[i] != nullptr)
+            this->nodes[i]->incRefCount();
+        }
+      }
+
+
+      void DeferredExpression::release(void) {
+        for (triton::uint32 i = 0; i < 3; i++) {
+          if (this->nodes[i] != nullptr)
+            this->nodes[i]->decRefCount();
+          this->nodes[i] = nullptr;
+        }
+      }
+
+
+      void DeferredExpression::collectReferences(triton::ast::AbstractNode* node) {
+        std::set<triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> worklist;
+
+        if (node == nullptr)
+          return;
+
+        /* References are leaves, thus only the operand trees are walked, not the referenced ASTs */
+        worklist.push_back(node);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          if (visited.insert(current).second == false)
+            continue;
+
+          if (current->getKind() == triton::ast::REFERENCE_NODE) {
+            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue();
+            if (std::find(this->references.begin(), this->references.end(), id) == this->references.end())
+              this->references.push_back(id);
+            continue;
+          }
+
+          for (auto it = current->getChilds().begin(); it != current->getChilds().end(); it++)
+            worklist.push_back(*it);
+        }
+      }
+
+
+      void DeferredExpression::operator=(const DeferredExpression& other) {
+        if (this == &other)
+          return;
+        this->release();
+        this->copy(other);
+      }
+
+
+      triton::ast::AbstractNode* DeferredExpression::buildAst(void) const {
+        return this->builder();
+      }
+
+
+      const std::string& DeferredExpression::getComment(void) const {
+        return this->comment;
+      }
+
+
+      triton::usize DeferredExpression::getParentId(void) const {
+        return this->parentId;
+      }
+
+
+      bool DeferredExpression::isSymbolized(void) const {
+        /* The AST is only made of these nodes and constants */
+        for (triton::uint32 i = 0; i < 3; i++) {
+          if (this->nodes[i] != nullptr && this->nodes[i]->isSymbolized())
+            return true;
+        }
+        return false;
+      }
+
+
+      const std::vector<triton::usize>& DeferredExpression::getReferences(void) const {
+        return this->references;
+      }
+
+
+      bool DeferredExpression::isReferencing(triton::usize symExprId) const {
+        return std::find(this->references.begin(), this->references.end(), symExprId) != this->references.end();
+      }
+
+
+      bool DeferredExpression::isTainted(void) const {
+        return this->tainted;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -20,16 +20,34 @@ namespace triton {
 
       PathConstraint::PathConstraint(const PathConstraint &copy) {
         this->branches = copy.branches;
+
+        for (auto it = this->branches.begin(); it != this->branches.end(); it++)
+          std::get<3>(*it)->incRefCount();
       }
 
 
       PathConstraint::~PathConstraint() {
+        for (auto it = this->branches.begin(); it != this->branches.end(); it++)
+          std::get<3>(*it)->decRefCount();
+      }
+
+
+      void PathConstraint::operator=(const PathConstraint &other) {
+        /* Take the new references first, both constraints may share nodes */
+        for (auto it = other.branches.begin(); it != other.branches.end(); it++)
+          std::get<3>(*it)->incRefCount();
+
+        for (auto it = this->branches.begin(); it != this->branches.end(); it++)
+          std::get<3>(*it)->decRefCount();
+
+        this->branches = other.branches;
       }
 
 
       void PathConstraint::addBranchConstraint(bool taken, triton::uint64 srcAddr, triton::uint64 dstAddr, triton::ast::AbstractNode* pc) {
         if (pc == nullptr)
           throw triton::exceptions::PathConstraint("PathConstraint::addBranchConstraint(): The PC node cannot be null.");
+        pc->incRefCount();
         this->branches.push_back(std::make_tuple(taken, srcAddr, dstAddr, pc));
       }
 
@@ -18,7 +18,10 @@ namespace triton {
       PathManager::PathManager(triton::modes::Modes* modes) {
         if (modes == nullptr)
           throw triton::exceptions::PathManager("PathManager::PathManager(): The modes API cannot be null.");
-        this->modes = modes;
+        this->modes           = modes;
+        this->snapshotPathFlag    = false;
+        this->snapshotPathSize    = 0;
+        this->snapshotPathCleared = false;
       }
 
 
@@ -31,9 +34,14 @@ namespace triton {
       }
 
 
+      /* The snapshot is not copied */
       void PathManager::copy(const PathManager& other) {
         this->modes           = other.modes;
         this->pathConstraints = other.pathConstraints;
+        this->snapshotPathFlag    = false;
+        this->snapshotPathSize    = 0;
+        this->snapshotPathCleared = false;
+        this->snapshotPathConstraints.clear();
       }
 
 
@@ -126,10 +134,47 @@ namespace triton {
 
 
       void PathManager::clearPathConstraints(void) {
+        /* Path constraints are only appended, thus the snapshot is saved only once they are cleared */
+        if (this->snapshotPathFlag && !this->snapshotPathCleared) {
+          this->pathConstraints.erase(this->pathConstraints.begin() + this->snapshotPathSize, this->pathConstraints.end());
+          this->snapshotPathConstraints.swap(this->pathConstraints);
+          this->snapshotPathCleared = true;
+        }
         this->pathConstraints.clear();
       }
 
 
+      void PathManager::takeSnapshot(void) {
+        this->snapshotPathConstraints.clear();
+        this->snapshotPathFlag    = true;
+        this->snapshotPathSize    = this->pathConstraints.size();
+        this->snapshotPathCleared = false;
+      }
+
+
+      void PathManager::restoreSnapshot(void) {
+        if (this->snapshotPathFlag == false)
+          throw triton::exceptions::PathManager("PathManager::restoreSnapshot(): No snapshot taken.");
+
+        if (this->snapshotPathCleared) {
+          this->pathConstraints.swap(this->snapshotPathConstraints);
+          this->snapshotPathConstraints.clear();
+          this->snapshotPathCleared = false;
+        }
+        else {
+          this->pathConstraints.erase(this->pathConstraints.begin() + this->snapshotPathSize, this->pathConstraints.end());
+        }
+      }
+
+
+      void PathManager::discardSnapshot(void) {
+        this->snapshotPathConstraints.clear();
+        this->snapshotPathFlag    = false;
+        this->snapshotPathSize    = 0;
+        this->snapshotPathCleared = false;
+      }
+
+
       void PathManager::operator=(const PathManager& other) {
         this->copy(other);
       }
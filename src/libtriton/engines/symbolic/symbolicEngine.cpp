@@ -5,8 +5,11 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cstring>
 #include <new>
+#include <utility>
+#include <vector>
 
 #include <triton/exceptions.hpp>
 #include <triton/coreUtils.hpp>
@@ -75,7 +78,7 @@ namespace triton {
                                      triton::callbacks::Callbacks* callbacks,
                                      bool isBackup)
 
-        : triton::engines::symbolic::SymbolicSimplification(callbacks),
+        : triton::engines::symbolic::SymbolicSimplification(callbacks, modes),
           triton::engines::symbolic::PathManager(modes) {
 
         if (architecture == nullptr)
@@ -92,12 +95,15 @@ namespace triton {
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
           this->symbolicReg[i] = triton::engines::symbolic::UNSET;
 
-        this->callbacks       = callbacks;
-        this->backupFlag      = isBackup;
-        this->enableFlag      = true;
-        this->modes           = modes;
-        this->uniqueSymExprId = 0;
-        this->uniqueSymVarId  = 0;
+        this->callbacks        = callbacks;
+        this->backupFlag       = isBackup;
+        this->astRevision      = 0;
+        this->enableFlag       = true;
+        this->fullAstsRevision = 0;
+        this->modes            = modes;
+        this->snapshotFlag     = false;
+        this->uniqueSymExprId  = 0;
+        this->uniqueSymVarId   = 0;
       }
 
 
@@ -123,6 +129,21 @@ namespace triton {
         this->symbolicVariables           = other.symbolicVariables;
         this->uniqueSymExprId             = other.uniqueSymExprId;
         this->uniqueSymVarId              = other.uniqueSymVarId;
+
+        /* Each copy owns its deferred registers */
+        this->copyDeferredRegisters(this->deferredRegisters, other.deferredRegisters);
+
+        /* The snapshot is not copied */
+        this->snapshotFlag                = false;
+        this->snapshotSymExprId           = 0;
+
+        /* The memo of full ASTs is not shared, ids may be reused once a copy is restored */
+        this->astRevision                 = other.astRevision;
+        this->fullAstsRevision            = other.astRevision;
+
+        /* Each copy holds its own references on the aligned memory nodes */
+        for (auto it = this->alignedMemoryReference.begin(); it != this->alignedMemoryReference.end(); it++)
+          it->second->incRefCount();
       }
 
 
@@ -134,6 +155,8 @@ namespace triton {
 
 
       void SymbolicEngine::operator=(const SymbolicEngine& other) {
+        this->discardSnapshot();
+
         triton::engines::symbolic::SymbolicSimplification::operator=(other);
         triton::engines::symbolic::PathManager::operator=(other);
 
@@ -151,12 +174,29 @@ namespace triton {
             delete this->symbolicVariables[it2->first];
         }
 
+        /* Drop the references of the current aligned memory once the new ones are taken */
+        auto alignedMemory = this->alignedMemoryReference;
+
+        this->clearFullAsts();
+        this->clearDeferredRegisters(this->deferredRegisters);
+
+        /* The revision never goes back, the memos built on this engine are outdated */
+        triton::usize revision = std::max(this->astRevision, other.astRevision) + 1;
+
         delete[] this->symbolicReg;
         this->copy(other);
+        this->astRevision      = revision;
+        this->fullAstsRevision = revision;
+
+        for (auto it = alignedMemory.begin(); it != alignedMemory.end(); it++)
+          it->second->decRefCount();
       }
 
 
       SymbolicEngine::~SymbolicEngine() {
+        /* Delete the expressions removed since the snapshot and drop its references */
+        this->discardSnapshot();
+
         std::map<triton::usize, SymbolicExpression*>::iterator it1 = this->symbolicExpressions.begin();
         std::map<triton::usize, SymbolicVariable*>::iterator it2 = this->symbolicVariables.begin();
 
@@ -176,6 +216,13 @@ namespace triton {
             delete it2->second;
         }
 
+        /* Drop references on the aligned memory nodes */
+        for (auto it = this->alignedMemoryReference.begin(); it != this->alignedMemoryReference.end(); it++)
+          it->second->decRefCount();
+
+        this->clearFullAsts();
+        this->clearDeferredRegisters(this->deferredRegisters);
+
         /* Delete all symbolic register */
         delete[] this->symbolicReg;
       }
@@ -192,12 +239,14 @@ namespace triton {
         if (!this->architecture->isRegisterValid(parentId))
           return;
 
+        this->dropDeferredRegister(parentId);
         this->symbolicReg[parentId] = triton::engines::symbolic::UNSET;
       }
 
 
       /* Same as concretizeRegister but with all registers */
       void SymbolicEngine::concretizeAllRegister(void) {
+        this->clearDeferredRegisters(this->deferredRegisters);
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
           this->symbolicReg[i] = triton::engines::symbolic::UNSET;
       }
@@ -223,6 +272,7 @@ namespace triton {
        * before symbolic processing.
        */
       void SymbolicEngine::concretizeMemory(triton::uint64 addr) {
+        this->saveMemoryReference(addr);
         this->memoryReference.erase(addr);
         if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
           this->removeAlignedMemory(addr, BYTE_SIZE);
@@ -231,6 +281,16 @@ namespace triton {
 
       /* Same as concretizeMemory but with all address memory */
       void SymbolicEngine::concretizeAllMemory(void) {
+        if (this->snapshotFlag) {
+          for (auto it = this->memoryReference.begin(); it != this->memoryReference.end(); it++)
+            this->saveMemoryReference(it->first);
+          for (auto it = this->alignedMemoryReference.begin(); it != this->alignedMemoryReference.end(); it++)
+            this->saveAlignedMemory(it->first.first, it->first.second);
+        }
+
+        for (auto it = this->alignedMemoryReference.begin(); it != this->alignedMemoryReference.end(); it++)
+          it->second->decRefCount();
+
         this->memoryReference.clear();
         this->alignedMemoryReference.clear();
       }
@@ -255,7 +315,55 @@ namespace triton {
       /* Adds an aligned memory */
       void SymbolicEngine::addAlignedMemory(triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node) {
         this->removeAlignedMemory(address, size);
+        this->saveAlignedMemory(address, size);
         this->alignedMemoryReference[std::make_pair(address, size)] = node;
+        node->incRefCount();
+      }
+
+
+      /* Removes one entry of the aligned memory */
+      void SymbolicEngine::removeAlignedMemoryEntry(triton::uint64 address, triton::uint32 size) {
+        auto it = this->alignedMemoryReference.find(std::make_pair(address, size));
+
+        if (it != this->alignedMemoryReference.end()) {
+          this->saveAlignedMemory(address, size);
+          it->second->decRefCount();
+          this->alignedMemoryReference.erase(it);
+        }
+      }
+
+
+      /* Saves the memory reference of an address before its first modification since the snapshot */
+      void SymbolicEngine::saveMemoryReference(triton::uint64 addr) {
+        if (this->snapshotFlag == false)
+          return;
+
+        auto saved = this->snapshotMemoryReference.lower_bound(addr);
+        if (saved != this->snapshotMemoryReference.end() && saved->first == addr)
+          return;
+
+        auto it = this->memoryReference.find(addr);
+        this->snapshotMemoryReference.emplace_hint(saved, addr, (it != this->memoryReference.end()) ? it->second : triton::engines::symbolic::UNSET);
+      }
+
+
+      /* Saves an entry of the aligned memory before its first modification since the snapshot */
+      void SymbolicEngine::saveAlignedMemory(triton::uint64 address, triton::uint32 size) {
+        if (this->snapshotFlag == false)
+          return;
+
+        auto key   = std::make_pair(address, size);
+        auto saved = this->snapshotAlignedMemory.lower_bound(key);
+        if (saved != this->snapshotAlignedMemory.end() && saved->first == key)
+          return;
+
+        auto it = this->alignedMemoryReference.find(key);
+        triton::ast::AbstractNode* node = (it != this->alignedMemoryReference.end()) ? it->second : nullptr;
+
+        if (node != nullptr)
+          node->incRefCount();
+
+        this->snapshotAlignedMemory.emplace_hint(saved, key, node);
       }
 
 
@@ -263,29 +371,29 @@ namespace triton {
       void SymbolicEngine::removeAlignedMemory(triton::uint64 address, triton::uint32 size) {
         /* Remove overloaded positive ranges */
         for (triton::uint32 index = 0; index < size; index++) {
-          this->alignedMemoryReference.erase(std::make_pair(address+index, BYTE_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, WORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, QWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DQWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, QQWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DQQWORD_SIZE));
+          this->removeAlignedMemoryEntry(address+index, BYTE_SIZE);
+          this->removeAlignedMemoryEntry(address+index, WORD_SIZE);
+          this->removeAlignedMemoryEntry(address+index, DWORD_SIZE);
+          this->removeAlignedMemoryEntry(address+index, QWORD_SIZE);
+          this->removeAlignedMemoryEntry(address+index, DQWORD_SIZE);
+          this->removeAlignedMemoryEntry(address+index, QQWORD_SIZE);
+          this->removeAlignedMemoryEntry(address+index, DQQWORD_SIZE);
         }
 
         /* Remove overloaded negative ranges */
         for (triton::uint32 index = 1; index < DQQWORD_SIZE; index++) {
           if (index < WORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, WORD_SIZE));
+            this->removeAlignedMemoryEntry(address-index, WORD_SIZE);
           if (index < DWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DWORD_SIZE));
+            this->removeAlignedMemoryEntry(address-index, DWORD_SIZE);
           if (index < QWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, QWORD_SIZE));
+            this->removeAlignedMemoryEntry(address-index, QWORD_SIZE);
           if (index < DQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DQWORD_SIZE));
+            this->removeAlignedMemoryEntry(address-index, DQWORD_SIZE);
           if (index < QQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, QQWORD_SIZE));
+            this->removeAlignedMemoryEntry(address-index, QQWORD_SIZE);
           if (index < DQQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DQQWORD_SIZE));
+            this->removeAlignedMemoryEntry(address-index, DQQWORD_SIZE);
         }
       }
 
@@ -335,6 +443,13 @@ namespace triton {
         if (!this->architecture->isRegisterValid(parentId))
           return triton::engines::symbolic::UNSET;
 
+        /*
+         * A deferred register is built on its first read. This does not change
+         * the symbolic state seen by the user, thus the method stays const.
+         */
+        if (!this->deferredRegisters.empty())
+          const_cast<SymbolicEngine*>(this)->materializeRegister(parentId);
+
         return this->symbolicReg[parentId];
       }
 
@@ -404,10 +519,30 @@ namespace triton {
         std::map<triton::uint64, triton::usize>::iterator it;
 
         if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end()) {
-          /* Delete and remove the pointer */
-          delete this->symbolicExpressions[symExprId];
+          /* Drop its memoized full AST */
+          auto memo = this->fullAsts.find(symExprId);
+          if (memo != this->fullAsts.end()) {
+            memo->second->decRefCount();
+            this->fullAsts.erase(memo);
+          }
+
+          /* Delete and remove the pointer. The expressions of the snapshot are kept until it is discarded */
+          if (this->snapshotFlag && symExprId < this->snapshotSymExprId)
+            this->snapshotRemovedExpressions[symExprId] = this->symbolicExpressions[symExprId];
+          else
+            delete this->symbolicExpressions[symExprId];
           this->symbolicExpressions.erase(symExprId);
 
+          /* Drop the deferred registers which refer to it */
+          for (auto it = this->deferredRegisters.begin(); it != this->deferredRegisters.end();) {
+            if (it->second->isReferencing(symExprId)) {
+              delete it->second;
+              this->deferredRegisters.erase(it++);
+            }
+            else
+              ++it;
+          }
+
           /* Concretize the register if it exists */
           for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
             if (this->symbolicReg[i] == symExprId) {
@@ -428,6 +563,77 @@ namespace triton {
       }
 
 
+      /*
+       * Removes the symbolic expressions which are not reachable anymore. Roots are the
+       * register and memory references and the path constraints, an expression referenced
+       * by a reachable AST is reachable in turn.
+       */
+      void SymbolicEngine::removeUnreachableExpressions(std::set<triton::ast::AbstractNode*>& nodes) {
+        std::set<triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::set<triton::usize> reachable;
+        std::vector<triton::usize> ids;
+
+        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
+          if (this->symbolicReg[i] != triton::engines::symbolic::UNSET)
+            ids.push_back(this->symbolicReg[i]);
+        }
+
+        for (auto it = this->memoryReference.begin(); it != this->memoryReference.end(); it++)
+          ids.push_back(it->second);
+
+        for (auto it = this->deferredRegisters.begin(); it != this->deferredRegisters.end(); it++)
+          ids.insert(ids.end(), it->second->getReferences().begin(), it->second->getReferences().end());
+
+        for (auto it = this->alignedMemoryReference.begin(); it != this->alignedMemoryReference.end(); it++)
+          worklist.push_back(it->second);
+
+        for (auto pc = this->pathConstraints.begin(); pc != this->pathConstraints.end(); pc++) {
+          for (auto it = pc->getBranchConstraints().begin(); it != pc->getBranchConstraints().end(); it++)
+            worklist.push_back(std::get<3>(*it));
+        }
+
+        /* Mark the reachable expressions */
+        while (!ids.empty() || !worklist.empty()) {
+          if (!ids.empty()) {
+            triton::usize id = ids.back();
+            ids.pop_back();
+            auto expr = this->symbolicExpressions.find(id);
+            if (reachable.insert(id).second && expr != this->symbolicExpressions.end())
+              worklist.push_back(expr->second->getAst());
+            continue;
+          }
+
+          triton::ast::AbstractNode* node = worklist.back();
+          worklist.pop_back();
+
+          if (node == nullptr || visited.insert(node).second == false)
+            continue;
+
+          if (node->getKind() == triton::ast::REFERENCE_NODE) {
+            ids.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue());
+            continue;
+          }
+
+          for (auto it = node->getChilds().begin(); it != node->getChilds().end(); it++)
+            worklist.push_back(*it);
+        }
+
+        /* Sweep the others */
+        for (auto it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end();) {
+          triton::usize id = it->first;
+          triton::ast::AbstractNode* ast = it->second->getAst();
+          ++it;
+
+          if (reachable.find(id) != reachable.end())
+            continue;
+
+          nodes.insert(ast);
+          this->removeSymbolicExpression(id);
+        }
+      }
+
+
       /* Gets the symbolic expression pointer from a symbolic id */
       SymbolicExpression* SymbolicEngine::getSymbolicExpressionFromId(triton::usize symExprId) const {
         if (this->symbolicExpressions.find(symExprId) == this->symbolicExpressions.end())
@@ -442,36 +648,97 @@ namespace triton {
       }
 
 
+      /* [private method] Drops the memo of full ASTs */
+      void SymbolicEngine::clearFullAsts(void) {
+        for (auto it = this->fullAsts.begin(); it != this->fullAsts.end(); it++)
+          it->second->decRefCount();
+        this->fullAsts.clear();
+        this->fullAstsRevision = this->astRevision;
+      }
+
+
       /* Returns the full symbolic expression backtracked. */
-      triton::ast::AbstractNode* SymbolicEngine::getFullAst(triton::ast::AbstractNode* node, std::set<triton::usize>& processed) {
-        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+      triton::ast::AbstractNode* SymbolicEngine::getFullAst(triton::ast::AbstractNode* node) {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> rebuilt;
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
 
-        for (triton::uint32 index = 0; index < childs.size(); index++) {
-          if (childs[index]->getKind() == triton::ast::REFERENCE_NODE) {
-            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(childs[index])->getValue();
-            triton::ast::AbstractNode* ref = this->getSymbolicExpressionFromId(id)->getAst();
-            childs[index] = ref;
-            if (processed.find(id) != processed.end())
+        if (node == nullptr)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::getFullAst(): node cannot be null.");
+
+        /* An expression has a new AST, memoized full ASTs may be outdated */
+        if (this->fullAstsRevision != this->astRevision)
+          this->clearFullAsts();
+
+        /*
+         * Post-order walk with an explicit stack, the depth of a trace may exceed the
+         * depth of the native stack. The second item is true once the childs are pushed.
+         */
+        worklist.push_back(std::make_pair(node, false));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back().first;
+          bool expanded = worklist.back().second;
+
+          if (rebuilt.find(current) != rebuilt.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          /* A reference is replaced by the full AST of its expression */
+          if (current->getKind() == triton::ast::REFERENCE_NODE) {
+            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue();
+            auto memo = this->fullAsts.find(id);
+
+            if (memo != this->fullAsts.end()) {
+              rebuilt[current] = memo->second;
+              worklist.pop_back();
+              continue;
+            }
+
+            triton::ast::AbstractNode* ast = this->getSymbolicExpressionFromId(id)->getAst();
+            if (!expanded) {
+              worklist.back().second = true;
+              worklist.push_back(std::make_pair(ast, false));
               continue;
-            processed.insert(id);
+            }
+
+            triton::ast::AbstractNode* full = rebuilt[ast];
+            full->incRefCount();
+            this->fullAsts[id] = full;
+            rebuilt[current] = full;
+            worklist.pop_back();
+            continue;
           }
-          this->getFullAst(childs[index], processed);
-        }
 
-        return node;
-      }
+          triton::ast::AstChildList& childs = current->getChilds();
+          if (!expanded) {
+            worklist.back().second = true;
+            for (auto it = childs.begin(); it != childs.end(); it++) {
+              if (rebuilt.find(*it) == rebuilt.end())
+                worklist.push_back(std::make_pair(*it, false));
+            }
+            continue;
+          }
 
+          /* Only the nodes which contain a reference are rebuilt */
+          triton::ast::AstChildList newChilds;
+          bool changed = false;
+          for (auto it = childs.begin(); it != childs.end(); it++) {
+            triton::ast::AbstractNode* child = rebuilt[*it];
+            changed |= (child != *it);
+            newChilds.push_back(child);
+          }
 
-      /* Returns the full symbolic expression backtracked. */
-      triton::ast::AbstractNode* SymbolicEngine::getFullAst(triton::ast::AbstractNode* node) {
-        std::set<triton::usize> processed;
-        return this->getFullAst(node, processed);
+          rebuilt[current] = changed ? triton::ast::newInstance(current, newChilds) : current;
+          worklist.pop_back();
+        }
+
+        return rebuilt[node];
       }
 
 
       /* [private method] Slices all expressions from a given node */
       void SymbolicEngine::sliceExpressions(triton::ast::AbstractNode* node, std::map<triton::usize, SymbolicExpression*>& exprs) {
-        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+        triton::ast::AstChildList& childs = node->getChilds();
 
         for (triton::uint32 index = 0; index < childs.size(); index++) {
           if (childs[index]->getKind() == triton::ast::REFERENCE_NODE) {
@@ -501,6 +768,18 @@ namespace triton {
       }
 
 
+      /* Returns the revision of symbolic expressions */
+      triton::usize SymbolicEngine::getAstRevision(void) const {
+        return this->astRevision;
+      }
+
+
+      /* Increases the revision of symbolic expressions */
+      void SymbolicEngine::incAstRevision(void) {
+        this->astRevision++;
+      }
+
+
       /* Returns a list which contains all tainted expressions */
       std::list<SymbolicExpression*> SymbolicEngine::getTaintedSymbolicExpressions(void) const {
         std::map<triton::usize, SymbolicExpression*>::const_iterator it;
@@ -530,6 +809,10 @@ namespace triton {
       std::map<triton::arch::Register, SymbolicExpression*> SymbolicEngine::getSymbolicRegisters(void) const {
         std::map<triton::arch::Register, SymbolicExpression*> ret;
 
+        /* Deferred registers are built once queried (see getSymbolicRegisterId()) */
+        if (!this->deferredRegisters.empty())
+          const_cast<SymbolicEngine*>(this)->materializeAllRegisters();
+
         for (triton::uint32 it = 0; it < this->numberOfRegisters; it++) {
           if (this->symbolicReg[it] != triton::engines::symbolic::UNSET) {
             triton::arch::Register reg(it);
@@ -653,6 +936,7 @@ namespace triton {
           /* Create the symbolic expression */
           SymbolicExpression* se = this->newSymbolicExpression(tmp, triton::engines::symbolic::REG);
           se->setOriginRegister(reg);
+          this->dropDeferredRegister(parentId);
           this->symbolicReg[parentId] = se->getId();
         }
 
@@ -841,8 +1125,14 @@ namespace triton {
         triton::uint64 address   = mem.getAddress();
         triton::uint32 writeSize = mem.getSize();
 
+        /*
+         * If the symbolic engine is disabled, expressions only live during the
+         * instruction processing (taint-only mode). Thus, the symbolic state is
+         * not updated and nothing has to be restored after the processing.
+         */
+
         /* Record the aligned memory for a symbolic optimization */
-        if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
+        if (this->enableFlag && this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
           this->addAlignedMemory(address, writeSize, node);
 
         /*
@@ -857,7 +1147,8 @@ namespace triton {
           ret.push_back(tmp);
           inst.addSymbolicExpression(se);
           /* Assign memory with little endian */
-          this->addMemoryReference((address + writeSize) - 1, se->getId());
+          if (this->enableFlag)
+            this->addMemoryReference((address + writeSize) - 1, se->getId());
           /* continue */
           writeSize--;
         }
@@ -940,7 +1231,13 @@ namespace triton {
         reg.setConcreteValue(node->evaluate());
         parentReg.setConcreteValue(finalExpr->evaluate());
         triton::engines::symbolic::SymbolicExpression* se = this->newSymbolicExpression(finalExpr, triton::engines::symbolic::REG, comment);
-        this->assignSymbolicExpressionToRegister(se, parentReg);
+
+        /* In the taint-only mode, only the concrete state is synchronized */
+        if (this->enableFlag)
+          this->assignSymbolicExpressionToRegister(se, parentReg);
+        else
+          this->architecture->setConcreteRegisterValue(parentReg);
+
         inst.addSymbolicExpression(se);
         inst.setWrittenRegister(reg, node);
 
@@ -955,7 +1252,13 @@ namespace triton {
 
         flag.setConcreteValue(node->evaluate());
         triton::engines::symbolic::SymbolicExpression *se = this->newSymbolicExpression(node, triton::engines::symbolic::REG, comment);
-        this->assignSymbolicExpressionToRegister(se, flag);
+
+        /* In the taint-only mode, only the concrete state is synchronized */
+        if (this->enableFlag)
+          this->assignSymbolicExpressionToRegister(se, flag);
+        else
+          this->architecture->setConcreteRegisterValue(flag);
+
         inst.addSymbolicExpression(se);
         inst.setWrittenRegister(flag, node);
 
@@ -973,10 +1276,18 @@ namespace triton {
 
       /* Adds and assign a new memory reference */
       void SymbolicEngine::addMemoryReference(triton::uint64 mem, triton::usize id) {
+        this->saveMemoryReference(mem);
         this->memoryReference[mem] = id;
       }
 
 
+      /* Adds a path constraint if the symbolic engine is enabled */
+      void SymbolicEngine::addPathConstraint(const triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* expr) {
+        if (this->enableFlag)
+          triton::engines::symbolic::PathManager::addPathConstraint(inst, expr);
+      }
+
+
       /* Assigns a symbolic expression to a register */
       void SymbolicEngine::assignSymbolicExpressionToRegister(SymbolicExpression *se, const triton::arch::Register& reg) {
         triton::ast::AbstractNode* node = se->getAst();
@@ -993,6 +1304,7 @@ namespace triton {
 
         se->setKind(triton::engines::symbolic::REG);
         se->setOriginRegister(reg);
+        this->dropDeferredRegister(id);
         this->symbolicReg[id] = se->getId();
 
         /* Synchronize the concrete state */
@@ -1000,6 +1312,96 @@ namespace triton {
       }
 
 
+      /* Defers the symbolic expression of a register until it is read */
+      void SymbolicEngine::deferSymbolicRegisterExpression(const triton::arch::Register& reg, DeferredExpression* deferred) {
+        triton::uint32 parentId = reg.getParent().getId();
+
+        /* We can defer an expression only on parent registers */
+        if (reg.getId() != parentId) {
+          delete deferred;
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::deferSymbolicRegisterExpression(): We can defer an expression only on parent registers.");
+        }
+
+        /* Synchronize the concrete state */
+        this->architecture->setConcreteRegisterValue(reg);
+
+        /* In the taint-only mode, only the concrete state is synchronized */
+        if (!this->enableFlag) {
+          delete deferred;
+          return;
+        }
+
+        this->dropDeferredRegister(parentId);
+        this->symbolicReg[parentId] = triton::engines::symbolic::UNSET;
+        this->deferredRegisters[parentId] = deferred;
+      }
+
+
+      /* Builds the symbolic expression of a deferred register */
+      void SymbolicEngine::materializeRegister(triton::uint32 parentId) {
+        auto it = this->deferredRegisters.find(parentId);
+        if (it == this->deferredRegisters.end())
+          return;
+
+        /* The definition is dropped first, the builder may read other registers */
+        DeferredExpression* deferred = it->second;
+        this->deferredRegisters.erase(it);
+
+        SymbolicExpression* se = this->newSymbolicExpression(deferred->buildAst(), triton::engines::symbolic::REG, deferred->getComment());
+        se->isTainted = deferred->isTainted();
+        se->setOriginRegister(triton::arch::Register(parentId));
+        this->symbolicReg[parentId] = se->getId();
+
+        delete deferred;
+      }
+
+
+      /* Builds the symbolic expressions of all deferred registers */
+      void SymbolicEngine::materializeAllRegisters(void) {
+        while (!this->deferredRegisters.empty())
+          this->materializeRegister(this->deferredRegisters.begin()->first);
+      }
+
+
+      /* Drops the deferred definition of a register */
+      void SymbolicEngine::dropDeferredRegister(triton::uint32 parentId) {
+        if (this->deferredRegisters.empty())
+          return;
+
+        auto it = this->deferredRegisters.find(parentId);
+        if (it != this->deferredRegisters.end()) {
+          delete it->second;
+          this->deferredRegisters.erase(it);
+        }
+      }
+
+
+      /* Drops all deferred definitions of a map */
+      void SymbolicEngine::clearDeferredRegisters(std::map<triton::uint32, DeferredExpression*>& registers) {
+        for (auto it = registers.begin(); it != registers.end(); it++)
+          delete it->second;
+        registers.clear();
+      }
+
+
+      /* Copies the deferred definitions of a map */
+      void SymbolicEngine::copyDeferredRegisters(std::map<triton::uint32, DeferredExpression*>& dst, const std::map<triton::uint32, DeferredExpression*>& src) {
+        this->clearDeferredRegisters(dst);
+        for (auto it = src.begin(); it != src.end(); it++) {
+          DeferredExpression* deferred = new(std::nothrow) DeferredExpression(*it->second);
+          if (deferred == nullptr)
+            throw triton::exceptions::SymbolicEngine("SymbolicEngine::copyDeferredRegisters(): Not enough memory.");
+          dst[it->first] = deferred;
+        }
+      }
+
+
+      /* Returns true if the flags are lazy */
+      bool SymbolicEngine::isLazyFlags(void) const {
+        return this->modes->isModeEnabled(triton::modes::LAZY_FLAGS);
+      }
+
+
       /* Assigns a symbolic expression to a memory */
       void SymbolicEngine::assignSymbolicExpressionToMemory(SymbolicExpression *se, const triton::arch::MemoryAccess& mem) {
         triton::ast::AbstractNode* node = se->getAst();
@@ -1072,6 +1474,11 @@ namespace triton {
 
       /* Returns true if the register expression contains a symbolic variable. */
       bool SymbolicEngine::isRegisterSymbolized(const triton::arch::Register& reg) const {
+        /* A deferred register is not built for this query */
+        auto deferred = this->deferredRegisters.find(reg.getParent().getId());
+        if (deferred != this->deferredRegisters.end())
+          return deferred->second->isSymbolized();
+
         triton::usize symId = this->getSymbolicRegisterId(reg);
 
         if (symId == triton::engines::symbolic::UNSET)
@@ -1088,6 +1495,100 @@ namespace triton {
       }
 
 
+      /* Takes a snapshot of the symbolic state */
+      void SymbolicEngine::takeSnapshot(void) {
+        this->discardSnapshot();
+
+        triton::engines::symbolic::PathManager::takeSnapshot();
+        this->snapshotReg.assign(this->symbolicReg, this->symbolicReg + this->numberOfRegisters);
+        this->copyDeferredRegisters(this->snapshotDeferredRegisters, this->deferredRegisters);
+        this->snapshotSymExprId = this->uniqueSymExprId;
+        this->snapshotFlag      = true;
+      }
+
+
+      /* Restores the symbolic state of the snapshot */
+      void SymbolicEngine::restoreSnapshot(void) {
+        if (this->snapshotFlag == false)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::restoreSnapshot(): No snapshot taken.");
+
+        triton::engines::symbolic::PathManager::restoreSnapshot();
+
+        /* Restore symbolic registers */
+        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
+          this->symbolicReg[i] = this->snapshotReg[i];
+        this->clearDeferredRegisters(this->deferredRegisters);
+        this->copyDeferredRegisters(this->deferredRegisters, this->snapshotDeferredRegisters);
+
+        /* Restore the modified memory references */
+        for (auto it = this->snapshotMemoryReference.begin(); it != this->snapshotMemoryReference.end(); it++) {
+          if (it->second == triton::engines::symbolic::UNSET)
+            this->memoryReference.erase(it->first);
+          else
+            this->memoryReference[it->first] = it->second;
+        }
+        this->snapshotMemoryReference.clear();
+
+        /* Restore the modified aligned memory, the references of the snapshot are moved back */
+        for (auto it = this->snapshotAlignedMemory.begin(); it != this->snapshotAlignedMemory.end(); it++) {
+          auto current = this->alignedMemoryReference.find(it->first);
+          if (current != this->alignedMemoryReference.end()) {
+            current->second->decRefCount();
+            this->alignedMemoryReference.erase(current);
+          }
+          if (it->second != nullptr)
+            this->alignedMemoryReference[it->first] = it->second;
+        }
+        this->snapshotAlignedMemory.clear();
+
+        /* Delete the expressions created since the snapshot */
+        for (auto it = this->symbolicExpressions.lower_bound(this->snapshotSymExprId); it != this->symbolicExpressions.end();) {
+          auto memo = this->fullAsts.find(it->first);
+          if (memo != this->fullAsts.end()) {
+            memo->second->decRefCount();
+            this->fullAsts.erase(memo);
+          }
+          delete it->second;
+          this->symbolicExpressions.erase(it++);
+        }
+
+        /* Bring back the expressions removed since the snapshot */
+        for (auto it = this->snapshotRemovedExpressions.begin(); it != this->snapshotRemovedExpressions.end(); it++)
+          this->symbolicExpressions[it->first] = it->second;
+        this->snapshotRemovedExpressions.clear();
+      }
+
+
+      /* Discards the snapshot */
+      void SymbolicEngine::discardSnapshot(void) {
+        if (this->snapshotFlag == false)
+          return;
+
+        triton::engines::symbolic::PathManager::discardSnapshot();
+
+        for (auto it = this->snapshotAlignedMemory.begin(); it != this->snapshotAlignedMemory.end(); it++) {
+          if (it->second != nullptr)
+            it->second->decRefCount();
+        }
+
+        for (auto it = this->snapshotRemovedExpressions.begin(); it != this->snapshotRemovedExpressions.end(); it++)
+          delete it->second;
+
+        this->clearDeferredRegisters(this->snapshotDeferredRegisters);
+        this->snapshotAlignedMemory.clear();
+        this->snapshotMemoryReference.clear();
+        this->snapshotRemovedExpressions.clear();
+        this->snapshotReg.clear();
+        this->snapshotFlag = false;
+      }
+
+
+      /* Returns true if a snapshot is taken */
+      bool SymbolicEngine::isSnapshotEnabled(void) const {
+        return this->snapshotFlag;
+      }
+
+
       /* Initializes the memory access AST (LOAD and STORE) */
       void SymbolicEngine::initLeaAst(triton::arch::MemoryAccess& mem, bool force) {
         if (mem.getBitSize() >= BYTE_SIZE_BIT) {
@@ -5,6 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <triton/api.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/symbolicExpression.hpp>
@@ -21,10 +22,15 @@ namespace triton {
         this->id            = id;
         this->isTainted     = false;
         this->kind          = kind;
+
+        if (this->ast != nullptr)
+          this->ast->incRefCount();
       }
 
 
       SymbolicExpression::~SymbolicExpression() {
+        if (this->ast != nullptr)
+          this->ast->decRefCount();
       }
 
 
@@ -53,10 +59,10 @@ namespace triton {
 
 
       std::string SymbolicExpression::getFormattedId(void) const {
-        if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::SMT_REPRESENTATION)
+        if (this->ast->getApi()->getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
           return "ref!" + std::to_string(this->id);
 
-        else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::PYTHON_REPRESENTATION)
+        else if (this->ast->getApi()->getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
           return "ref_" + std::to_string(this->id);
 
         else
@@ -68,10 +74,10 @@ namespace triton {
         if (this->getComment().empty())
           return "";
 
-        else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::SMT_REPRESENTATION)
+        else if (this->ast->getApi()->getAstRepresentationMode() == triton::ast::representations::SMT_REPRESENTATION)
           return "; " + this->getComment();
 
-        else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::PYTHON_REPRESENTATION)
+        else if (this->ast->getApi()->getAstRepresentationMode() == triton::ast::representations::PYTHON_REPRESENTATION)
           return "# " + this->getComment();
 
         else
@@ -96,8 +102,13 @@ namespace triton {
 
       void SymbolicExpression::setAst(triton::ast::AbstractNode* node) {
         node->setParent(this->ast->getParents());
+        node->incRefCount();
+        this->ast->decRefCount();
         this->ast = node;
         this->ast->init();
+
+        /* Translations of the references to this expression are outdated */
+        this->ast->getApi()->getSymbolicEngine()->incAstRevision();
       }
 
 
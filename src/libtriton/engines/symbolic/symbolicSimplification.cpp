@@ -5,6 +5,10 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include <triton/exceptions.hpp>
 #include <triton/symbolicSimplification.hpp>
 
@@ -107,6 +111,25 @@ if __name__ == "__main__":
     print 'Simp: ', c
 ~~~~~~~~~~~~~
 
+\subsection SMT_simplification_builtin Simplification via the built-in rules
+<hr>
+
+When the triton::modes::AST_SIMPLIFICATION mode is enabled, Triton rewrites each new symbolic expression with
+built-in C++ rules before the recorded callbacks. The rules are applied from the leaves to the root:
+
+- Constant subtrees are folded into a bitvector node. References are not folded, they may be symbolized later.
+- Identities like \f$ x \oplus x \rightarrow 0 \f$, \f$ x \land 0 \rightarrow 0 \f$, \f$ x + 0 \rightarrow x \f$ or \f$ \lnot \lnot x \rightarrow x \f$.
+- Extractions of a concatenation, of an extension or of another extraction, and chains of extensions.
+- Constants of associative operations are combined (\f$ (x + 1) + 2 \rightarrow x + 3 \f$).
+- The constant operand of a commutative operation is moved on the right.
+
+~~~~~~~~~~~~~{.py}
+>>> enableMode(MODE.AST_SIMPLIFICATION, True)
+>>> a = variable(newSymbolicVariable(32))
+>>> print simplify(extract(7, 0, concat([bv(1, 8), (bv(2, 32) + a) + bv(3, 32)])))
+((_ extract 7 0) (bvadd SymVar_0 (_ bv5 32)))
+~~~~~~~~~~~~~
+
 \subsection SMT_simplification_z3 Simplification via Z3
 <hr>
 
@@ -160,8 +183,127 @@ namespace triton {
     namespace symbolic {
 
 
-      SymbolicSimplification::SymbolicSimplification(triton::callbacks::Callbacks* callbacks) {
+      /* Returns true if the value of the node can be folded into a bitvector node */
+      static bool isBitvectorOperator(triton::ast::kind_e kind) {
+        switch (kind) {
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVASHR_NODE:
+          case triton::ast::BVLSHR_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNEG_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVNOT_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVROL_NODE:
+          case triton::ast::BVROR_NODE:
+          case triton::ast::BVSDIV_NODE:
+          case triton::ast::BVSHL_NODE:
+          case triton::ast::BVSMOD_NODE:
+          case triton::ast::BVSREM_NODE:
+          case triton::ast::BVSUB_NODE:
+          case triton::ast::BVUDIV_NODE:
+          case triton::ast::BVUREM_NODE:
+          case triton::ast::BVXNOR_NODE:
+          case triton::ast::BVXOR_NODE:
+          case triton::ast::CONCAT_NODE:
+          case triton::ast::EXTRACT_NODE:
+          case triton::ast::SX_NODE:
+          case triton::ast::ZX_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      /* Returns true if the operands of the node can be swapped */
+      static bool isCommutative(triton::ast::kind_e kind) {
+        switch (kind) {
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVXNOR_NODE:
+          case triton::ast::BVXOR_NODE:
+          case triton::ast::DISTINCT_NODE:
+          case triton::ast::EQUAL_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      /* Returns true if the node is a constant (bitvector or decimal node) */
+      static bool isConstant(triton::ast::AbstractNode* node) {
+        return node->getKind() == triton::ast::BV_NODE || node->getKind() == triton::ast::DECIMAL_NODE;
+      }
+
+
+      /* Returns true if the node is the bitvector constant `value` */
+      static bool isConstant(triton::ast::AbstractNode* node, triton::uint512 value) {
+        return node->getKind() == triton::ast::BV_NODE && node->evaluate() == value;
+      }
+
+
+      /* Returns true if the node is a bitvector constant with all bits set */
+      static bool isOnes(triton::ast::AbstractNode* node) {
+        return node->getKind() == triton::ast::BV_NODE && node->evaluate() == node->getBitvectorMask();
+      }
+
+
+      /* Returns the value of a decimal child */
+      static triton::uint32 getDecimal(triton::ast::AbstractNode* node) {
+        return reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue().convert_to<triton::uint32>();
+      }
+
+
+      /* Returns true if both nodes are the same without walking the trees */
+      static bool isSameNode(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2) {
+        if (node1 == node2)
+          return true;
+
+        if (node1->getKind() != node2->getKind() || node1->getBitvectorSize() != node2->getBitvectorSize())
+          return false;
+
+        switch (node1->getKind()) {
+          case triton::ast::BV_NODE:
+            return node1->evaluate() == node2->evaluate();
+          case triton::ast::REFERENCE_NODE:
+            return reinterpret_cast<triton::ast::ReferenceNode*>(node1)->getValue() == reinterpret_cast<triton::ast::ReferenceNode*>(node2)->getValue();
+          case triton::ast::VARIABLE_NODE:
+            return reinterpret_cast<triton::ast::VariableNode*>(node1)->getValue() == reinterpret_cast<triton::ast::VariableNode*>(node2)->getValue();
+          default:
+            return false;
+        }
+      }
+
+
+      /* Combines two constants of an associative operation */
+      static triton::ast::AbstractNode* combine(triton::ast::kind_e kind, triton::ast::AbstractNode* c1, triton::ast::AbstractNode* c2) {
+        triton::uint512 value = 0;
+
+        switch (kind) {
+          case triton::ast::BVADD_NODE: value = c1->evaluate() + c2->evaluate(); break;
+          case triton::ast::BVAND_NODE: value = c1->evaluate() & c2->evaluate(); break;
+          case triton::ast::BVMUL_NODE: value = c1->evaluate() * c2->evaluate(); break;
+          case triton::ast::BVOR_NODE:  value = c1->evaluate() | c2->evaluate(); break;
+          case triton::ast::BVXOR_NODE: value = c1->evaluate() ^ c2->evaluate(); break;
+          default:
+            return nullptr;
+        }
+
+        return triton::ast::bv(value & c1->getBitvectorMask(), c1->getBitvectorSize());
+      }
+
+
+      SymbolicSimplification::SymbolicSimplification(triton::callbacks::Callbacks* callbacks, triton::modes::Modes* modes) {
         this->callbacks = callbacks;
+        this->modes     = modes;
       }
 
 
@@ -176,6 +318,7 @@ namespace triton {
 
       void SymbolicSimplification::copy(const SymbolicSimplification& other) {
         this->callbacks = other.callbacks;
+        this->modes     = other.modes;
       }
 
 
@@ -183,6 +326,10 @@ namespace triton {
         if (node == nullptr)
           throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::processSimplification(): node cannot be null.");
 
+        /* process the built-in rules */
+        if (this->modes && this->modes->isModeEnabled(triton::modes::AST_SIMPLIFICATION))
+          node = this->simplify(node);
+
         /* process recorded callback about symbolic simplifications */
         if (this->callbacks)
           node = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, node);
@@ -191,6 +338,244 @@ namespace triton {
       }
 
 
+      triton::ast::AbstractNode* SymbolicSimplification::simplify(triton::ast::AbstractNode* node) const {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> simplified;
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+
+        if (node == nullptr)
+          throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::simplify(): node cannot be null.");
+
+        /* Post-order walk, the second item is true once the childs are pushed */
+        worklist.push_back(std::make_pair(node, false));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back().first;
+          triton::ast::AstChildList& childs  = current->getChilds();
+
+          if (simplified.find(current) != simplified.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          if (!worklist.back().second) {
+            worklist.back().second = true;
+            for (auto it = childs.begin(); it != childs.end(); it++) {
+              if (simplified.find(*it) == simplified.end())
+                worklist.push_back(std::make_pair(*it, false));
+            }
+            continue;
+          }
+
+          worklist.pop_back();
+
+          triton::ast::AstChildList newChilds;
+          bool changed = false;
+          for (auto it = childs.begin(); it != childs.end(); it++) {
+            triton::ast::AbstractNode* child = simplified[*it];
+            changed |= (child != *it);
+            newChilds.push_back(child);
+          }
+
+          triton::ast::AbstractNode* result = changed ? triton::ast::newInstance(current, newChilds) : current;
+
+          /* Each rule returns a smaller or a normalized node, apply them until nothing changes */
+          for (triton::ast::AbstractNode* next = this->applyRules(result); next != result; next = this->applyRules(result))
+            result = next;
+
+          simplified[current] = result;
+        }
+
+        return simplified[node];
+      }
+
+
+      triton::ast::AbstractNode* SymbolicSimplification::applyRules(triton::ast::AbstractNode* node) const {
+        triton::ast::AstChildList& childs = node->getChilds();
+        triton::ast::kind_e kind          = node->getKind();
+        triton::uint32 size               = node->getBitvectorSize();
+
+        if (childs.empty())
+          return node;
+
+        /* Constant folding */
+        if (isBitvectorOperator(kind)) {
+          bool constant = true;
+          for (auto it = childs.begin(); it != childs.end() && constant; it++)
+            constant = isConstant(*it);
+          if (constant)
+            return triton::ast::bv(node->evaluate(), size);
+        }
+
+        switch (kind) {
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVXOR_NODE:
+            if (isConstant(childs[0], 0))
+              return childs[1];
+            if (isConstant(childs[1], 0))
+              return childs[0];
+            if (kind == triton::ast::BVOR_NODE && isSameNode(childs[0], childs[1]))
+              return childs[0];
+            if (kind == triton::ast::BVOR_NODE && (isOnes(childs[0]) || isOnes(childs[1])))
+              return triton::ast::bv(node->getBitvectorMask(), size);
+            if (kind == triton::ast::BVXOR_NODE && isSameNode(childs[0], childs[1]))
+              return triton::ast::bv(0, size);
+            break;
+
+          case triton::ast::BVSUB_NODE:
+            if (isConstant(childs[1], 0))
+              return childs[0];
+            if (isSameNode(childs[0], childs[1]))
+              return triton::ast::bv(0, size);
+            break;
+
+          case triton::ast::BVAND_NODE:
+            if (isConstant(childs[0], 0) || isConstant(childs[1], 0))
+              return triton::ast::bv(0, size);
+            if (isOnes(childs[0]))
+              return childs[1];
+            if (isOnes(childs[1]) || isSameNode(childs[0], childs[1]))
+              return childs[0];
+            break;
+
+          case triton::ast::BVMUL_NODE:
+            if (isConstant(childs[0], 0) || isConstant(childs[1], 0))
+              return triton::ast::bv(0, size);
+            if (isConstant(childs[0], 1))
+              return childs[1];
+            if (isConstant(childs[1], 1))
+              return childs[0];
+            break;
+
+          case triton::ast::BVSHL_NODE:
+          case triton::ast::BVLSHR_NODE:
+          case triton::ast::BVASHR_NODE:
+            if (isConstant(childs[1], 0))
+              return childs[0];
+            break;
+
+          case triton::ast::BVROL_NODE:
+          case triton::ast::BVROR_NODE:
+            if (size && getDecimal(childs[0]) % size == 0)
+              return childs[1];
+            break;
+
+          case triton::ast::BVNOT_NODE:
+          case triton::ast::BVNEG_NODE:
+            if (childs[0]->getKind() == kind)
+              return childs[0]->getChilds()[0];
+            break;
+
+          case triton::ast::EXTRACT_NODE: {
+            triton::uint32 high         = getDecimal(childs[0]);
+            triton::uint32 low          = getDecimal(childs[1]);
+            triton::ast::AbstractNode* expr = childs[2];
+
+            if (low == 0 && high + 1 == expr->getBitvectorSize())
+              return expr;
+
+            switch (expr->getKind()) {
+              /* ((_ extract h l) ((_ extract h' l') x)) -> ((_ extract h+l' l+l') x) */
+              case triton::ast::EXTRACT_NODE: {
+                triton::uint32 offset = getDecimal(expr->getChilds()[1]);
+                return triton::ast::extract(high + offset, low + offset, expr->getChilds()[2]);
+              }
+
+              /* Extraction of a single operand of a concatenation */
+              case triton::ast::CONCAT_NODE: {
+                triton::ast::AstChildList& parts = expr->getChilds();
+                triton::uint32 offset = 0;
+                for (triton::uint32 index = parts.size(); index > 0; index--) {
+                  triton::ast::AbstractNode* part = parts[index - 1];
+                  triton::uint32 partSize = part->getBitvectorSize();
+                  if (low >= offset && high < offset + partSize)
+                    return triton::ast::extract(high - offset, low - offset, part);
+                  offset += partSize;
+                }
+                break;
+              }
+
+              case triton::ast::ZX_NODE: {
+                triton::ast::AbstractNode* origin = expr->getChilds()[1];
+                if (high < origin->getBitvectorSize())
+                  return triton::ast::extract(high, low, origin);
+                if (low >= origin->getBitvectorSize())
+                  return triton::ast::bv(0, size);
+                break;
+              }
+
+              case triton::ast::SX_NODE: {
+                triton::ast::AbstractNode* origin = expr->getChilds()[1];
+                if (high < origin->getBitvectorSize())
+                  return triton::ast::extract(high, low, origin);
+                break;
+              }
+
+              default:
+                break;
+            }
+            break;
+          }
+
+          case triton::ast::ZX_NODE:
+          case triton::ast::SX_NODE: {
+            triton::uint32 sizeExt          = getDecimal(childs[0]);
+            triton::ast::AbstractNode* expr = childs[1];
+
+            if (sizeExt == 0)
+              return expr;
+
+            /* The sign bit of a zero extension is 0 */
+            if (expr->getKind() == triton::ast::ZX_NODE)
+              return triton::ast::zx(sizeExt + getDecimal(expr->getChilds()[0]), expr->getChilds()[1]);
+
+            if (kind == triton::ast::SX_NODE && expr->getKind() == triton::ast::SX_NODE)
+              return triton::ast::sx(sizeExt + getDecimal(expr->getChilds()[0]), expr->getChilds()[1]);
+            break;
+          }
+
+          case triton::ast::ITE_NODE: {
+            /* The condition is a comparison of constants */
+            triton::ast::AstChildList& operands = childs[0]->getChilds();
+            bool constant = !operands.empty();
+            for (auto it = operands.begin(); it != operands.end() && constant; it++)
+              constant = (*it)->getKind() == triton::ast::BV_NODE;
+            if (constant)
+              return childs[0]->evaluate() ? childs[1] : childs[2];
+            if (isSameNode(childs[1], childs[2]))
+              return childs[1];
+            break;
+          }
+
+          default:
+            break;
+        }
+
+        if (childs.size() != 2)
+          return node;
+
+        /* Combine the constants of associative operations: ((x op c1) op c2) -> (x op (c1 op c2)) */
+        if (childs[1]->getKind() == triton::ast::BV_NODE && childs[0]->getKind() == kind && childs[0]->getChilds()[1]->getKind() == triton::ast::BV_NODE) {
+          triton::ast::AbstractNode* constant = combine(kind, childs[0]->getChilds()[1], childs[1]);
+          if (constant != nullptr) {
+            triton::ast::AstChildList newChilds;
+            newChilds.push_back(childs[0]->getChilds()[0]);
+            newChilds.push_back(constant);
+            return triton::ast::newInstance(node, newChilds);
+          }
+        }
+
+        /* Normalize commutative operations, the constant goes on the right */
+        if (isCommutative(kind) && childs[0]->getKind() == triton::ast::BV_NODE && childs[1]->getKind() != triton::ast::BV_NODE) {
+          triton::ast::AstChildList newChilds;
+          newChilds.push_back(childs[1]);
+          newChilds.push_back(childs[0]);
+          return triton::ast::newInstance(node, newChilds);
+        }
+
+        return node;
+      }
+
+
       void SymbolicSimplification::operator=(const SymbolicSimplification& other) {
         this->copy(other);
       }
@@ -0,0 +1,312 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include <triton/taintBitmap.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      /* Number of bits in a word of the bitmap */
+      static const triton::usize WORD_BITS = QWORD_SIZE_BIT;
+
+      /* Number of words in a page of the bitmap */
+      static const triton::usize PAGE_WORDS = MEMORY_PAGE_SIZE / WORD_BITS;
+
+
+      /* Returns the base address of the page which contains the address */
+      static inline triton::uint64 pageBase(triton::uint64 addr) {
+        return addr & ~static_cast<triton::uint64>(MEMORY_PAGE_SIZE - 1);
+      }
+
+
+      /* Returns the number of bytes of the range [baseAddr:size] before the end of the address space */
+      static inline triton::usize headSize(triton::uint64 baseAddr, triton::usize size) {
+        if (baseAddr == 0 || size - 1 <= std::numeric_limits<triton::uint64>::max() - baseAddr)
+          return size;
+        return static_cast<triton::usize>(0 - baseAddr);
+      }
+
+
+      /* Returns the mask of the bits [first:last] of the word `index` */
+      static inline triton::uint64 wordMask(triton::usize index, triton::usize first, triton::usize last) {
+        triton::uint64 mask = ~static_cast<triton::uint64>(0);
+
+        if (index == first / WORD_BITS)
+          mask &= mask << (first % WORD_BITS);
+
+        if (index == last / WORD_BITS)
+          mask &= ~static_cast<triton::uint64>(0) >> (WORD_BITS - 1 - (last % WORD_BITS));
+
+        return mask;
+      }
+
+
+      /* Adds `count` tainted bytes at `addr` to the spans, merging contiguous spans */
+      static inline void addRange(std::map<triton::uint64, triton::usize>& ranges, triton::uint64 addr, triton::usize count) {
+        if (!ranges.empty()) {
+          auto prev = std::prev(ranges.end());
+          if (prev->first + prev->second == addr) {
+            prev->second += count;
+            return;
+          }
+        }
+        ranges.emplace_hint(ranges.end(), addr, count);
+      }
+
+
+      /* Adds the tainted bytes [first:last] of a page to the spans */
+      static void collectRanges(std::map<triton::uint64, triton::usize>& ranges, triton::uint64 base, const std::vector<triton::uint64>& bits, triton::usize first, triton::usize last) {
+        for (triton::usize index = first / WORD_BITS; index <= last / WORD_BITS; index++) {
+          triton::uint64 mask = wordMask(index, first, last);
+          triton::uint64 word = bits[index] & mask;
+
+          /* Fast path - the whole word is tainted */
+          if (word == mask && mask == ~static_cast<triton::uint64>(0)) {
+            addRange(ranges, base + (index * WORD_BITS), WORD_BITS);
+            continue;
+          }
+
+          for (triton::usize bit = 0; word; bit++, word >>= 1) {
+            if (word & 1)
+              addRange(ranges, base + (index * WORD_BITS) + bit, BYTE_SIZE);
+          }
+        }
+      }
+
+
+      TaintBitmap::TaintBitmap() {
+        this->snapshotFlag = false;
+      }
+
+
+      TaintBitmap::TaintBitmap(const TaintBitmap& other) {
+        this->copy(other);
+      }
+
+
+      TaintBitmap::~TaintBitmap() {
+      }
+
+
+      void TaintBitmap::operator=(const TaintBitmap& other) {
+        this->discardSnapshot();
+        this->copy(other);
+      }
+
+
+      /* The snapshot is not copied */
+      void TaintBitmap::copy(const TaintBitmap& other) {
+        this->pages        = other.pages;
+        this->snapshotFlag = false;
+      }
+
+
+      void TaintBitmap::savePage(triton::uint64 base) {
+        if (this->snapshotFlag == false)
+          return;
+
+        auto it = this->journal.lower_bound(base);
+        if (it != this->journal.end() && it->first == base)
+          return;
+
+        auto page = this->pages.find(base);
+        if (page == this->pages.end())
+          this->journal.emplace_hint(it, base, std::vector<triton::uint64>());
+        else
+          this->journal.emplace_hint(it, base, page->second);
+      }
+
+
+      bool TaintBitmap::isTainted(triton::uint64 baseAddr, triton::usize size) const {
+        triton::usize head = headSize(baseAddr, size);
+
+        if (size == 0)
+          return false;
+
+        /* The range wraps around the address space, check its two parts */
+        if (head != size)
+          return this->isTainted(baseAddr, head) || this->isTainted(0, size - head);
+
+        triton::uint64 lastAddr = baseAddr + (size - 1);
+        auto it  = this->pages.lower_bound(pageBase(baseAddr));
+        auto end = this->pages.upper_bound(pageBase(lastAddr));
+
+        /* Only allocated pages can hold tainted bytes */
+        for (; it != end; it++) {
+          triton::usize first = std::max(baseAddr, it->first) - it->first;
+          triton::usize last  = std::min(lastAddr, it->first + (MEMORY_PAGE_SIZE - 1)) - it->first;
+
+          for (triton::usize index = first / WORD_BITS; index <= last / WORD_BITS; index++) {
+            if (it->second[index] & wordMask(index, first, last))
+              return true;
+          }
+        }
+
+        return false;
+      }
+
+
+      void TaintBitmap::setTaint(triton::uint64 baseAddr, triton::usize size, bool flag) {
+        triton::usize head = headSize(baseAddr, size);
+
+        if (size == 0)
+          return;
+
+        /* The range wraps around the address space, set its two parts */
+        if (head != size) {
+          this->setTaint(baseAddr, head, flag);
+          this->setTaint(0, size - head, flag);
+          return;
+        }
+
+        triton::uint64 lastAddr = baseAddr + (size - 1);
+
+        /* Untaint - only allocated pages are concerned */
+        if (flag == false) {
+          auto it  = this->pages.lower_bound(pageBase(baseAddr));
+          auto end = this->pages.upper_bound(pageBase(lastAddr));
+
+          while (it != end) {
+            triton::usize first = std::max(baseAddr, it->first) - it->first;
+            triton::usize last  = std::min(lastAddr, it->first + (MEMORY_PAGE_SIZE - 1)) - it->first;
+            bool empty          = true;
+
+            this->savePage(it->first);
+
+            for (triton::usize index = first / WORD_BITS; index <= last / WORD_BITS; index++)
+              it->second[index] &= ~wordMask(index, first, last);
+
+            for (triton::usize index = 0; index < PAGE_WORDS && empty; index++)
+              empty = (it->second[index] == 0);
+
+            /* Release the page if there is no more tainted byte */
+            if (empty)
+              this->pages.erase(it++);
+            else
+              it++;
+          }
+          return;
+        }
+
+        /* Taint - pages are allocated on demand */
+        for (triton::uint64 base = pageBase(baseAddr); ; base += MEMORY_PAGE_SIZE) {
+          this->savePage(base);
+
+          std::vector<triton::uint64>& bits = this->pages[base];
+          triton::usize first = std::max(baseAddr, base) - base;
+          triton::usize last  = std::min(lastAddr, base + (MEMORY_PAGE_SIZE - 1)) - base;
+
+          if (bits.empty())
+            bits.resize(PAGE_WORDS, 0);
+
+          for (triton::usize index = first / WORD_BITS; index <= last / WORD_BITS; index++)
+            bits[index] |= wordMask(index, first, last);
+
+          if (base == pageBase(lastAddr))
+            break;
+        }
+      }
+
+
+      void TaintBitmap::clear(void) {
+        for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+          if (this->snapshotFlag && this->journal.find(it->first) == this->journal.end())
+            this->journal.emplace(it->first, std::move(it->second));
+        }
+        this->pages.clear();
+      }
+
+
+      std::set<triton::uint64> TaintBitmap::getTaintedAddresses(void) const {
+        std::set<triton::uint64> addresses;
+
+        for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+          for (triton::usize index = 0; index < PAGE_WORDS; index++) {
+            triton::uint64 word = it->second[index];
+            for (triton::usize bit = 0; word; bit++, word >>= 1) {
+              if (word & 1)
+                addresses.insert(it->first + (index * WORD_BITS) + bit);
+            }
+          }
+        }
+
+        return addresses;
+      }
+
+
+      std::map<triton::uint64, triton::usize> TaintBitmap::getTaintedRanges(triton::uint64 baseAddr, triton::usize size) const {
+        std::map<triton::uint64, triton::usize> ranges;
+        triton::usize head = headSize(baseAddr, size);
+
+        if (size == 0)
+          return ranges;
+
+        /* The range wraps around the address space, collect its two parts */
+        if (head != size) {
+          ranges = this->getTaintedRanges(0, size - head);
+          auto top = this->getTaintedRanges(baseAddr, head);
+          ranges.insert(top.begin(), top.end());
+          return ranges;
+        }
+
+        triton::uint64 lastAddr = baseAddr + (size - 1);
+        auto it  = this->pages.lower_bound(pageBase(baseAddr));
+        auto end = this->pages.upper_bound(pageBase(lastAddr));
+
+        for (; it != end; it++) {
+          triton::usize first = std::max(baseAddr, it->first) - it->first;
+          triton::usize last  = std::min(lastAddr, it->first + (MEMORY_PAGE_SIZE - 1)) - it->first;
+          collectRanges(ranges, it->first, it->second, first, last);
+        }
+
+        return ranges;
+      }
+
+
+      std::map<triton::uint64, triton::usize> TaintBitmap::getTaintedRanges(void) const {
+        std::map<triton::uint64, triton::usize> ranges;
+
+        for (auto it = this->pages.begin(); it != this->pages.end(); it++)
+          collectRanges(ranges, it->first, it->second, 0, MEMORY_PAGE_SIZE - 1);
+
+        return ranges;
+      }
+
+
+      void TaintBitmap::takeSnapshot(void) {
+        this->journal.clear();
+        this->snapshotFlag = true;
+      }
+
+
+      void TaintBitmap::restoreSnapshot(void) {
+        for (auto it = this->journal.begin(); it != this->journal.end(); it++) {
+          /* The page was not allocated */
+          if (it->second.empty())
+            this->pages.erase(it->first);
+          else
+            this->pages[it->first] = std::move(it->second);
+        }
+        this->journal.clear();
+      }
+
+
+      void TaintBitmap::discardSnapshot(void) {
+        this->journal.clear();
+        this->snapshotFlag = false;
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -118,14 +118,18 @@ namespace triton {
 
         this->symbolicEngine = symbolicEngine;
         this->enableFlag     = true;
+        this->snapshotFlag   = false;
       }
 
 
+      /* The snapshot is not copied */
       void TaintEngine::copy(const TaintEngine& other) {
         this->enableFlag       = other.enableFlag;
+        this->snapshotFlag     = false;
         this->symbolicEngine   = other.symbolicEngine;
         this->taintedMemory    = other.taintedMemory;
         this->taintedRegisters = other.taintedRegisters;
+        this->snapshotRegisters.clear();
       }
 
 
@@ -154,8 +158,20 @@ namespace triton {
 
 
       /* Returns the tainted addresses */
-      const std::set<triton::uint64>& TaintEngine::getTaintedMemory(void) const {
-        return this->taintedMemory;
+      std::set<triton::uint64> TaintEngine::getTaintedMemory(void) const {
+        return this->taintedMemory.getTaintedAddresses();
+      }
+
+
+      /* Returns the tainted spans which intersect the range */
+      std::map<triton::uint64, triton::usize> TaintEngine::getTaintedMemoryRanges(triton::uint64 baseAddr, triton::usize size) const {
+        return this->taintedMemory.getTaintedRanges(baseAddr, size);
+      }
+
+
+      /* Returns all tainted spans */
+      std::map<triton::uint64, triton::usize> TaintEngine::getTaintedMemoryRanges(void) const {
+        return this->taintedMemory.getTaintedRanges();
       }
 
 
@@ -167,26 +183,13 @@ namespace triton {
 
       /* Returns true of false if the memory address is currently tainted */
       bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
-
-        return !TAINTED;
+        return this->taintedMemory.isTainted(mem.getAddress(), mem.getSize());
       }
 
 
       /* Returns true of false if the address is currently tainted */
-      bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
-
-        return !TAINTED;
+      bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::usize size) const {
+        return this->taintedMemory.isTainted(addr, size);
       }
 
 
@@ -283,52 +286,69 @@ namespace triton {
 
       /* Taint the memory */
       bool TaintEngine::taintMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
-        if (!this->isEnabled())
-          return this->isMemoryTainted(mem);
-
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.insert(addr+index);
-
-        return TAINTED;
+        return this->taintMemoryArea(mem.getAddress(), mem.getSize());
       }
 
 
       /* Taint the address */
       bool TaintEngine::taintMemory(triton::uint64 addr) {
+        return this->taintMemoryArea(addr, BYTE_SIZE);
+      }
+
+
+      /* Taint the range */
+      bool TaintEngine::taintMemoryArea(triton::uint64 baseAddr, triton::usize size) {
         if (!this->isEnabled())
-          return this->isMemoryTainted(addr);
-        this->taintedMemory.insert(addr);
+          return this->isMemoryTainted(baseAddr, size);
+        this->taintedMemory.setTaint(baseAddr, size, TAINTED);
         return TAINTED;
       }
 
 
       /* Untaint the memory */
       bool TaintEngine::untaintMemory(const triton::arch::MemoryAccess& mem) {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
-        if (!this->isEnabled())
-          return this->isMemoryTainted(mem);
-
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.erase(addr+index);
-
-        return !TAINTED;
+        return this->untaintMemoryArea(mem.getAddress(), mem.getSize());
       }
 
 
       /* Untaint the address */
       bool TaintEngine::untaintMemory(triton::uint64 addr) {
+        return this->untaintMemoryArea(addr, BYTE_SIZE);
+      }
+
+
+      /* Untaint the range */
+      bool TaintEngine::untaintMemoryArea(triton::uint64 baseAddr, triton::usize size) {
         if (!this->isEnabled())
-          return this->isMemoryTainted(addr);
-        this->taintedMemory.erase(addr);
+          return this->isMemoryTainted(baseAddr, size);
+        this->taintedMemory.setTaint(baseAddr, size, !TAINTED);
         return !TAINTED;
       }
 
 
+      void TaintEngine::takeSnapshot(void) {
+        this->taintedMemory.takeSnapshot();
+        this->snapshotRegisters = this->taintedRegisters;
+        this->snapshotFlag      = true;
+      }
+
+
+      void TaintEngine::restoreSnapshot(void) {
+        if (this->snapshotFlag == false)
+          throw triton::exceptions::TaintEngine("TaintEngine::restoreSnapshot(): No snapshot taken.");
+
+        this->taintedMemory.restoreSnapshot();
+        this->taintedRegisters = this->snapshotRegisters;
+      }
+
+
+      void TaintEngine::discardSnapshot(void) {
+        this->taintedMemory.discardSnapshot();
+        this->snapshotRegisters.clear();
+        this->snapshotFlag = false;
+      }
+
+
       /* Abstract union tainting */
       bool TaintEngine::taintUnion(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2) {
         triton::uint32 t1 = op1.getType();
@@ -584,6 +604,12 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
 
+        /* Fast path - the whole source is untainted */
+        if (!this->isMemoryTainted(addrSrc, readSize)) {
+          this->untaintMemoryArea(addrDst, readSize);
+          return !TAINTED;
+        }
+
         for (triton::uint32 offset = 0; offset < readSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
             this->taintMemory(addrDst+offset);
@@ -656,10 +682,12 @@ namespace triton {
           return this->isMemoryTainted(memDst);
 
         /* Check source */
-        for (triton::uint32 offset = 0; offset < writeSize; offset++) {
-          if (this->isMemoryTainted(addrSrc+offset)) {
-            this->taintMemory(addrDst+offset);
-            tainted = TAINTED;
+        if (this->isMemoryTainted(addrSrc, writeSize)) {
+          for (triton::uint32 offset = 0; offset < writeSize; offset++) {
+            if (this->isMemoryTainted(addrSrc+offset)) {
+              this->taintMemory(addrDst+offset);
+              tainted = TAINTED;
+            }
           }
         }
 
@@ -5,7 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
-#include <fstream>
+#include <cstring>
 #include <new>
 
 #include <triton/abstractBinary.hpp>
@@ -24,10 +24,10 @@ namespace triton {
     }
 
 
-    AbstractBinary::AbstractBinary(const std::string& path) {
+    AbstractBinary::AbstractBinary(const std::string& path, triton::format::loader_e mode) {
       this->format = triton::format::BINARY_INVALID;
       this->binary = nullptr;
-      this->loadBinary(path);
+      this->loadBinary(path, mode);
     }
 
 
@@ -41,21 +41,21 @@ namespace triton {
     }
 
 
-    void AbstractBinary::loadBinary(const std::string& path) {
+    void AbstractBinary::loadBinary(const std::string& path, triton::format::loader_e mode) {
+      triton::format::MappedFile* file = nullptr;
       triton::uint8 raw[8] = {0};
 
       // Open the file
-      std::ifstream ifs(path, std::ifstream::binary);
+      file = new(std::nothrow) triton::format::MappedFile(path, mode);
+      if (!file)
+        throw triton::exceptions::Format("AbstractBinary::loadBinary(): Not enough memory.");
 
-      ifs.unsetf(std::ios::skipws);
-
-      if (!ifs)
-        throw triton::exceptions::Format("AbstractBinary::loadBinary(): Cannot open the binary file.");
-
-      ifs.read(reinterpret_cast<char*>(raw), sizeof(raw));
-
-      if(!ifs)
+      if (file->getSize() < sizeof(raw)) {
+        delete file;
         throw triton::exceptions::Format("AbstractBinary::loadBinary(): Cannot read the file binary.");
+      }
+
+      std::memcpy(raw, file->getData(), sizeof(raw));
 
       // Set the binary format according the magic number
       if ((*((triton::uint32*)(raw))) == triton::format::MAGIC_ELF)
@@ -74,29 +74,35 @@ namespace triton {
         this->format = triton::format::BINARY_INVALID;
 
       // Parse the binary according to the format
-      this->parseBinary(path);
+      this->parseBinary(file);
     }
 
 
-    void AbstractBinary::parseBinary(const std::string& path) {
+    void AbstractBinary::parseBinary(triton::format::MappedFile* file) {
+      delete this->binary;
+      this->binary = nullptr;
+
       switch (this->format) {
         case triton::format::BINARY_ELF:
-          delete this->binary;
-          this->binary = new(std::nothrow) triton::format::elf::Elf(path);
-          if (!this->binary)
+          this->binary = new(std::nothrow) triton::format::elf::Elf(file);
+          if (!this->binary) {
+            delete file;
             throw triton::exceptions::Format("AbstractBinary::parseBinary(): Not enough memory.");
+          }
           break;
 
         case triton::format::BINARY_PE:
-          delete this->binary;
-          this->binary = new(std::nothrow) triton::format::pe::Pe(path);
-          if (!this->binary)
+          this->binary = new(std::nothrow) triton::format::pe::Pe(file);
+          if (!this->binary) {
+            delete file;
             throw triton::exceptions::Format("AbstractBinary::parseBinary(): Not enough memory.");
+          }
           break;
 
         // TODO
         case triton::format::BINARY_MACHO:
         default:
+          delete file;
           throw triton::exceptions::Format("AbstractBinary::parseBinary(): Unsupported binary format.");
       }
     }
@@ -107,6 +113,11 @@ namespace triton {
     }
 
 
+    const triton::format::BinaryInterface* AbstractBinary::getBinary(void) const {
+      return this->binary;
+    }
+
+
     triton::format::elf::Elf* AbstractBinary::getElf(void) {
       if (this->format != triton::format::BINARY_ELF)
         throw triton::exceptions::Format("AbstractBinary::getElf(): The abstract binary is not an ELF.");
@@ -6,7 +6,6 @@
 */
 
 #include <cstdio>
-#include <fstream>
 #include <new>
 
 #include <triton/elf.hpp>
@@ -18,53 +17,42 @@ namespace triton {
   namespace format {
     namespace elf {
 
-      Elf::Elf(const std::string& path) {
-        this->path      = path;
-        this->raw       = std::vector<triton::uint8>();
-        this->totalSize = 0;
-
-        this->open();
-        this->parse();
-        this->initMemoryMapping();
-        this->initDynamicTable();
-        this->initSharedLibraries();
-        this->initSymbolsTableViaProgramHeaders();  // .dyntab
-        this->initSymbolsTableViaSectionHeaders();  // .symtab
-        this->initRelTable();                       // DT_REL
-        this->initRelaTable();                      // DT_RELA
-        this->initJmprelTable();                    // DT_JMPREL
+      Elf::Elf(const std::string& path, triton::format::loader_e mode) {
+        this->file = new(std::nothrow) triton::format::MappedFile(path, mode);
+        if (this->file == nullptr)
+          throw triton::exceptions::Elf("Elf::Elf(): Not enough memory.");
+        this->init();
       }
 
 
-      Elf::~Elf() {
+      Elf::Elf(triton::format::MappedFile* file) {
+        this->file = file;
+        if (this->file == nullptr)
+          throw triton::exceptions::Elf("Elf::Elf(): The file cannot be null.");
+        this->init();
       }
 
 
-      void Elf::open(void) {
-        std::ifstream ifs(this->path, std::ifstream::binary);
-
-        if(!ifs)
-          throw triton::exceptions::Elf("Elf::open(): Cannot open the binary file.");
-
-       ifs.unsetf(std::ios::skipws);
-
-       // get its size:
-       std::streampos fileSize;
-
-       ifs.seekg(0, std::ios::end);
-       fileSize = ifs.tellg();
-       ifs.seekg(0, std::ios::beg);
+      Elf::~Elf() {
+        delete this->file;
+      }
 
-       // reserve capacity
-       this->raw.reserve(fileSize);
 
-       // read the data:
-       this->raw.insert(this->raw.begin(),
-           std::istream_iterator<triton::uint8>(ifs),
-           std::istream_iterator<triton::uint8>());
+      void Elf::init(void) {
+        this->totalSize               = this->file->getSize();
+        this->sectionHeadersParsed    = false;
+        this->dynamicTableParsed      = false;
+        this->symbolsTableParsed      = false;
+        this->relocationsTableParsed  = false;
 
-      // FIXME : This attribute is useless
-      this->totalSize = this->raw.size();
+        try {
+          this->parse();
+          this->initMemoryMapping();
+        }
+        catch (...) {
+          delete this->file;
+          throw;
+        }
       }
 
 
@@ -73,17 +61,12 @@ namespace triton {
         triton::uint64 phOffset = 0;
         triton::uint16 phNum    = 0;
         triton::uint16 phSize   = 0;
-        triton::uint64 shOffset = 0;
-        triton::uint16 shNum    = 0;
-        triton::uint16 shSize   = 0;
-        triton::uint16 shstrndx = 0;
-        triton::uint64 strtable = 0;
 
         // Parse the ELF Header
         if (this->totalSize < this->header.getMaxHeaderSize())
           throw triton::exceptions::Elf("Elf::parse(): The ELF Header of the binary file is corrupted.");
 
-        this->header.parse(this->raw.data());
+        this->header.parse(this->file->getData());
 
         // Parse Program Headers
         EIClass  = this->header.getEIClass();
@@ -98,26 +81,42 @@ namespace triton {
 
         for (triton::uint16 entry = 0; entry < phNum; entry++) {
           triton::format::elf::ElfProgramHeader phdr;
-          phdr.parse((this->raw.data() + (phOffset + (entry * phSize))), EIClass);
+          phdr.parse((this->file->getData() + (phOffset + (entry * phSize))), EIClass);
           this->programHeaders.push_back(phdr);
         }
 
+        return true;
+      }
+
+
+      void Elf::initSectionHeaders(void) const {
+        triton::uint8  EIClass  = this->header.getEIClass();
+        triton::uint64 shOffset = 0;
+        triton::uint16 shNum    = 0;
+        triton::uint16 shSize   = 0;
+        triton::uint16 shstrndx = 0;
+        triton::uint64 strtable = 0;
+
+        if (this->sectionHeadersParsed)
+          return;
+        this->sectionHeadersParsed = true;
+
         // Parse Section Headers - Stage 1 (entities parsing)
         shOffset = this->header.getShoff();
         shNum    = this->header.getShnum();
         shSize   = this->header.getShentsize();
 
         if (!shOffset)
-          return false;
+          return;
 
         if (this->totalSize < (shOffset + (shNum * shSize))) {
-          std::cerr << "Warning Elf::parse(): Some ELF Section Headers of the binary file are corrupted." << std::endl;
-          return false;
+          std::cerr << "Warning Elf::initSectionHeaders(): Some ELF Section Headers of the binary file are corrupted." << std::endl;
+          return;
         }
 
         for (triton::uint16 entry = 0; entry < shNum; entry++) {
           triton::format::elf::ElfSectionHeader shdr;
-          shdr.parse((this->raw.data() + (shOffset + (entry * shSize))), EIClass);
+          shdr.parse((this->file->getData() + (shOffset + (entry * shSize))), EIClass);
           this->sectionHeaders.push_back(shdr);
         }
 
@@ -125,23 +124,23 @@ namespace triton {
         shstrndx = this->header.getShstrndx();
         if (shstrndx != triton::format::elf::SHN_XINDEX) {
           if (shstrndx >= this->sectionHeaders.size()) {
-            std::cerr << "Warning Elf::parse(): The string table index (shstrndx) of the binary file is corrupted." << std::endl;
-            return false;
+            std::cerr << "Warning Elf::initSectionHeaders(): The string table index (shstrndx) of the binary file is corrupted." << std::endl;
+            return;
           }
 
           strtable = this->sectionHeaders[shstrndx].getOffset();
           for (auto it = this->sectionHeaders.begin(); it != this->sectionHeaders.end(); it++) {
-            it->setName(this->raw.data() + strtable + it->getIdxname());
+            if (this->totalSize <= strtable + it->getIdxname())
+              continue;
+            it->setName(this->file->getData() + strtable + it->getIdxname());
           }
         }
-
-        return true;
       }
 
 
       void Elf::initMemoryMapping(void) {
         for (auto it = this->programHeaders.begin(); it != this->programHeaders.end(); it++) {
-          triton::format::MemoryMapping area(this->raw.data());
+          triton::format::MemoryMapping area(this->file->getData());
 
           if (this->totalSize < (it->getOffset() + it->getFilesz())) {
             std::cerr << "Warning Elf::initMemoryMapping(): Some ELF Program Headers of the binary file are corrupted." << std::endl;
@@ -152,15 +151,25 @@ namespace triton {
           area.setSize(it->getFilesz());
           area.setVirtualAddress(it->getVaddr());
 
+          /* Only loadable segments are zero-filled (e.g. .bss), not PT_TLS */
+          if (it->getType() == triton::format::elf::PT_LOAD)
+            area.setVirtualSize(it->getMemsz());
+          else
+            area.setVirtualSize(it->getFilesz());
+
           this->memoryMapping.push_back(area);
         }
       }
 
 
-      void Elf::initDynamicTable(void) {
+      void Elf::initDynamicTable(void) const {
         triton::uint64 dynOffset = 0;
         triton::uint64 dynSize   = 0;
 
+        if (this->dynamicTableParsed)
+          return;
+        this->dynamicTableParsed = true;
+
         // Get the Dynamic Table offset.
         for (auto it = this->programHeaders.begin(); it != this->programHeaders.end(); it++) {
           if (it->getType() == triton::format::elf::PT_DYNAMIC) {
@@ -177,13 +186,15 @@ namespace triton {
         // Parse Dynamic Table.
         for (triton::uint32 read = 0; read < dynSize;) {
           triton::format::elf::ElfDynamicTable dyn;
-          read += dyn.parse(this->raw.data() + dynOffset + read, this->header.getEIClass());
+          read += dyn.parse(this->file->getData() + dynOffset + read, this->header.getEIClass());
           this->dynamicTable.push_back(dyn);
         }
+
+        this->initSharedLibraries();
       }
 
 
-      void Elf::initSharedLibraries(void) {
+      void Elf::initSharedLibraries(void) const {
         triton::uint64 strTabOffset = 0;
 
         strTabOffset = this->getOffsetFromDTValue(triton::format::elf::DT_STRTAB);
@@ -194,16 +205,29 @@ namespace triton {
 
         for (auto it = this->dynamicTable.begin(); it != this->dynamicTable.end(); it++) {
           if (it->getTag() == triton::format::elf::DT_NEEDED) {
-            this->sharedLibraries.push_back(reinterpret_cast<const char*>(this->raw.data() + strTabOffset + it->getValue()));
+            this->sharedLibraries.push_back(reinterpret_cast<const char*>(this->file->getData() + strTabOffset + it->getValue()));
           }
         }
       }
 
 
-      void Elf::initSymbolsTableViaProgramHeaders(void) {
+      void Elf::initSymbolsTable(void) const {
+        if (this->symbolsTableParsed)
+          return;
+        this->symbolsTableParsed = true;
+
+        this->initDynamicTable();
+        this->initSectionHeaders();
+        this->initSymbolsTableViaProgramHeaders();  // .dyntab
+        this->initSymbolsTableViaSectionHeaders();  // .symtab
+      }
+
+
+      void Elf::initSymbolsTableViaProgramHeaders(void) const {
         triton::uint64 strTabOffset = 0;
         triton::uint64 strTabSize   = 0;
         triton::uint64 symTabOffset = 0;
+        triton::uint64 symSize      = 0;
         triton::uint64 read         = 0;
 
         strTabOffset = this->getOffsetFromDTValue(triton::format::elf::DT_STRTAB);
@@ -224,26 +248,32 @@ namespace triton {
           return;
         }
 
+        if (this->header.getEIClass() == triton::format::elf::ELFCLASS32)
+          symSize = sizeof(triton::format::elf::Elf32_Sym_t);
+        else
+          symSize = sizeof(triton::format::elf::Elf64_Sym_t);
+
         while (true) {
           triton::format::elf::ElfSymbolTable sym;
-          read += sym.parse(this->raw.data() + symTabOffset + read, this->header.getEIClass());
 
-          if (sym.getOther() != triton::format::elf::STV_DEFAULT)
+          if (this->totalSize < symTabOffset + read + symSize)
             break;
 
-          if (sym.getIdxname() > strTabSize)
+          read += sym.parse(this->file->getData() + symTabOffset + read, this->header.getEIClass());
+
+          if (sym.getOther() != triton::format::elf::STV_DEFAULT)
             break;
 
-          if (this->totalSize < read)
+          if (sym.getIdxname() > strTabSize)
             break;
 
-          sym.setName(this->raw.data() + strTabOffset + sym.getIdxname());
+          sym.setName(this->file->getData() + strTabOffset + sym.getIdxname());
           this->symbolsTable.push_back(sym);
         }
       }
 
 
-      void Elf::initSymbolsTableViaSectionHeaders(void) {
+      void Elf::initSymbolsTableViaSectionHeaders(void) const {
         triton::uint64 strTabOffset = 0;
         triton::uint64 symTabOffset = 0;
         triton::uint64 symTabSize   = 0;
@@ -272,17 +302,29 @@ namespace triton {
         for (triton::uint32 read = 0; read < symTabSize;) {
           triton::format::elf::ElfSymbolTable sym;
 
-          read += sym.parse(this->raw.data() + symTabOffset + read, this->header.getEIClass());
+          read += sym.parse(this->file->getData() + symTabOffset + read, this->header.getEIClass());
           if (this->totalSize < strTabOffset + sym.getIdxname())
             continue;
 
-          sym.setName(this->raw.data() + strTabOffset + sym.getIdxname());
+          sym.setName(this->file->getData() + strTabOffset + sym.getIdxname());
           this->symbolsTable.push_back(sym);
         }
       }
 
 
-      void Elf::initRelTable(void) {
+      void Elf::initRelocationsTable(void) const {
+        if (this->relocationsTableParsed)
+          return;
+        this->relocationsTableParsed = true;
+
+        this->initDynamicTable();
+        this->initRelTable();     // DT_REL
+        this->initRelaTable();    // DT_RELA
+        this->initJmprelTable();  // DT_JMPREL
+      }
+
+
+      void Elf::initRelTable(void) const {
         triton::uint64 relTabOffset = 0;
         triton::uint64 relTabSize   = 0;
 
@@ -297,13 +339,13 @@ namespace triton {
 
         for (triton::uint32 read = 0; read < relTabSize;) {
           triton::format::elf::ElfRelocationTable rel;
-          read += rel.parseRel(this->raw.data() + relTabOffset + read, this->header.getEIClass());
+          read += rel.parseRel(this->file->getData() + relTabOffset + read, this->header.getEIClass());
           this->relocationsTable.push_back(rel);
         }
       }
 
 
-      void Elf::initRelaTable(void) {
+      void Elf::initRelaTable(void) const {
         triton::uint64 relaTabOffset = 0;
         triton::uint64 relaTabSize   = 0;
 
@@ -318,13 +360,13 @@ namespace triton {
 
         for (triton::uint32 read = 0; read < relaTabSize;) {
           triton::format::elf::ElfRelocationTable rela;
-          read += rela.parseRela(this->raw.data() + relaTabOffset + read, this->header.getEIClass());
+          read += rela.parseRela(this->file->getData() + relaTabOffset + read, this->header.getEIClass());
           this->relocationsTable.push_back(rela);
         }
       }
 
 
-      void Elf::initJmprelTable(void) {
+      void Elf::initJmprelTable(void) const {
         triton::uint64 jmprelTabOffset = 0;
         triton::uint64 jmprelTabSize   = 0;
 
@@ -340,9 +382,9 @@ namespace triton {
         for (triton::uint32 read = 0; read < jmprelTabSize;) {
           triton::format::elf::ElfRelocationTable jmprel;
           if (this->header.getEIClass() == triton::format::elf::ELFCLASS32)
-            read += jmprel.parseRel(this->raw.data() + jmprelTabOffset + read, this->header.getEIClass());
+            read += jmprel.parseRel(this->file->getData() + jmprelTabOffset + read, this->header.getEIClass());
           else if (this->header.getEIClass() == triton::format::elf::ELFCLASS64)
-            read += jmprel.parseRela(this->raw.data() + jmprelTabOffset + read, this->header.getEIClass());
+            read += jmprel.parseRela(this->file->getData() + jmprelTabOffset + read, this->header.getEIClass());
           else
             throw triton::exceptions::Elf("Elf::initJmprelTable(): Invalid EI_CLASS.");
           this->relocationsTable.push_back(jmprel);
@@ -366,6 +408,7 @@ namespace triton {
         triton::uint64 offset = 0;
         triton::uint64 vaddr  = 0;
 
+        this->initDynamicTable();
         for (auto it = this->dynamicTable.begin(); it != this->dynamicTable.end(); it++) {
           if (it->getTag() == dt) {
             vaddr  = it->getValue();
@@ -378,6 +421,7 @@ namespace triton {
 
 
       triton::uint64 Elf::getDTValue(triton::format::elf::elf_e dt) const {
+        this->initDynamicTable();
         for (auto it = this->dynamicTable.begin(); it != this->dynamicTable.end(); it++) {
           if (it->getTag() == dt) {
             return it->getValue();
@@ -388,7 +432,7 @@ namespace triton {
 
 
       const triton::uint8* Elf::getRaw(void) const {
-        return this->raw.data();
+        return this->file->getData();
       }
 
 
@@ -398,7 +442,12 @@ namespace triton {
 
 
       const std::string& Elf::getPath(void) const {
-        return this->path;
+        return this->file->getPath();
+      }
+
+
+      bool Elf::isMapped(void) const {
+        return this->file->isMapped();
       }
 
 
@@ -413,26 +462,31 @@ namespace triton {
 
 
       const std::vector<triton::format::elf::ElfSectionHeader>& Elf::getSectionHeaders(void) const {
+        this->initSectionHeaders();
         return this->sectionHeaders;
       }
 
 
       const std::vector<triton::format::elf::ElfDynamicTable>& Elf::getDynamicTable(void) const {
+        this->initDynamicTable();
         return this->dynamicTable;
       }
 
 
       const std::vector<triton::format::elf::ElfSymbolTable>& Elf::getSymbolsTable(void) const {
+        this->initSymbolsTable();
         return this->symbolsTable;
       }
 
 
       const std::vector<triton::format::elf::ElfRelocationTable>& Elf::getRelocationTable(void) const {
+        this->initRelocationsTable();
         return this->relocationsTable;
       }
 
 
       const std::vector<std::string>& Elf::getSharedLibraries(void) const {
+        this->initDynamicTable();
         return this->sharedLibraries;
       }
 
@@ -0,0 +1,108 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <triton/exceptions.hpp>
+#include <triton/mappedFile.hpp>
+
+
+
+namespace triton {
+  namespace format {
+
+    MappedFile::MappedFile(const std::string& path, triton::format::loader_e mode) {
+      this->path   = path;
+      this->data   = nullptr;
+      this->size   = 0;
+      this->mapped = false;
+
+      if (mode == triton::format::LOADER_MMAP && this->map())
+        return;
+
+      this->read();
+    }
+
+
+    MappedFile::~MappedFile() {
+      #if defined(__unix__) || defined(__APPLE__)
+      if (this->mapped)
+        munmap(const_cast<triton::uint8*>(this->data), this->size);
+      #endif
+    }
+
+
+    bool MappedFile::map(void) {
+      #if defined(__unix__) || defined(__APPLE__)
+      struct stat info;
+      int fd = ::open(this->path.c_str(), O_RDONLY);
+
+      if (fd < 0)
+        throw triton::exceptions::Format("MappedFile::map(): Cannot open the binary file.");
+
+      if (fstat(fd, &info) == 0 && info.st_size > 0) {
+        void* area = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (area != MAP_FAILED) {
+          this->data   = reinterpret_cast<const triton::uint8*>(area);
+          this->size   = info.st_size;
+          this->mapped = true;
+        }
+      }
+
+      ::close(fd);
+      #endif
+
+      return this->mapped;
+    }
+
+
+    void MappedFile::read(void) {
+      std::ifstream ifs(this->path, std::ifstream::binary);
+
+      if (!ifs)
+        throw triton::exceptions::Format("MappedFile::read(): Cannot open the binary file.");
+
+      ifs.seekg(0, std::ios::end);
+      this->raw.resize(static_cast<triton::usize>(ifs.tellg()));
+      ifs.seekg(0, std::ios::beg);
+
+      if (!ifs.read(reinterpret_cast<char*>(this->raw.data()), this->raw.size()))
+        throw triton::exceptions::Format("MappedFile::read(): Cannot read the binary file.");
+
+      this->data = this->raw.data();
+      this->size = this->raw.size();
+    }
+
+
+    const std::string& MappedFile::getPath(void) const {
+      return this->path;
+    }
+
+
+    const triton::uint8* MappedFile::getData(void) const {
+      return this->data;
+    }
+
+
+    triton::usize MappedFile::getSize(void) const {
+      return this->size;
+    }
+
+
+    bool MappedFile::isMapped(void) const {
+      return this->mapped;
+    }
+
+  }; /* format namespace */
+}; /* triton namespace */
@@ -18,6 +18,7 @@ namespace triton {
       this->offset          = 0;
       this->virtualAddress  = 0;
       this->size            = 0;
+      this->virtualSize     = 0;
 
       if (!this->binary)
         throw triton::exceptions::Format("MemoryMapping::MemoryMapping(): The binary pointer cannot be null");
@@ -29,6 +30,7 @@ namespace triton {
       this->offset          = copy.offset;
       this->virtualAddress  = copy.virtualAddress;
       this->size            = copy.size;
+      this->virtualSize     = copy.virtualSize;
     }
 
 
@@ -41,6 +43,7 @@ namespace triton {
       this->offset          = copy.offset;
       this->virtualAddress  = copy.virtualAddress;
       this->size            = copy.size;
+      this->virtualSize     = copy.virtualSize;
     }
 
 
@@ -69,6 +72,11 @@ namespace triton {
     }
 
 
+    triton::uint64 MemoryMapping::getVirtualSize(void) const {
+      return this->virtualSize;
+    }
+
+
     void MemoryMapping::setOffset(triton::uint64 offset) {
       this->offset = offset;
     }
@@ -83,5 +91,10 @@ namespace triton {
       this->size = size;
     }
 
+
+    void MemoryMapping::setVirtualSize(triton::uint64 virtualSize) {
+      this->virtualSize = virtualSize;
+    }
+
   }; /* format namespace */
 }; /* triton namespace */
@@ -7,7 +7,6 @@
 
 #include <cstdio>
 #include <new>
-#include <fstream>
 
 #include <triton/exceptions.hpp>
 #include <triton/pe.hpp>
@@ -18,60 +17,52 @@ namespace triton {
   namespace format {
     namespace pe {
 
-      Pe::Pe(const std::string& path) {
-        this->path      = path;
-        this->raw       = std::vector<triton::uint8>();
-        this->totalSize = 0;
-
-        this->open();
-        this->parse();
-        this->initMemoryMapping();
-        this->initImportTable();
-        this->initExportTable();
+      Pe::Pe(const std::string& path, triton::format::loader_e mode) {
+        this->file = new(std::nothrow) triton::format::MappedFile(path, mode);
+        if (this->file == nullptr)
+          throw triton::exceptions::Pe("Pe::Pe(): Not enough memory.");
+        this->init();
       }
 
 
-      Pe::~Pe() {
+      Pe::Pe(triton::format::MappedFile* file) {
+        this->file = file;
+        if (this->file == nullptr)
+          throw triton::exceptions::Pe("Pe::Pe(): The file cannot be null.");
+        this->init();
       }
 
 
-      void Pe::open(void) {
-        std::ifstream ifs(this->path, std::ifstream::binary);
-
-        if(!ifs)
-          throw triton::exceptions::Elf("Elf::open(): Cannot open the binary file.");
-
-       ifs.unsetf(std::ios::skipws);
-
-       // get its size:
-       std::streampos fileSize;
-
-       ifs.seekg(0, std::ios::end);
-       fileSize = ifs.tellg();
-       ifs.seekg(0, std::ios::beg);
+      Pe::~Pe() {
+        delete this->file;
+      }
 
-       // reserve capacity
-       this->raw.reserve(fileSize);
 
-       // read the data:
-       this->raw.insert(this->raw.begin(),
-           std::istream_iterator<triton::uint8>(ifs),
-           std::istream_iterator<triton::uint8>());
+      void Pe::init(void) {
+        this->totalSize         = this->file->getSize();
+        this->importTableParsed = false;
+        this->exportTableParsed = false;
 
-      // FIXME : This attribute is useless
-      this->totalSize = this->raw.size();
+        try {
+          this->parse();
+          this->initMemoryMapping();
+        }
+        catch (...) {
+          delete this->file;
+          throw;
+        }
       }
 
 
       bool Pe::parse(void) {
-        this->header.parse(this->raw.data(), this->totalSize);
+        this->header.parse(this->file->getData(), this->totalSize);
         return true;
       }
 
 
       void Pe::initMemoryMapping(void) {
         for (auto&& section : this->header.getSectionHeaders()) {
-          triton::format::MemoryMapping area(this->raw.data());
+          triton::format::MemoryMapping area(this->file->getData());
 
           triton::uint32 rawAddr  = section.getRawAddress();
           triton::uint32 rawSize  = section.getRawSize();
@@ -83,6 +74,7 @@ namespace triton {
           area.setOffset(rawAddr);
           area.setSize(rawSize);
           area.setVirtualAddress(virtAddr);
+          area.setVirtualSize(section.getVirtualSize());
 
           this->memoryMapping.push_back(area);
         }
@@ -108,15 +100,19 @@ namespace triton {
       }
 
 
-      void Pe::initExportTable(void) {
+      void Pe::initExportTable(void) const {
+        if (this->exportTableParsed)
+          return;
+        this->exportTableParsed = true;
+
         triton::uint32 exportStart = this->header.getDataDirectory().getExportTable_rva();
         triton::uint32 exportSize  = this->header.getDataDirectory().getExportTable_size();
 
         if (exportStart == 0)
           return; // no export table, leave it blank
 
-        this->exportTable.parse(raw.data() + this->getOffsetFromAddress(exportStart));
-        this->exportTable.setName(reinterpret_cast<const char*>(raw.data() + this->getOffsetFromAddress(this->exportTable.getNameRVA())));
+        this->exportTable.parse(this->file->getData() + this->getOffsetFromAddress(exportStart));
+        this->exportTable.setName(reinterpret_cast<const char*>(this->file->getData() + this->getOffsetFromAddress(this->exportTable.getNameRVA())));
 
         triton::uint64 addrTableStart = this->getOffsetFromAddress(this->exportTable.getExportAddressTableRVA());
         if (addrTableStart + (this->exportTable.getAddressTableEntries() * sizeof(triton::uint32)) >= totalSize)
@@ -126,11 +122,11 @@ namespace triton {
         for (triton::usize i = 0; i < this->exportTable.getAddressTableEntries(); ++i) {
           PeExportEntry entry;
           triton::uint32 exportRVA;
-          std::memcpy(&exportRVA, raw.data() + addrTableStart + (sizeof(exportRVA) * i), sizeof(exportRVA));
+          std::memcpy(&exportRVA, this->file->getData() + addrTableStart + (sizeof(exportRVA) * i), sizeof(exportRVA));
           if (exportRVA >= exportStart && exportRVA < exportStart + exportSize) {
             entry.isForward     = true;
             entry.forwarderRVA  = exportRVA;
-            entry.forwarderName = std::string(reinterpret_cast<const char*>(raw.data() + this->getOffsetFromAddress(exportRVA)));
+            entry.forwarderName = std::string(reinterpret_cast<const char*>(this->file->getData() + this->getOffsetFromAddress(exportRVA)));
           }
           else {
             entry.isForward = false;
@@ -151,12 +147,12 @@ namespace triton {
           triton::uint16 ordinal;
           triton::uint32 nameRVA;
 
-          std::memcpy(&ordinal, raw.data() + (ordTableStart + sizeof(ordinal) * i), sizeof(ordinal));
-          std::memcpy(&nameRVA, raw.data() + (nameTableStart + sizeof(nameRVA) * i), sizeof(nameRVA));
+          std::memcpy(&ordinal, this->file->getData() + (ordTableStart + sizeof(ordinal) * i), sizeof(ordinal));
+          std::memcpy(&nameRVA, this->file->getData() + (nameTableStart + sizeof(nameRVA) * i), sizeof(nameRVA));
 
           entries[ordinal].ordinal        = ordinal;
           entries[ordinal].exportNameRVA  = nameRVA;
-          entries[ordinal].exportName     = std::string(reinterpret_cast<const char *>(raw.data() + this->getOffsetFromAddress(nameRVA)));
+          entries[ordinal].exportName     = std::string(reinterpret_cast<const char *>(this->file->getData() + this->getOffsetFromAddress(nameRVA)));
         }
 
         for (const PeExportEntry& entry : entries)
@@ -164,7 +160,11 @@ namespace triton {
       }
 
 
-      void Pe::initImportTable(void) {
+      void Pe::initImportTable(void) const {
+        if (this->importTableParsed)
+          return;
+        this->importTableParsed = true;
+
         triton::uint32 importStart = this->header.getDataDirectory().getImportTable_rva();
 
         if (importStart == 0)
@@ -179,13 +179,13 @@ namespace triton {
         while (true) {
           PeImportDirectory impdt;
 
-          if (!impdt.parse(raw.data() + pos))
+          if (!impdt.parse(this->file->getData() + pos))
             break;
 
-          impdt.setName(std::string(reinterpret_cast<const char*>(raw.data() + this->getOffsetFromAddress(impdt.getNameRVA()))));
+          impdt.setName(std::string(reinterpret_cast<const char*>(this->file->getData() + this->getOffsetFromAddress(impdt.getNameRVA()))));
           triton::uint64 impLookupTable = this->getOffsetFromAddress(impdt.getImportLookupTableRVA());
           triton::uint64 importEntry = 0;
-          std::memcpy(&importEntry, raw.data() + impLookupTable, entrySize);
+          std::memcpy(&importEntry, this->file->getData() + impLookupTable, entrySize);
 
           while (importEntry > 0) {
             PeImportLookup entry;
@@ -193,8 +193,8 @@ namespace triton {
 
             if (entry.importByName) {
               triton::uint64 hintNameStart = this->getOffsetFromAddress(importEntry & ((1u << 31) - 1));
-              std::memcpy(&entry.ordinalNumber, raw.data() + hintNameStart, sizeof(entry.ordinalNumber));
-              entry.name = std::string(reinterpret_cast<const char*>(raw.data() + hintNameStart + 2));
+              std::memcpy(&entry.ordinalNumber, this->file->getData() + hintNameStart, sizeof(entry.ordinalNumber));
+              entry.name = std::string(reinterpret_cast<const char*>(this->file->getData() + hintNameStart + 2));
             }
             else {
               entry.ordinalNumber = importEntry & ((1 << 16) - 1);
@@ -202,7 +202,7 @@ namespace triton {
 
             impdt.addEntry(entry);
             impLookupTable += entrySize;
-            std::memcpy(&importEntry, raw.data() + impLookupTable, entrySize);
+            std::memcpy(&importEntry, this->file->getData() + impLookupTable, entrySize);
           }
 
           importTable.push_back(impdt);
@@ -213,7 +213,7 @@ namespace triton {
 
 
       const triton::uint8* Pe::getRaw(void) const {
-        return this->raw.data();
+        return this->file->getData();
       }
 
 
@@ -223,7 +223,7 @@ namespace triton {
 
 
       const std::string& Pe::getPath(void) const {
-        return this->path;
+        return this->file->getPath();
       }
 
 
@@ -233,16 +233,19 @@ namespace triton {
 
 
       const PeExportDirectory& Pe::getExportTable(void) const {
+        this->initExportTable();
         return this->exportTable;
       }
 
 
       const std::vector<PeImportDirectory>& Pe::getImportTable(void) const {
+        this->initImportTable();
         return this->importTable;
       }
 
 
       const std::vector<std::string>& Pe::getSharedLibraries(void) const {
+        this->initImportTable();
         return this->dlls;
       }
 
@@ -0,0 +1,183 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <triton/coreUtils.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/memoryAccess.hpp>
+#include <triton/register.hpp>
+#include <triton/traceReader.hpp>
+
+
+
+namespace triton {
+  namespace format {
+    namespace trace {
+
+      TraceReader::TraceReader(const std::string& path) {
+        this->path          = path;
+        this->data          = nullptr;
+        this->size          = 0;
+        this->mapped        = false;
+        this->offset        = 0;
+        this->architecture  = 0;
+
+        this->open();
+
+        if (this->read(4) != triton::format::trace::TRACE_MAGIC)
+          throw triton::exceptions::Trace("TraceReader::TraceReader(): Invalid trace magic.");
+
+        if (this->read(2) != triton::format::trace::TRACE_VERSION)
+          throw triton::exceptions::Trace("TraceReader::TraceReader(): Unsupported trace version.");
+
+        this->architecture = static_cast<triton::uint32>(this->read(2));
+      }
+
+
+      TraceReader::~TraceReader() {
+        #if defined(__unix__) || defined(__APPLE__)
+        if (this->mapped)
+          munmap(const_cast<triton::uint8*>(this->data), this->size);
+        #endif
+      }
+
+
+      void TraceReader::open(void) {
+        #if defined(__unix__) || defined(__APPLE__)
+        struct stat info;
+        int fd = ::open(this->path.c_str(), O_RDONLY);
+
+        if (fd < 0)
+          throw triton::exceptions::Trace("TraceReader::open(): Cannot open the trace file.");
+
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+          void* area = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+          if (area != MAP_FAILED) {
+            #if defined(MADV_SEQUENTIAL)
+            madvise(area, info.st_size, MADV_SEQUENTIAL);
+            #endif
+            this->data   = reinterpret_cast<const triton::uint8*>(area);
+            this->size   = info.st_size;
+            this->mapped = true;
+          }
+        }
+
+        ::close(fd);
+
+        if (this->mapped)
+          return;
+        #endif
+
+        /* Fallback when the file cannot be mapped */
+        std::ifstream ifs(this->path, std::ifstream::binary);
+        if (!ifs)
+          throw triton::exceptions::Trace("TraceReader::open(): Cannot open the trace file.");
+
+        this->raw.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+        this->data = this->raw.data();
+        this->size = this->raw.size();
+      }
+
+
+      void TraceReader::checkAvailable(triton::usize size) const {
+        if (size > this->size - this->offset)
+          throw triton::exceptions::Trace("TraceReader::checkAvailable(): Truncated trace.");
+      }
+
+
+      triton::uint64 TraceReader::read(triton::uint32 size) {
+        triton::uint64 value = 0;
+
+        this->checkAvailable(size);
+        for (triton::uint32 i = 0; i < size; i++)
+          value |= static_cast<triton::uint64>(this->data[this->offset + i]) << (i * 8);
+        this->offset += size;
+
+        return value;
+      }
+
+
+      triton::uint512 TraceReader::readValue(triton::uint32 size) {
+        triton::uint8 buffer[triton::format::trace::TRACE_MAX_VALUE_SIZE] = {0};
+
+        if (size > triton::format::trace::TRACE_MAX_VALUE_SIZE)
+          throw triton::exceptions::Trace("TraceReader::readValue(): Invalid value size.");
+
+        this->checkAvailable(size);
+        std::memcpy(buffer, this->data + this->offset, size);
+        this->offset += size;
+
+        return triton::utils::fromBufferToUint<triton::uint512>(buffer);
+      }
+
+
+      triton::uint32 TraceReader::getArchitecture(void) const {
+        return this->architecture;
+      }
+
+
+      bool TraceReader::isEnd(void) const {
+        return this->offset >= this->size;
+      }
+
+
+      void TraceReader::rewind(void) {
+        this->offset = triton::format::trace::TRACE_HEADER_SIZE;
+        this->registers.clear();
+      }
+
+
+      bool TraceReader::nextInstruction(triton::arch::Instruction& inst) {
+        if (this->isEnd())
+          return false;
+
+        this->checkAvailable(triton::format::trace::TRACE_RECORD_SIZE);
+
+        triton::uint64 address          = this->read(8);
+        triton::uint32 tid              = static_cast<triton::uint32>(this->read(4));
+        triton::uint32 opcodeSize       = static_cast<triton::uint32>(this->read(1));
+        triton::uint32 numberOfRegs     = static_cast<triton::uint32>(this->read(1));
+        triton::uint32 numberOfMems     = static_cast<triton::uint32>(this->read(2));
+
+        this->checkAvailable(opcodeSize);
+        inst.setOpcodes(this->data + this->offset, opcodeSize);
+        inst.setAddress(address);
+        inst.setThreadId(tid);
+        this->offset += opcodeSize;
+
+        /* Only the registers which have changed are recorded, restore the whole context of the thread */
+        auto& registers = this->registers[tid];
+        for (triton::uint32 i = 0; i < numberOfRegs; i++) {
+          triton::uint32 regId = static_cast<triton::uint32>(this->read(2));
+          triton::uint32 size  = static_cast<triton::uint32>(this->read(1));
+          registers[regId] = triton::arch::Register(regId, this->readValue(size));
+        }
+
+        for (auto it = registers.begin(); it != registers.end(); it++)
+          inst.updateContext(it->second);
+
+        for (triton::uint32 i = 0; i < numberOfMems; i++) {
+          triton::uint64 addr = this->read(8);
+          triton::uint32 size = static_cast<triton::uint32>(this->read(2));
+          inst.updateContext(triton::arch::MemoryAccess(addr, size, this->readValue(size)));
+        }
+
+        return true;
+      }
+
+    };
+  };
+};
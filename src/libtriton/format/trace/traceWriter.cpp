@@ -0,0 +1,156 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <list>
+#include <set>
+#include <vector>
+
+#include <triton/coreUtils.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/traceWriter.hpp>
+
+
+
+namespace triton {
+  namespace format {
+    namespace trace {
+
+      /* Returns true if a node refers to one of the expressions `ids`. References are not followed */
+      static bool isReferencing(triton::ast::AbstractNode* node, const std::set<triton::usize>& ids) {
+        std::set<triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> worklist;
+
+        if (node != nullptr)
+          worklist.push_back(node);
+
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          if (visited.insert(current).second == false)
+            continue;
+
+          if (current->getKind() == triton::ast::REFERENCE_NODE) {
+            if (ids.find(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue()) != ids.end())
+              return true;
+            continue;
+          }
+
+          for (auto it = current->getChilds().begin(); it != current->getChilds().end(); it++)
+            worklist.push_back(*it);
+        }
+
+        return false;
+      }
+
+
+      TraceWriter::TraceWriter(const std::string& path, triton::uint32 architecture) {
+        this->stream.open(path, std::ofstream::binary | std::ofstream::trunc);
+        if (!this->stream)
+          throw triton::exceptions::Trace("TraceWriter::TraceWriter(): Cannot open the trace file.");
+
+        this->append(triton::format::trace::TRACE_MAGIC, 4);
+        this->append(triton::format::trace::TRACE_VERSION, 2);
+        this->append(architecture, 2);
+        this->stream.write(reinterpret_cast<const char*>(this->record.data()), this->record.size());
+      }
+
+
+      TraceWriter::~TraceWriter() {
+        this->close();
+      }
+
+
+      void TraceWriter::append(triton::uint64 value, triton::uint32 size) {
+        for (triton::uint32 i = 0; i < size; i++)
+          this->record.push_back(static_cast<triton::uint8>(value >> (i * 8)));
+      }
+
+
+      void TraceWriter::appendValue(const triton::uint512& value, triton::uint32 size) {
+        triton::uint8 buffer[triton::format::trace::TRACE_MAX_VALUE_SIZE];
+        triton::utils::fromUintToBuffer(value, buffer);
+        this->record.insert(this->record.end(), buffer, buffer + size);
+      }
+
+
+      void TraceWriter::addInstruction(const triton::arch::Instruction& inst) {
+        std::list<triton::arch::MemoryAccess> memory = inst.memoryAccess;
+        std::set<triton::usize> written;
+        triton::uint32 numberOfRegisters = 0;
+        auto& lastRegisters = this->lastRegisters[inst.getThreadId()];
+
+        if (!this->stream.is_open())
+          throw triton::exceptions::Trace("TraceWriter::addInstruction(): The trace is closed.");
+
+        /*
+         * The replay sets the memory before the execution, thus only the values read are recorded.
+         * The context is consumed by the processing, the loads of a processed instruction hold
+         * the values before its execution while its stores are replayed by the execution. A load
+         * which refers to an expression of the instruction reads a value it has written (e.g. xadd).
+         */
+        for (auto it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++)
+          written.insert((*it)->getId());
+
+        for (auto it = inst.getLoadAccess().begin(); it != inst.getLoadAccess().end(); it++) {
+          if (!isReferencing(it->second, written))
+            memory.push_back(it->first);
+        }
+
+        if (memory.size() > 0xffff)
+          throw triton::exceptions::Trace("TraceWriter::addInstruction(): Too many memory accesses.");
+
+        /* The fixed part, the number of registers is patched once the deltas are known */
+        this->record.clear();
+        this->append(inst.getAddress(), 8);
+        this->append(inst.getThreadId(), 4);
+        this->append(inst.getSize(), 1);
+        this->append(0, 1);
+        this->append(memory.size(), 2);
+        this->record.insert(this->record.end(), inst.getOpcodes(), inst.getOpcodes() + inst.getSize());
+
+        for (auto it = inst.registerState.begin(); it != inst.registerState.end(); it++) {
+          const triton::arch::Register& reg = it->second;
+          triton::uint512 value = reg.getConcreteValue();
+          auto last = lastRegisters.find(reg.getId());
+
+          if (last != lastRegisters.end() && last->second == value)
+            continue;
+
+          if (numberOfRegisters == 0xff)
+            throw triton::exceptions::Trace("TraceWriter::addInstruction(): Too many registers.");
+
+          lastRegisters[reg.getId()] = value;
+          this->append(reg.getId(), 2);
+          this->append((reg.getBitSize() + 7) / 8, 1);
+          this->appendValue(value, (reg.getBitSize() + 7) / 8);
+          numberOfRegisters++;
+        }
+        this->record[13] = static_cast<triton::uint8>(numberOfRegisters);
+
+        for (auto it = memory.begin(); it != memory.end(); it++) {
+          if (it->getSize() > triton::format::trace::TRACE_MAX_VALUE_SIZE)
+            throw triton::exceptions::Trace("TraceWriter::addInstruction(): Invalid memory access size.");
+          this->append(it->getAddress(), 8);
+          this->append(it->getSize(), 2);
+          this->appendValue(it->getConcreteValue(), it->getSize());
+        }
+
+        this->stream.write(reinterpret_cast<const char*>(this->record.data()), this->record.size());
+        if (!this->stream)
+          throw triton::exceptions::Trace("TraceWriter::addInstruction(): Cannot write the trace file.");
+      }
+
+
+      void TraceWriter::close(void) {
+        if (this->stream.is_open())
+          this->stream.close();
+      }
+
+    };
+  };
+};
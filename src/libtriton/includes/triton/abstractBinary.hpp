@@ -12,8 +12,9 @@
 
 #include <triton/binaryInterface.hpp>
 #include <triton/elf.hpp>
-#include <triton/pe.hpp>
+#include <triton/mappedFile.hpp>
 #include <triton/memoryMapping.hpp>
+#include <triton/pe.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -60,15 +61,21 @@ namespace triton {
         //! Instance to the real Binary class.
         triton::format::BinaryInterface* binary;
 
-        //! Parse the binary
-        void parseBinary(const std::string& path);
+        //! Parse the binary. Takes the ownership of the file.
+        void parseBinary(triton::format::MappedFile* file);
 
       public:
         //! Constructor.
         AbstractBinary();
 
         //! Constructor.
-        AbstractBinary(const std::string& path);
+        AbstractBinary(const std::string& path, triton::format::loader_e mode=triton::format::LOADER_MMAP);
+
+        //! An AbstractBinary cannot be copied.
+        AbstractBinary(const AbstractBinary& other) = delete;
+
+        //! An AbstractBinary cannot be copied.
+        AbstractBinary& operator=(const AbstractBinary& other) = delete;
 
         //! Destructor.
         virtual ~AbstractBinary();
@@ -76,12 +83,20 @@ namespace triton {
         //! Returns the binary format.
         triton::format::binary_e getFormat(void) const;
 
-        //! Load a binary.
-        void loadBinary(const std::string& path);
+        /*!
+         * \brief Load a binary.
+         *
+         * \description
+         * By default (`LOADER_MMAP`), the file is mapped read-only and the memory areas point into the mapping.
+         */
+        void loadBinary(const std::string& path, triton::format::loader_e mode=triton::format::LOADER_MMAP);
 
         //! Returns the abstract binary.
         triton::format::BinaryInterface* getBinary(void);
 
+        //! Returns the abstract binary.
+        const triton::format::BinaryInterface* getBinary(void) const;
+
         //! Returns the ELF instance only if the AbstractBinary::format is equal to triton::format::BINARY_ELF otherwise raise an excepton.
         triton::format::elf::Elf* getElf(void);
 
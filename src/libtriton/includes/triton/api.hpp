@@ -8,6 +8,7 @@
 #ifndef TRITON_API_H
 #define TRITON_API_H
 
+#include <triton/abstractBinary.hpp>
 #include <triton/architecture.hpp>
 #include <triton/ast.hpp>
 #include <triton/astGarbageCollector.hpp>
@@ -24,6 +25,7 @@
 #include <triton/solverEngine.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/taintEngine.hpp>
+#include <triton/traceReader.hpp>
 #include <triton/tritonTypes.hpp>
 #include <triton/z3Interface.hpp>
 
@@ -36,13 +38,22 @@ namespace triton {
  */
 
     /*! \class API
-     *  \brief This is used as C++ API. */
+     *  \brief This is used as C++ API.
+     *
+     * \description
+     * Each instance is an independent context: architecture, engines, modes, callbacks, AST garbage
+     * collector and AST representation. Several instances may run on several threads as long as an
+     * instance is used by one thread at a time. See triton::ApiBinding.
+     */
     class API {
 
       protected:
         //! The Callbacks interface.
         triton::callbacks::Callbacks callbacks;
 
+        //! The AST representation.
+        triton::ast::representations::AstRepresentation astRepresentation;
+
         //! The architecture entry.
         triton::arch::Architecture arch;
 
@@ -97,6 +108,9 @@ namespace triton {
         //! [**architecture api**] - Clears the architecture states (registers and memory).
         void clearArchitecture(void);
 
+        //! [**architecture api**] - Inits the registers of the calling thread (e.g. `TRITON_X86_REG_RAX`) if they are defined for another architecture. \sa triton::ApiBinding.
+        void initThreadRegisters(void) const;
+
         //! [**architecture api**] - Returns true if the register id is a flag. \sa triton::arch::x86::registers_e.
         bool isFlag(triton::uint32 regId) const;
 
@@ -185,15 +199,35 @@ namespace triton {
          */
         void setConcreteRegisterValue(const triton::arch::Register& reg);
 
-        //! [**architecture api**] - Returns true if the range `[baseAddr:size]` is mapped into the internal memory representation. \sa getConcreteMemoryValue() and getConcreteMemoryAreaValue().
+        //! [**architecture api**] - Returns true if all pages covering the range `[baseAddr:size]` are mapped into the internal memory representation. \sa getConcreteMemoryValue() and getConcreteMemoryAreaValue().
         bool isMemoryMapped(triton::uint64 baseAddr, triton::usize size=1);
 
-        //! [**architecture api**] - Removes the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
+        //! [**architecture api**] - Removes all pages covering the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
         void unmapMemory(triton::uint64 baseAddr, triton::usize size=1);
 
+        /*!
+         * \brief [**architecture api**] - Loads the memory areas of a binary into the concrete memory.
+         *
+         * \description
+         * The binary file is mapped read-only and its memory areas are mapped at their virtual address without being
+         * copied: a page is only copied on its first write. The zero-filled part of an area (e.g. `.bss`) is only
+         * allocated on its first write. The mapping is kept until the pages are unmapped, thus the binary may be
+         * destroyed after. Like setConcreteMemoryAreaValue(), it does not modify the symbolic state.
+         */
+        void loadBinary(const triton::format::BinaryInterface& binary);
+
+        //! [**architecture api**] - Loads the memory areas of a binary into the concrete memory. \sa loadBinary(const triton::format::BinaryInterface&).
+        void loadBinary(const triton::format::AbstractBinary& binary);
+
         //! [**architecture api**] - Disassembles the instruction and setup operands. You must define an architecture before. \sa processing().
         void disassembly(triton::arch::Instruction& inst) const;
 
+        //! [**architecture api**] - Returns the statistics of the disassembly cache (`entries`, `hits`, `misses` and `hitRate` as percentage).
+        std::map<std::string, triton::usize> getDisassemblyCacheStats(void) const;
+
+        //! [**architecture api**] - Removes all decoded instructions from the disassembly cache.
+        void flushDisassemblyCache(void);
+
 
 
         /* Processing API ================================================================================ */
@@ -201,6 +235,18 @@ namespace triton {
         //! [**proccesing api**] - Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported.
         bool processing(triton::arch::Instruction& inst);
 
+        /*!
+         * \brief [**proccesing api**] - Emulates the code from `startAddress` following the concrete program counter. Returns the reason why the emulation stopped.
+         *
+         * \description
+         * The opcodes are fetched from the concrete memory (without calling the GET_CONCRETE_MEMORY_VALUE callbacks). The emulation
+         * stops after `maxInstructions` instructions (0 means no limit), after a system call, before a breakpoint, before an unsupported
+         * instruction or when a hook returns false. Hooks are called before the instruction at their address. Breakpoints and hooks
+         * are not applied on `startAddress`, thus an emulation can be resumed where it stopped.
+         */
+        triton::arch::emulation_e emulate(triton::uint64 startAddress, const std::set<triton::uint64>& breakpoints = {}, triton::usize maxInstructions = 0,
+                                          const std::map<triton::uint64, triton::arch::emulationHookCallback>& hooks = {});
+
         //! [**proccesing api**] - Initialize everything.
         void initEngines(void);
 
@@ -212,6 +258,48 @@ namespace triton {
 
 
 
+        /* Snapshot API ================================================================================== */
+
+        /*!
+         * \brief [**snapshot api**] - Takes a snapshot of the registers, the memory, the taint state and the symbolic state. A previous snapshot is discarded.
+         *
+         * \description
+         * The snapshot is copy-on-write: the memory pages, the tainted pages and the symbolic memory references are
+         * saved on their first modification. Thus, taking a snapshot is cheap and restoring it only costs what has been
+         * modified since.
+         */
+        void takeSnapshot(void);
+
+        /*!
+         * \brief [**snapshot api**] - Restores the state as it was when the snapshot has been taken. The snapshot is kept, thus it can be restored again.
+         *
+         * \description
+         * The symbolic expressions created since the snapshot are deleted, the symbolic variables are kept.
+         */
+        void restoreSnapshot(void);
+
+        //! [**snapshot api**] - Discards the snapshot.
+        void discardSnapshot(void);
+
+        //! [**snapshot api**] - Returns true if a snapshot is taken.
+        bool isSnapshotEnabled(void) const;
+
+
+
+        /* Trace API ===================================================================================== */
+
+        /*!
+         * \brief [**trace api**] - Replays a binary trace recorded with triton::format::trace::TraceWriter. Returns the number of processed instructions.
+         *
+         * \description
+         * Each record is processed with its concrete context. The hooks are called after the processing of the
+         * instruction at their address, returning false stops the replay. If no architecture is defined, the
+         * architecture of the trace is used.
+         */
+        triton::usize replayTrace(const std::string& path, const std::map<triton::uint64, triton::format::trace::replayHookCallback>& hooks = {});
+
+
+
         /* IR API ======================================================================================== */
 
         //! [**IR builder api**] - Raises an exception if the IR builder is not initialized.
@@ -243,11 +331,14 @@ namespace triton {
         void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
 
         //! [**AST garbage collector api**] - Returns all allocated nodes.
-        const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
+        std::set<triton::ast::AbstractNode*> getAllocatedAstNodes(void) const;
 
         //! [**AST garbage collector api**] - Returns all stats about AST Dictionaries.
         std::map<std::string, triton::usize> getAstDictionariesStats(void) const;
 
+        //! [**AST garbage collector api**] - Returns all stats about the allocator of AST nodes of the calling thread (shared by all instances).
+        std::map<std::string, triton::usize> getAstAllocatorStats(void) const;
+
         //! [**AST garbage collector api**] - Returns all variable nodes recorded.
         const std::map<std::string, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
 
@@ -270,6 +361,9 @@ namespace triton {
         //! [**AST representation api**] - Sets the AST representation mode.
         void setAstRepresentationMode(triton::uint32 mode);
 
+        //! [**AST representation api**] - Displays the node according to the AST representation mode.
+        std::ostream& printAstRepresentation(std::ostream& stream, triton::ast::AbstractNode* node);
+
 
 
         /* Callbacks API ================================================================================= */
@@ -456,10 +550,10 @@ namespace triton {
         //! [**symbolic api**] - Returns true if the register expression contains a symbolic variable.
         bool isRegisterSymbolized(const triton::arch::Register& reg) const;
 
-        //! [**symbolic api**] - Concretizes all symbolic memory references.
+        //! [**symbolic api**] - Concretizes all symbolic memory references. With AST_DICTIONARIES, the symbolic expressions which are not reachable anymore are removed.
         void concretizeAllMemory(void);
 
-        //! [**symbolic api**] - Concretizes all symbolic register references.
+        //! [**symbolic api**] - Concretizes all symbolic register references. With AST_DICTIONARIES, the symbolic expressions which are not reachable anymore are removed.
         void concretizeAllRegister(void);
 
         //! [**symbolic api**] - Concretizes a specific symbolic memory reference.
@@ -517,6 +611,48 @@ namespace triton {
          */
         std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const;
 
+        /*!
+         * \brief [**solver api**] - Computes a model per query, in the order of the queries. The queries are solved on their own by a pool of threads.
+         *
+         * \description
+         * `threads` is the number of workers (0 for one per core) and `timeout` is the time limit of each query in
+         * milliseconds (0 for none). An unsat query (or a query out of time) has an empty model.
+         */
+        std::vector<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(const std::vector<triton::ast::AbstractNode*>& nodes, triton::uint32 threads=0, triton::uint32 timeout=0) const;
+
+        /*!
+         * \brief [**solver api**] - Computes a model per negated branch of the path constraints, in the order of `indexes`.
+         *
+         * \description
+         * `indexes` are the indexes of multiple branches path constraints (all of them which have a branch not taken if empty). See getModels()
+         * for `threads` and `timeout`.
+         */
+        std::vector<std::map<triton::uint32, triton::engines::solver::SolverModel>> getNegatedBranchModels(const std::vector<triton::usize>& indexes=std::vector<triton::usize>(), triton::uint32 threads=0, triton::uint32 timeout=0) const;
+
+        //! [**solver api**] - Returns true if the constraints of the solver session and the `node` (if not null) are satisfiable.
+        bool isSat(triton::ast::AbstractNode* node=nullptr) const;
+
+        //! [**solver api**] - Creates a new scope of constraints in the solver session.
+        void pushSolverScope(void);
+
+        //! [**solver api**] - Removes the constraints added to the solver session since the last push.
+        void popSolverScope(void);
+
+        //! [**solver api**] - Returns the number of scopes pushed in the solver session.
+        triton::usize getNumberOfSolverScopes(void) const;
+
+        //! [**solver api**] - Adds a constraint to the current scope of the solver session. It holds for all next queries until its scope is popped.
+        void addSolverConstraint(triton::ast::AbstractNode* node);
+
+        //! [**solver api**] - Removes all scopes and constraints of the solver session.
+        void resetSolverSession(void);
+
+        //! [**solver api**] - Returns the statistics of the solver cache (`entries`, `hits`, `counterexampleHits`, `misses` and `hitRate` as percentage).
+        std::map<std::string, triton::usize> getSolverCacheStats(void) const;
+
+        //! [**solver api**] - Removes all cached queries and models from the solver cache.
+        void flushSolverCache(void);
+
 
 
         /* Z3 interface API ============================================================================== */
@@ -541,7 +677,13 @@ namespace triton {
         triton::engines::taint::TaintEngine* getTaintEngine(void);
 
         //! [**taint api**] - Returns the tainted addresses.
-        const std::set<triton::uint64>& getTaintedMemory(void) const;
+        std::set<triton::uint64> getTaintedMemory(void) const;
+
+        //! [**taint api**] - Returns the tainted spans (start address -> size) which intersect the range `[baseAddr:size]`.
+        std::map<triton::uint64, triton::usize> getTaintedMemoryRanges(triton::uint64 baseAddr, triton::usize size) const;
+
+        //! [**taint api**] - Returns all tainted spans (start address -> size).
+        std::map<triton::uint64, triton::usize> getTaintedMemoryRanges(void) const;
 
         //! [**taint api**] - Returns the tainted registers.
         const std::set<triton::arch::Register>& getTaintedRegisters(void) const;
@@ -556,7 +698,7 @@ namespace triton {
         bool isTainted(const triton::arch::OperandWrapper& op) const;
 
         //! [**taint api**] - Returns true if the address:size is tainted.
-        bool isMemoryTainted(triton::uint64 addr, triton::uint32 size=1) const;
+        bool isMemoryTainted(triton::uint64 addr, triton::usize size=1) const;
 
         //! [**taint api**] - Returns true if the memory is tainted.
         bool isMemoryTainted(const triton::arch::MemoryAccess& mem) const;
@@ -579,6 +721,9 @@ namespace triton {
         //! [**taint api**] - Taints a memory. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
         bool taintMemory(const triton::arch::MemoryAccess& mem);
 
+        //! [**taint api**] - Taints the range `[baseAddr:size]`. Returns TAINTED if the range has been tainted correctly. Otherwise it returns the last defined state.
+        bool taintMemoryArea(triton::uint64 baseAddr, triton::usize size);
+
         //! [**taint api**] - Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
         bool taintRegister(const triton::arch::Register& reg);
 
@@ -588,6 +733,9 @@ namespace triton {
         //! [**taint api**] - Untaints a memory. Returns !TAINTED if the memory has been untainted correctly. Otherwise it returns the last defined state.
         bool untaintMemory(const triton::arch::MemoryAccess& mem);
 
+        //! [**taint api**] - Untaints the range `[baseAddr:size]`. Returns !TAINTED if the range has been untainted correctly. Otherwise it returns the last defined state.
+        bool untaintMemoryArea(triton::uint64 baseAddr, triton::usize size);
+
         //! [**taint api**] - Untaints a register. Returns !TAINTED if the register has been untainted correctly. Otherwise it returns the last defined state.
         bool untaintRegister(const triton::arch::Register& reg);
 
@@ -637,6 +785,50 @@ namespace triton {
     //! The API can be accessed everywhere (WIP: will be removed).
     extern triton::API api;
 
+    /*!
+     * \brief Returns the API bound to the calling thread, triton::api if there is none.
+     *
+     * \description
+     * AST nodes and registers are built in this API (e.g. the nodes are recorded by its garbage collector).
+     */
+    triton::API& currentApi(void);
+
+    /*! \class ApiBinding
+     *  \brief Binds an API to the calling thread during the lifetime of the binding.
+     *
+     * \description
+     * The methods of the API which handle ASTs bind it, thus nodes are built in the right API even if several
+     * instances are used on the same thread. A thread which builds nodes or registers by itself (e.g. with
+     * triton::ast::bv() or `Register(ID_REG_RAX)`) in an API other than triton::api must bind it first.
+     *
+     * ~~~~~~~~~~~~~{.cpp}
+     * std::thread worker([]() {
+     *   triton::API ctx;
+     *   triton::ApiBinding binding(ctx);
+     *   ctx.setArchitecture(triton::arch::ARCH_X86_64);
+     *   ...
+     * });
+     * ~~~~~~~~~~~~~
+     */
+    class ApiBinding {
+      private:
+        //! The API bound to the thread before this binding.
+        triton::API* previous;
+
+      public:
+        //! Constructor. Binds the API to the calling thread.
+        ApiBinding(const triton::API& instance);
+
+        //! Destructor. Binds the previous API again.
+        ~ApiBinding();
+
+        //! A binding cannot be copied.
+        ApiBinding(const ApiBinding& other) = delete;
+
+        //! A binding cannot be copied.
+        ApiBinding& operator=(const ApiBinding& other) = delete;
+    };
+
 /*! @} End of triton namespace */
 };
 
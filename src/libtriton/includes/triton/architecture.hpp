@@ -8,9 +8,12 @@
 #ifndef TRITON_ARCHITECTURE_H
 #define TRITON_ARCHITECTURE_H
 
+#include <functional>
+#include <map>
+#include <memory>
 #include <set>
+#include <string>
 #include <vector>
-#include <memory>
 
 #include <triton/callbacks.hpp>
 #include <triton/cpuInterface.hpp>
@@ -45,6 +48,23 @@ namespace triton {
       ARCH_LAST_ITEM    /*!< must be the last item.  */
     };
 
+    /*! The reasons why an emulation stops. \sa triton::API::emulate() */
+    enum emulation_e {
+      EMULATION_MAX_INSTRUCTIONS = 0, /*!< the maximum number of instructions has been executed. */
+      EMULATION_BREAKPOINT,           /*!< the program counter has reached a breakpoint. */
+      EMULATION_HOOK,                 /*!< an address hook has stopped the emulation. */
+      EMULATION_SYSCALL,              /*!< a system call has been executed. */
+      EMULATION_UNSUPPORTED,          /*!< the instruction cannot be disassembled or its semantics is not supported. */
+      EMULATION_UNMAPPED,             /*!< the program counter points to an unmapped memory. */
+    };
+
+    /*! \brief The prototype of an emulation hook.
+     *
+     * \description The hook takes as unique argument the address about to be executed. It may modify the
+     * program counter to skip the instruction. Returning false stops the emulation.
+     */
+    using emulationHookCallback = std::function<bool(triton::uint64)>;
+
     /*! \class Architecture
      *  \brief The abstract architecture class. */
     class Architecture {
@@ -105,6 +125,9 @@ namespace triton {
         //! Clears the architecture states (registers and memory).
         void clearArchitecture(void);
 
+        //! Inits the registers of the calling thread (e.g. `TRITON_X86_REG_RAX`) if they are defined for another architecture.
+        void initThreadRegisters(void) const;
+
         //! Returns all information about the register.
         triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const;
 
@@ -117,6 +140,12 @@ namespace triton {
         //! Disassembles the instruction according to the architecture.
         void disassembly(triton::arch::Instruction& inst) const;
 
+        //! Returns the statistics of the disassembly cache (`entries`, `hits`, `misses` and `hitRate`).
+        std::map<std::string, triton::usize> getDisassemblyCacheStats(void) const;
+
+        //! Removes all decoded instructions from the disassembly cache.
+        void flushDisassemblyCache(void);
+
         //! Builds the instruction semantics according to the architecture. Returns true if the instruction is supported.
         bool buildSemantics(triton::arch::Instruction& inst);
 
@@ -177,6 +206,30 @@ namespace triton {
 
         //! Removes the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
         void unmapMemory(triton::uint64 baseAddr, triton::usize size=1);
+
+        //! Maps the read-only `area` at `baseAddr` without copying it. Its pages are copied on their first write, `owner` keeps it alive meanwhile.
+        void mapMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner);
+
+        //! Maps zeros on the range `[baseAddr:size]`. The pages are only allocated on their first write.
+        void mapZeroMemory(triton::uint64 baseAddr, triton::usize size);
+
+        //! Takes a snapshot of the registers and of the memory. A previous snapshot is discarded.
+        void takeSnapshot(void);
+
+        //! Restores the registers and the memory as they were when the snapshot has been taken.
+        void restoreSnapshot(void);
+
+        //! Discards the snapshot.
+        void discardSnapshot(void);
+
+        //! Returns true if a snapshot is taken.
+        bool isSnapshotEnabled(void) const;
+
+        //! Returns the program counter register.
+        const triton::arch::Register& getProgramCounter(void) const;
+
+        //! Returns true if the instruction is a system call.
+        bool isSyscall(const triton::arch::Instruction& inst) const;
     };
 
   /*! @} End of arch namespace */
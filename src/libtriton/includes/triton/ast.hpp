@@ -10,6 +10,7 @@
 
 #include <list>
 #include <map>
+#include <new>
 #include <ostream>
 #include <set>
 #include <stdexcept>
@@ -17,7 +18,9 @@
 #include <vector>
 
 #include <triton/astEnums.hpp>
+#include <triton/astNodeList.hpp>
 #include <triton/astVisitor.hpp>
+#include <triton/cpuSize.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -30,6 +33,8 @@ namespace triton {
  *  @{
  */
 
+  class API;
+
   //! The AST namespace
   namespace ast {
   /*!
@@ -41,24 +46,69 @@ namespace triton {
     //! Abstract node
     class AbstractNode {
       protected:
+        //! The API which has built the node (the API bound to the thread at the construction).
+        triton::API* api;
+
         //! The kind of the node.
         enum kind_e kind;
 
         //! The childs of the node.
-        std::vector<AbstractNode*> childs;
+        AstChildList childs;
 
         //! The parents of the node. Empty if there is still no parent.
-        std::set<AbstractNode*> parents;
+        AstParentList parents;
 
         //! The size of the node.
         triton::uint32 size;
 
-        //! The value of the tree from this root node.
-        triton::uint512 eval;
+        //! The value of the tree from this root node if the node is 64 bits or less.
+        triton::uint64 eval;
+
+        //! The value of the tree from this root node if the node is wider than 64 bits (SSE/AVX). nullptr otherwise.
+        triton::uint512* evalWide;
 
         //! This value is set to true if the tree contains a symbolic variable.
         bool symbolized;
 
+        //! The number of references held on the node (symbolic expressions, path constraints, bindings, ...).
+        triton::uint32 refCount;
+
+        //! This value is set to true if the garbage collector has released the node while it was still referenced.
+        bool released;
+
+        //! This value is set to true if a node of the tree has changed since the last init of this node (`LAZY_EVALUATION` mode).
+        bool dirty;
+
+        //! The structural hash of the tree from this root node. It is computed from the hashes of the childs at each init.
+        triton::uint64 structuralHash;
+
+        //! The structural hash of the node when it has been recorded into the AST dictionaries (see `inDictionaries`).
+        triton::uint64 dictionaryHash;
+
+        //! This value is set to true if the node is recorded into the AST dictionaries.
+        bool inDictionaries;
+
+        //! The previous node recorded by the AST garbage collector.
+        AbstractNode* prevRecorded;
+
+        //! The next node recorded by the AST garbage collector.
+        AbstractNode* nextRecorded;
+
+        //! Computes the structural hash of the node (kind, size, value of leaves and hashes of childs).
+        void initHash(void);
+
+        //! Inits the hash and the parents, or marks them dirty if the `LAZY_EVALUATION` mode is enabled. Each init ends with this call.
+        void initParents(void);
+
+        //! Inits again the dirty nodes of the tree, childs first.
+        void refresh(void) const;
+
+        //! Sets the value of a node of 64 bits or less.
+        void setEval(triton::uint64 value);
+
+        //! Sets the value of the node. The storage (native or wide) depends on the size of the node.
+        void setEval(const triton::uint512& value);
+
       public:
         //! Constructor.
         AbstractNode(enum kind_e kind);
@@ -72,6 +122,21 @@ namespace triton {
         //! Destructor.
         virtual ~AbstractNode();
 
+        //! Allocates a node from the AST allocator.
+        static void* operator new(std::size_t size);
+
+        //! Allocates a node from the AST allocator. Returns nullptr if there is not enough memory.
+        static void* operator new(std::size_t size, const std::nothrow_t&) noexcept;
+
+        //! Gives a node back to the AST allocator.
+        static void operator delete(void* ptr) noexcept;
+
+        //! Gives a node back to the AST allocator.
+        static void operator delete(void* ptr, const std::nothrow_t&) noexcept;
+
+        //! Returns the API which has built the node.
+        triton::API* getApi(void) const;
+
         //! Returns the kind of the node.
         enum kind_e getKind(void) const;
 
@@ -87,7 +152,12 @@ namespace triton {
         //! Returns true if the tree contains a symbolic variable.
         bool isSymbolized(void) const;
 
-        //! Returns true if the current tree is equal to the second one.
+        /*!
+         * \brief Returns true if the current tree is equal to the second one.
+         *
+         * \description
+         * Trees are compared by their structural hash, the structures are then walked only if hashes are equal.
+         */
         bool equalTo(const AbstractNode&) const;
 
         //! Returns true if the current tree is equal to the second one.
@@ -96,8 +166,32 @@ namespace triton {
         //! Evaluates the tree.
         triton::uint512 evaluate(void) const;
 
+        //! Evaluates the tree and returns its 64 lower bits. This is the fast path for nodes of 64 bits or less.
+        triton::uint64 evaluate64(void) const;
+
+        //! Returns the structural hash of the tree. Unlike `hash()`, it is cached in the node thus it is O(1).
+        triton::uint64 getHash(void) const;
+
+        //! Returns the structural hash of the node when it has been recorded into the AST dictionaries. It does not change if the childs are changed later.
+        triton::uint64 getDictionaryHash(void) const;
+
+        //! Returns true if the node is recorded into the AST dictionaries.
+        bool isInDictionaries(void) const;
+
+        //! Marks the node as recorded (with the hash of its slot) or not recorded into the AST dictionaries.
+        void setInDictionaries(bool flag, triton::uint64 hash);
+
+        //! Returns the previous node recorded by the AST garbage collector.
+        AbstractNode* getPrevRecorded(void) const;
+
+        //! Returns the next node recorded by the AST garbage collector.
+        AbstractNode* getNextRecorded(void) const;
+
+        //! Sets the neighbours of the node in the list of the AST garbage collector.
+        void setRecorded(AbstractNode* prev, AbstractNode* next);
+
         //! Returns the childs of the node.
-        std::vector<AbstractNode*>& getChilds(void);
+        AstChildList& getChilds(void);
 
         /*!
          * \brief Returns the parents of node or an empty set if there is still no parent defined.
@@ -105,7 +199,7 @@ namespace triton {
          * Note that if there is the `AST_DICTIONARIES` optimization enabled, this feature will
          * probably not represent the real tree of your expression.
          */
-        std::set<AbstractNode*>& getParents(void);
+        AstParentList& getParents(void);
 
         //! Removes a parent node.
         void removeParent(AbstractNode* p);
@@ -114,17 +208,41 @@ namespace triton {
         void setParent(AbstractNode* p);
 
         //! Sets the parent nodes.
-        void setParent(std::set<AbstractNode*>& p);
+        void setParent(const AstParentList& p);
 
         //! Sets the size of the node.
         void setBitvectorSize(triton::uint32 size);
 
+        //! Returns the number of references held on the node.
+        triton::uint32 getRefCount(void) const;
+
+        //! Takes a reference on the node.
+        void incRefCount(void);
+
+        //! Drops a reference on the node. A released node is deleted with its last reference.
+        void decRefCount(void);
+
+        /*!
+         * \brief Releases the node from its garbage collector.
+         *
+         * \description
+         * The node is deleted if it is not referenced. Otherwise, it is detached from the tree
+         * (its childs and parents are cleared) and it will be deleted with its last reference.
+         */
+        void release(void);
+
         //! Adds a child.
         void addChild(AbstractNode* child);
 
         //! Sets a child at an index.
         void setChild(triton::uint32 index, AbstractNode* child);
 
+        //! Marks the ancestors of the node dirty. They will be init again when they are queried.
+        void invalidateParents(void);
+
+        //! Returns true if the node must be init again before being queried.
+        bool isDirty(void) const;
+
         //! Init stuffs like size and eval.
         virtual void init(void) = 0;
 
@@ -678,6 +796,9 @@ namespace triton {
       protected:
         triton::usize value;
 
+        //! The AST of the referenced expression which has this node as parent.
+        AbstractNode* ast;
+
       public:
         ReferenceNode(triton::usize value);
         ReferenceNode(const ReferenceNode& copy);
@@ -687,6 +808,9 @@ namespace triton {
         virtual triton::uint512 hash(triton::uint32 deep) const;
 
         triton::usize getValue(void);
+
+        //! Unlinks the node from the AST of the referenced expression and returns this AST. Must be called before deleting a shared node.
+        AbstractNode* detach(void);
     };
 
 
@@ -919,6 +1043,9 @@ namespace triton {
     //! AST C++ API - Duplicates the AST
     AbstractNode* newInstance(AbstractNode* node);
 
+    //! AST C++ API - Returns a copy of the node with other childs of the same sizes. The childs are not duplicated.
+    AbstractNode* newInstance(AbstractNode* node, const AstChildList& childs);
+
     //! Custom pow function for hash routine.
     triton::uint512 pow(triton::uint512 hash, triton::uint32 n);
 
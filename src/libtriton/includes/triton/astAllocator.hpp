@@ -0,0 +1,174 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTALLOCATOR_H
+#define TRITON_ASTALLOCATOR_H
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class AstAllocator
+     *  \brief The size-class slab allocator of AST nodes.
+     *
+     * \description
+     * Nodes are carved from slabs of 64 KiB. Each slab serves one size class
+     * (multiple of 16 bytes), thus nodes of the same kind are packed together and freeing a
+     * node only pushes its block on the free list of its slab. Slabs are aligned on their size,
+     * the slab of a block is found by masking its address. Empty slabs are kept for reuse until
+     * releaseFreeSlabs() gives them back to the system as a whole.
+     *
+     * Slabs are split by arena (the API which allocates the node), thus the nodes of an API do not
+     * share their slabs with the nodes of another API and its slabs become empty once it frees all its
+     * nodes. A block may also be discarded: its object has been destroyed in place and the block is
+     * only reused once its whole slab is empty.
+     *
+     * Each thread allocates from its own allocator without lock. A block may be freed by another
+     * thread, it is then pushed on the atomic list of remote blocks of the allocator which owns its
+     * slab, and this allocator takes them back at its next allocation.
+     */
+    class AstAllocator {
+      protected:
+        //! Header of a slab, blocks follow the header.
+        struct Slab {
+          //! The allocator which owns the slab.
+          AstAllocator* owner;
+
+          //! The lists of slabs with free blocks of the arena of the slab (one list per size class).
+          Slab** arenaSlabs;
+
+          //! Previous slab with free blocks in the same size class.
+          Slab* prev;
+
+          //! Next slab with free blocks in the same size class.
+          Slab* next;
+
+          //! Singly linked list of freed blocks.
+          void* freeBlocks;
+
+          //! Size class of the slab (blocks of `(sizeClass + 1) * 16` bytes). Big blocks have their own slab.
+          triton::uint32 sizeClass;
+
+          //! Number of blocks in use.
+          triton::uint32 used;
+
+          //! Number of blocks already carved from the slab.
+          triton::uint32 carved;
+
+          //! Maximum number of blocks.
+          triton::uint32 capacity;
+
+          //! True if the slab is linked in the list of slabs with free blocks.
+          bool available;
+        };
+
+        //! Per arena, the lists of slabs with free blocks (one list per size class).
+        std::map<const void*, std::vector<Slab*>> arenas;
+
+        //! The arena of the last allocation.
+        const void* lastArena;
+
+        //! The lists of slabs with free blocks of the last arena.
+        Slab** lastArenaSlabs;
+
+        //! All slabs.
+        std::vector<Slab*> slabs;
+
+        //! Number of blocks in use.
+        triton::usize usedBlocks;
+
+        //! The blocks freed by other threads, linked through their first word. Only the owner takes them back.
+        std::atomic<void*> remoteBlocks;
+
+        //! True if the allocator is shared by several threads (see astAllocator()). Its slabs are then protected by `lock`.
+        bool shared;
+
+        //! Protects the slabs of a shared allocator.
+        std::mutex lock;
+
+        //! Returns the lists of slabs with free blocks of an arena.
+        Slab** getArenaSlabs(const void* arena);
+
+        //! Allocates a slab aligned on its size.
+        Slab* newSlab(triton::uint32 sizeClass, triton::usize bytes, Slab** arenaSlabs);
+
+        //! Gives a slab back to the system.
+        void deleteSlab(Slab* slab);
+
+        //! Links a slab in the list of slabs with free blocks.
+        void linkSlab(Slab* slab);
+
+        //! Unlinks a slab from the list of slabs with free blocks.
+        void unlinkSlab(Slab* slab);
+
+        //! Gives a block of a slab of this allocator back (owner only). If `reuse` is false, the block is only reused once the slab is empty.
+        void freeBlock(void* ptr, bool reuse);
+
+        //! Takes back the blocks freed by other threads (owner only).
+        void drainRemoteBlocks(void);
+
+      public:
+        //! Constructor.
+        AstAllocator(bool shared=false);
+
+        //! Allocates a block of `size` bytes in an arena.
+        void* allocate(triton::usize size, const void* arena=nullptr);
+
+        //! Frees a block.
+        void deallocate(void* ptr);
+
+        //! Returns true if the block belongs to a slab of this allocator.
+        bool owns(const void* ptr) const;
+
+        //! Discards a block of this allocator whose object has been destroyed in place. The block is reused once its slab is empty.
+        void discard(void* ptr);
+
+        //! Gives all slabs without block in use back to the system.
+        void releaseFreeSlabs(void);
+
+        //! Returns stats about the allocator (`slabs`, `usedBlocks`, `bytes`).
+        std::map<std::string, triton::usize> getStats(void);
+    };
+
+    /*!
+     * \brief Returns the allocator of AST nodes of the calling thread.
+     *
+     * \description
+     * Allocators are never destroyed, nodes may be released after the static destructors
+     * (e.g. by Python objects at exit) or after the exit of the thread which allocated them.
+     * The allocator of an exited thread is reused by the next thread. A thread which allocates
+     * after its exit uses an allocator shared by all exited threads.
+     */
+    AstAllocator& astAllocator(void);
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTALLOCATOR_H */
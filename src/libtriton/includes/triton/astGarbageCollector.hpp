@@ -40,36 +40,62 @@ namespace triton {
         //! Modes API
         triton::modes::Modes* modes;
 
-        //! Defines if this instance is used as a backup.
-        bool backupFlag;
+        //! Defines if the allocated nodes must also be recorded as temporary nodes.
+        bool temporaryFlag;
+
+        //! Deletes the shared nodes of the set which are unused, and then their unused childs.
+        void sweepAstNodes(std::set<triton::ast::AbstractNode*>& nodes);
+
+        //! Returns true if the node is in the list of recorded nodes.
+        bool isRecorded(triton::ast::AbstractNode* node) const;
+
+        //! Adds a node to the list of recorded nodes.
+        void linkAstNode(triton::ast::AbstractNode* node);
+
+        //! Removes a node from the list of recorded nodes.
+        void unlinkAstNode(triton::ast::AbstractNode* node);
 
       protected:
-        //! This container contains all allocated nodes.
-        std::set<triton::ast::AbstractNode*> allocatedNodes;
+        //! The head of the list of all recorded nodes (dictionaries included). Nodes are linked through their `prevRecorded` and `nextRecorded` fields.
+        triton::ast::AbstractNode* allocatedNodes;
 
         //! This map maintains a link between symbolic variables and their nodes.
         std::map<std::string, triton::ast::AbstractNode*> variableNodes;
 
+        //! This container contains all nodes allocated since the last call to beginTemporaryAstNodes().
+        std::set<triton::ast::AbstractNode*> temporaryNodes;
+
       public:
         //! Constructor.
-        AstGarbageCollector(triton::modes::Modes* modes, bool isBackup=false);
+        AstGarbageCollector(triton::modes::Modes* modes);
 
-        //! Constructor by copy.
-        AstGarbageCollector(const AstGarbageCollector& other);
+        //! Recorded nodes are linked to their collector, it cannot be copied.
+        AstGarbageCollector(const AstGarbageCollector& other) = delete;
 
         //! Destructor.
         virtual ~AstGarbageCollector();
 
-        //! Copies an AstGarbageCollectors.
-        void operator=(const AstGarbageCollector& other);
-
-        //! Copies an AstGarbageCollectors..
-        void copy(const AstGarbageCollector& other);
-
-        //! Go through every allocated nodes and free them.
+        //! Recorded nodes are linked to their collector, it cannot be copied.
+        AstGarbageCollector& operator=(const AstGarbageCollector& other) = delete;
+
+        /*!
+         * \brief Frees all recorded nodes (dictionaries included).
+         *
+         * \description
+         * The nodes are destroyed in place without going back to the free lists of the AST allocator,
+         * and then the empty slabs are given back to the system as a whole. Referenced nodes are only
+         * detached, they are deleted with their last reference.
+         */
         void freeAllAstNodes(void);
 
-        //! Frees a set of nodes and removes them from the global container.
+        /*!
+         * \brief Frees a set of nodes and removes them from the global container.
+         *
+         * \description
+         * If the `AST_DICTIONARIES` optimization is enabled, nodes are shared thus only nodes which
+         * are neither referenced nor used by a parent are deleted. Referenced nodes are never deleted,
+         * they are detached from the tree and deleted with their last reference.
+         */
         void freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes);
 
         //! Extracts all unique nodes from a partial AST into the uniqueNodes set.
@@ -78,11 +104,17 @@ namespace triton {
         //! Records the allocated node or returns the same node if it already exists inside the dictionaries.
         triton::ast::AbstractNode* recordAstNode(triton::ast::AbstractNode* node);
 
+        //! Starts recording all allocated nodes as temporary nodes.
+        void beginTemporaryAstNodes(void);
+
+        //! Stops recording temporary nodes and moves them into the nodes set.
+        void endTemporaryAstNodes(std::set<triton::ast::AbstractNode*>& nodes);
+
         //! Records a variable AST node.
         void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
 
-        //! Returns all allocated nodes.
-        const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
+        //! Returns all recorded nodes.
+        std::set<triton::ast::AbstractNode*> getAllocatedAstNodes(void) const;
 
         //! Returns all variable nodes recorded.
         const std::map<std::string, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
@@ -90,7 +122,7 @@ namespace triton {
         //! Returns the node of a recorded variable.
         triton::ast::AbstractNode* getAstVariableNode(const std::string& name) const;
 
-        //! Sets all allocated nodes.
+        //! Sets all recorded nodes. Recorded nodes which are not in the set are released.
         void setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes);
 
         //! Sets all variable nodes recorded.
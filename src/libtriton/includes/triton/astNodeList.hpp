@@ -0,0 +1,251 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTNODELIST_H
+#define TRITON_ASTNODELIST_H
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <unordered_map>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    class AbstractNode;
+
+    /*! \class AstNodeList
+     *  \brief A list of nodes with inline storage.
+     *
+     * \description
+     * The first `N` nodes are stored inside the list itself, thus small lists do not allocate
+     * anything. Beyond, the nodes are moved into a heap buffer which grows geometrically.
+     */
+    template <triton::uint32 N>
+    class AstNodeList {
+      protected:
+        //! The inline storage.
+        AbstractNode* inlineNodes[N];
+
+        //! The nodes (points to `inlineNodes` or to a heap buffer).
+        AbstractNode** nodes;
+
+        //! The number of nodes.
+        triton::uint32 count;
+
+        //! The number of nodes which can be stored without growing.
+        triton::uint32 capacity;
+
+        //! Doubles the capacity of the list.
+        void grow(void) {
+          triton::uint32 newCapacity = this->capacity * 2;
+          AbstractNode** newNodes    = static_cast<AbstractNode**>(std::malloc(newCapacity * sizeof(AbstractNode*)));
+
+          if (newNodes == nullptr)
+            throw std::bad_alloc();
+
+          std::memcpy(newNodes, this->nodes, this->count * sizeof(AbstractNode*));
+          if (this->nodes != this->inlineNodes)
+            std::free(this->nodes);
+
+          this->nodes    = newNodes;
+          this->capacity = newCapacity;
+        }
+
+        //! Copies an AstNodeList.
+        void copy(const AstNodeList& other) {
+          this->count = 0;
+          for (triton::uint32 index = 0; index < other.count; index++)
+            this->push_back(other.nodes[index]);
+        }
+
+      public:
+        //! Iterator over the nodes.
+        typedef AbstractNode** iterator;
+
+        //! Constant iterator over the nodes.
+        typedef AbstractNode* const* const_iterator;
+
+        //! Constructor.
+        AstNodeList() {
+          this->nodes    = this->inlineNodes;
+          this->count    = 0;
+          this->capacity = N;
+        }
+
+        //! Constructor by copy.
+        AstNodeList(const AstNodeList& other) : AstNodeList() {
+          this->copy(other);
+        }
+
+        //! Destructor.
+        ~AstNodeList() {
+          if (this->nodes != this->inlineNodes)
+            std::free(this->nodes);
+        }
+
+        //! Copies an AstNodeList.
+        void operator=(const AstNodeList& other) {
+          if (this != &other)
+            this->copy(other);
+        }
+
+        //! Returns true if both lists contain the same nodes in the same order.
+        bool operator==(const AstNodeList& other) const {
+          return this->count == other.count && std::memcmp(this->nodes, other.nodes, this->count * sizeof(AbstractNode*)) == 0;
+        }
+
+        //! Returns true if lists are different.
+        bool operator!=(const AstNodeList& other) const {
+          return !(*this == other);
+        }
+
+        //! Returns the node at the index.
+        AbstractNode*& operator[](triton::usize index) {
+          return this->nodes[index];
+        }
+
+        //! Returns the node at the index.
+        AbstractNode* operator[](triton::usize index) const {
+          return this->nodes[index];
+        }
+
+        //! Returns an iterator on the first node.
+        iterator begin(void) {
+          return this->nodes;
+        }
+
+        //! Returns an iterator after the last node.
+        iterator end(void) {
+          return this->nodes + this->count;
+        }
+
+        //! Returns an iterator on the first node.
+        const_iterator begin(void) const {
+          return this->nodes;
+        }
+
+        //! Returns an iterator after the last node.
+        const_iterator end(void) const {
+          return this->nodes + this->count;
+        }
+
+        //! Returns the number of nodes.
+        triton::usize size(void) const {
+          return this->count;
+        }
+
+        //! Returns true if the list is empty.
+        bool empty(void) const {
+          return this->count == 0;
+        }
+
+        //! Appends a node.
+        void push_back(AbstractNode* node) {
+          if (this->count == this->capacity)
+            this->grow();
+          this->nodes[this->count++] = node;
+        }
+
+        //! Removes the last node.
+        void pop_back(void) {
+          this->count--;
+        }
+
+        //! Removes all nodes.
+        void clear(void) {
+          this->count = 0;
+        }
+    };
+
+
+    //! The childs of a node. Most of nodes have up to 3 childs.
+    typedef AstNodeList<3> AstChildList;
+
+
+    /*! \class AstParentList
+     *  \brief The parents of a node.
+     *
+     * \description
+     * A set of nodes without order. Most of nodes have one or two parents which are stored
+     * inline. Nodes shared by the `AST_DICTIONARIES` optimization may have a lot of parents,
+     * in this case an index is built to keep insertions and removals in constant time.
+     */
+    class AstParentList {
+      protected:
+        //! The parents.
+        AstNodeList<2> nodes;
+
+        //! Position of each parent in `nodes` (nullptr while the list is small).
+        std::unordered_map<AbstractNode*, triton::uint32>* index;
+
+        //! Returns the position of a parent or -1 if it is not in the list.
+        triton::sint64 find(AbstractNode* node) const;
+
+        //! Copies an AstParentList.
+        void copy(const AstParentList& other);
+
+      public:
+        //! Iterator over the parents.
+        typedef AstNodeList<2>::const_iterator const_iterator;
+
+        //! Constructor.
+        AstParentList();
+
+        //! Constructor by copy.
+        AstParentList(const AstParentList& other);
+
+        //! Destructor.
+        ~AstParentList();
+
+        //! Copies an AstParentList.
+        void operator=(const AstParentList& other);
+
+        //! Returns an iterator on the first parent.
+        const_iterator begin(void) const;
+
+        //! Returns an iterator after the last parent.
+        const_iterator end(void) const;
+
+        //! Returns the number of parents.
+        triton::usize size(void) const;
+
+        //! Returns true if there is no parent.
+        bool empty(void) const;
+
+        //! Adds a parent if it is not already in the list.
+        void insert(AbstractNode* node);
+
+        //! Removes a parent.
+        void erase(AbstractNode* node);
+
+        //! Removes all parents.
+        void clear(void);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTNODELIST_H */
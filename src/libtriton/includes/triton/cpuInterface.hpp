@@ -8,7 +8,10 @@
 #ifndef TRITON_CPUINTERFACE_HPP
 #define TRITON_CPUINTERFACE_HPP
 
+#include <map>
+#include <memory>
 #include <set>
+#include <string>
 #include <vector>
 
 #include <triton/instruction.hpp>
@@ -41,7 +44,7 @@ namespace triton {
         //! Destructor.
         virtual ~CpuInterface(){};
 
-        //! The first function called when the a CPU is initialized.
+        //! The first function called when the a CPU is initialized. It defines the registers of the calling thread (e.g. `TRITON_X86_REG_RAX`).
         virtual void init(void) = 0;
 
         //! Clears the architecture states (registers and memory).
@@ -77,6 +80,12 @@ namespace triton {
         //! Disassembles the instruction according to the architecture.
         virtual void disassembly(triton::arch::Instruction& inst) const = 0;
 
+        //! Returns the statistics of the disassembly cache (`entries`, `hits`, `misses` and `hitRate`).
+        virtual std::map<std::string, triton::usize> getDisassemblyCacheStats(void) const = 0;
+
+        //! Removes all decoded instructions from the disassembly cache.
+        virtual void flushDisassemblyCache(void) = 0;
+
         //! Returns the concrete value of a memory cell.
         virtual triton::uint8 getConcreteMemoryValue(triton::uint64 addr) const = 0;
 
@@ -129,11 +138,40 @@ namespace triton {
          */
         virtual void setConcreteRegisterValue(const triton::arch::Register& reg) = 0;
 
-        //! Returns true if the range `[baseAddr:size]` is mapped into the internal memory representation. \sa getConcreteMemoryValue() and getConcreteMemoryAreaValue().
+        //! Returns true if all pages covering the range `[baseAddr:size]` are mapped into the internal memory representation. \sa getConcreteMemoryValue() and getConcreteMemoryAreaValue().
         virtual bool isMemoryMapped(triton::uint64 baseAddr, triton::usize size=1) = 0;
 
-        //! Removes the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
+        //! Removes all pages covering the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
         virtual void unmapMemory(triton::uint64 baseAddr, triton::usize size=1) = 0;
+
+        /*!
+         * \brief [**architecture api**] - Maps the read-only `area` at `baseAddr` without copying it.
+         *
+         * \description The pages fully covered by the area are copied on their first write, `owner` keeps
+         * the area alive meanwhile. Like setConcreteMemoryAreaValue(), it does not modify the symbolic state.
+         */
+        virtual void mapMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner) = 0;
+
+        //! [**architecture api**] - Maps zeros on the range `[baseAddr:size]`. The pages fully covered are only allocated on their first write.
+        virtual void mapZeroMemory(triton::uint64 baseAddr, triton::usize size) = 0;
+
+        //! Takes a snapshot of the registers and of the memory. The memory pages are saved on their first write. A previous snapshot is discarded.
+        virtual void takeSnapshot(void) = 0;
+
+        //! Restores the registers and the memory as they were when the snapshot has been taken. The snapshot is kept.
+        virtual void restoreSnapshot(void) = 0;
+
+        //! Discards the snapshot.
+        virtual void discardSnapshot(void) = 0;
+
+        //! Returns true if a snapshot is taken.
+        virtual bool isSnapshotEnabled(void) const = 0;
+
+        //! Returns the program counter register.
+        virtual const triton::arch::Register& getProgramCounter(void) const = 0;
+
+        //! Returns true if the instruction is a system call.
+        virtual bool isSyscall(const triton::arch::Instruction& inst) const = 0;
     };
 
   /*! @} End of arch namespace */
@@ -53,6 +53,9 @@
 /*! Returns the DQQWORD size in bit. */
 #define DQQWORD_SIZE_BIT 512
 
+/*! Returns the size in byte of a concrete memory page. */
+#define MEMORY_PAGE_SIZE 0x1000
+
 /*! Returns the max bits supported */
 #define MAX_BITS_SUPPORTED DQQWORD_SIZE_BIT
 
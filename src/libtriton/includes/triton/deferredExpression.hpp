@@ -0,0 +1,131 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_DEFERREDEXPRESSION_H
+#define TRITON_DEFERREDEXPRESSION_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/symbolicExpression.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! The builder of a deferred AST.
+      using deferredBuilder = std::function<triton::ast::AbstractNode*(void)>;
+
+      //! \class DeferredExpression
+      /*! \brief The deferred definition of a register (triton::modes::LAZY_FLAGS).
+       *
+       * \description
+       * The AST of the register is built by the builder only when the register is read. The builder may refer
+       * to the parent expression (the result of the instruction) and to two operand nodes. A reference is held
+       * on these nodes as long as the definition lives. The ids of the expressions referenced by the parent
+       * and the operand nodes are recorded, the definition must be dropped if one of them is removed.
+       */
+      class DeferredExpression {
+        private:
+          //! The builder of the AST.
+          deferredBuilder builder;
+
+          //! The AST of the parent expression, op1 and op2 (nullptr if unused).
+          triton::ast::AbstractNode* nodes[3];
+
+          //! The id of the parent expression (UNSET if none).
+          triton::usize parentId;
+
+          //! The ids of the expressions the built AST would refer to.
+          std::vector<triton::usize> references;
+
+          //! The comment of the symbolic expression.
+          std::string comment;
+
+          //! True if the register is tainted.
+          bool tainted;
+
+          //! Copies a DeferredExpression.
+          void copy(const DeferredExpression& other);
+
+          //! Drops the references held on the nodes.
+          void release(void);
+
+          //! Records the ids of the expressions referenced by a node.
+          void collectReferences(triton::ast::AbstractNode* node);
+
+        public:
+          //! Constructor.
+          DeferredExpression(const deferredBuilder& builder,
+                             SymbolicExpression* parent,
+                             triton::ast::AbstractNode* op1,
+                             triton::ast::AbstractNode* op2,
+                             const std::string& comment);
+
+          //! Constructor by copy.
+          DeferredExpression(const DeferredExpression& other);
+
+          //! Destructor.
+          virtual ~DeferredExpression();
+
+          //! Copies a DeferredExpression.
+          void operator=(const DeferredExpression& other);
+
+          //! Builds the AST of the register.
+          triton::ast::AbstractNode* buildAst(void) const;
+
+          //! Returns the comment of the symbolic expression.
+          const std::string& getComment(void) const;
+
+          //! Returns the id of the parent expression (UNSET if none).
+          triton::usize getParentId(void) const;
+
+          //! Returns the ids of the expressions the built AST would refer to.
+          const std::vector<triton::usize>& getReferences(void) const;
+
+          //! Returns true if the AST will contain a symbolic variable. The AST is not built.
+          bool isSymbolized(void) const;
+
+          //! Returns true if the AST will refer to the expression `symExprId`.
+          bool isReferencing(triton::usize symExprId) const;
+
+          //! Returns true if the register is tainted.
+          bool isTainted(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DEFERREDEXPRESSION_H */
@@ -0,0 +1,92 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_DISASSEMBLYCACHE_H
+#define TRITON_DISASSEMBLYCACHE_H
+
+#include <map>
+#include <string>
+
+#include <triton/instruction.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class DisassemblyCache
+     *  \brief The cache of decoded instructions.
+     *
+     * \description
+     * Each entry is keyed by the instruction address and is only reused if the opcodes
+     * given for this address are the same as the cached ones. Thus, a loop body is decoded
+     * once and self-modifying code is decoded again.
+     */
+    class DisassemblyCache {
+      protected:
+        /*! \brief map of address -> decoded instruction
+         *
+         * \description
+         * **item1**: instruction address<br>
+         * **item2**: decoded instruction (opcodes, type, prefix, disassembly and operands)
+         */
+        std::map<triton::uint64, triton::arch::Instruction> instructions;
+
+        //! Number of lookups which have been satisfied by the cache.
+        triton::usize hits;
+
+        //! Number of lookups which have not been satisfied by the cache.
+        triton::usize misses;
+
+        //! Copies a DisassemblyCache.
+        void copy(const DisassemblyCache& other);
+
+      public:
+        //! Constructor.
+        DisassemblyCache();
+
+        //! Constructor by copy.
+        DisassemblyCache(const DisassemblyCache& other);
+
+        //! Destructor.
+        virtual ~DisassemblyCache();
+
+        //! Copies a DisassemblyCache.
+        void operator=(const DisassemblyCache& other);
+
+        //! Fills the instruction from the cache. Returns true if the instruction has been found.
+        bool load(triton::arch::Instruction& inst);
+
+        //! Records a freshly disassembled instruction into the cache.
+        void store(const triton::arch::Instruction& inst);
+
+        //! Removes all decoded instructions and resets the statistics.
+        void flush(void);
+
+        //! Returns the statistics of the cache (`entries`, `hits`, `misses` and `hitRate` as percentage).
+        std::map<std::string, triton::usize> getStats(void) const;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DISASSEMBLYCACHE_H */
@@ -19,6 +19,7 @@
 #include <triton/elfRelocationTable.hpp>
 #include <triton/elfSectionHeader.hpp>
 #include <triton/elfSymbolTable.hpp>
+#include <triton/mappedFile.hpp>
 #include <triton/memoryMapping.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -48,18 +49,20 @@ namespace triton {
      */
 
       /*! \class Elf
-       *  \brief The ELF format class. */
+       *  \brief The ELF format class.
+       *
+       * \description
+       * The ELF Header and the Program Headers are parsed when the binary is opened. The other
+       * tables are parsed from the file the first time they are requested.
+       */
       class Elf : public BinaryInterface {
         protected:
-          //! Path file of the binary.
-          std::string path;
+          //! The binary file.
+          triton::format::MappedFile* file;
 
           //! Total size of the binary file.
           triton::usize totalSize;
 
-          //! The raw binary.
-          std::vector<triton::uint8> raw;
-
           //! The ELF Header
           triton::format::elf::ElfHeader header;
 
@@ -67,19 +70,31 @@ namespace triton {
           std::vector<triton::format::elf::ElfProgramHeader> programHeaders;
 
           //! The Section Headers
-          std::vector<triton::format::elf::ElfSectionHeader> sectionHeaders;
+          mutable std::vector<triton::format::elf::ElfSectionHeader> sectionHeaders;
 
           //! The dynamic table.
-          std::vector<triton::format::elf::ElfDynamicTable> dynamicTable;
+          mutable std::vector<triton::format::elf::ElfDynamicTable> dynamicTable;
 
           //! The symbols table.
-          std::vector<triton::format::elf::ElfSymbolTable> symbolsTable;
+          mutable std::vector<triton::format::elf::ElfSymbolTable> symbolsTable;
 
           //! The relocations table.
-          std::vector<triton::format::elf::ElfRelocationTable> relocationsTable;
+          mutable std::vector<triton::format::elf::ElfRelocationTable> relocationsTable;
 
           //! The shared libraries dependency.
-          std::vector<std::string> sharedLibraries;
+          mutable std::vector<std::string> sharedLibraries;
+
+          //! True if the Section Headers are parsed.
+          mutable bool sectionHeadersParsed;
+
+          //! True if the dynamic table and the shared libraries are parsed.
+          mutable bool dynamicTableParsed;
+
+          //! True if the symbols table is parsed.
+          mutable bool symbolsTableParsed;
+
+          //! True if the relocations table is parsed.
+          mutable bool relocationsTableParsed;
 
           /*!
            * \description The list of memory areas which may be mapped into the Triton memory.
@@ -87,35 +102,44 @@ namespace triton {
            */
           std::list<triton::format::MemoryMapping> memoryMapping;
 
-          //! Open the binary.
-          void open(void);
+          //! Init the members and parse the binary.
+          void init(void);
 
-          //! Parse the binary.
+          //! Parse the ELF Header and the Program Headers.
           bool parse(void);
 
+          //! Init the Section Headers.
+          void initSectionHeaders(void) const;
+
           //! Init the memory mapping.
           void initMemoryMapping(void);
 
           //! Init the dynamic table.
-          void initDynamicTable(void);
+          void initDynamicTable(void) const;
 
           //! Init the list of shared libraries dependency.
-          void initSharedLibraries(void);
+          void initSharedLibraries(void) const;
+
+          //! Init the symbols table.
+          void initSymbolsTable(void) const;
 
           //! Init the symbols table via the program headers.
-          void initSymbolsTableViaProgramHeaders(void);
+          void initSymbolsTableViaProgramHeaders(void) const;
 
           //! Init the symbols table via the section headers.
-          void initSymbolsTableViaSectionHeaders(void);
+          void initSymbolsTableViaSectionHeaders(void) const;
+
+          //! Init the relocations table.
+          void initRelocationsTable(void) const;
 
           //! Init the relocations table (DT_REL).
-          void initRelTable(void);
+          void initRelTable(void) const;
 
           //! Init the relocations table (DT_RELA).
-          void initRelaTable(void);
+          void initRelaTable(void) const;
 
           //! Init the relocations table (DT_JMPREL).
-          void initJmprelTable(void);
+          void initJmprelTable(void) const;
 
           //! Returns the offset in the file corresponding to the virtual address.
           triton::uint64 getOffsetFromAddress(triton::uint64 vaddr) const;
@@ -128,7 +152,16 @@ namespace triton {
 
         public:
           //! Constructor.
-          Elf(const std::string& path);
+          Elf(const std::string& path, triton::format::loader_e mode=triton::format::LOADER_MMAP);
+
+          //! Constructor. The Elf takes the ownership of the file.
+          Elf(triton::format::MappedFile* file);
+
+          //! An Elf cannot be copied.
+          Elf(const Elf& other) = delete;
+
+          //! An Elf cannot be copied.
+          Elf& operator=(const Elf& other) = delete;
 
           //! Destructor.
           virtual ~Elf();
@@ -142,6 +175,9 @@ namespace triton {
           //! Returns the path file of the binary.
           const std::string& getPath(void) const;
 
+          //! Returns true if the binary file is mapped (see triton::format::loader_e).
+          bool isMapped(void) const;
+
           //! Returns the ELF Header.
           const triton::format::elf::ElfHeader& getHeader(void) const;
 
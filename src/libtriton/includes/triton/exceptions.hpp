@@ -419,6 +419,18 @@ namespace triton {
     };
 
 
+    /*! \class Trace
+     *  \brief The exception class used by the binary trace format. */
+    class Trace : public triton::exceptions::Format {
+      public:
+        //! Constructor.
+        Trace(const char* message) : triton::exceptions::Format(message) {};
+
+        //! Constructor.
+        Trace(const std::string& message) : triton::exceptions::Format(message) {};
+    };
+
+
     /*! \class Callbacks
      *  \brief The exception class used by callbacks. */
     class Callbacks : public triton::exceptions::Exception {
@@ -92,9 +92,15 @@ namespace triton {
         //! True if this instruction is tainted. This field is set at the semantics level.
         bool tainted;
 
+        //! The AST nodes of the semantics on which the instruction holds a reference.
+        std::vector<triton::ast::AbstractNode*> heldAstNodes;
+
         //! Copies an Instruction
         void copy(const Instruction& other);
 
+        //! Drops the references held on the AST nodes of the semantics.
+        void releaseAstNodes(void);
+
       public:
         //! The memory access list
         std::list<triton::arch::MemoryAccess> memoryAccess;
@@ -156,6 +162,9 @@ namespace triton {
         //! Returns the list of all implicit and explicit load access
         std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& getLoadAccess(void);
 
+        //! Returns the list of all implicit and explicit load access
+        const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& getLoadAccess(void) const;
+
         //! Returns the list of all implicit and explicit store access
         std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& getStoreAccess(void);
 
@@ -278,6 +287,9 @@ namespace triton {
 
         //! Resets partially instruction information. All except memory and register states.
         void partialReset(void);
+
+        //! Takes a reference on the AST nodes of the semantics (loads, stores, registers, immediates and LEA), thus they survive the garbage collection of shared nodes.
+        void holdAstNodes(void);
     };
 
     //! Displays an Instruction.
@@ -42,28 +42,28 @@ namespace triton {
         //! AST garbage collector API
         triton::ast::AstGarbageCollector* astGarbageCollector;
 
-        //! Backup AST garbage collector
-        triton::ast::AstGarbageCollector* backupAstGarbageCollector;
-
         //! Modes API
         triton::modes::Modes* modes;
 
         //! Symbolic engine API
         triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
-        //! Backup symbolic engine
-        triton::engines::symbolic::SymbolicEngine* backupSymbolicEngine;
-
         //! Taint engine API
         triton::engines::taint::TaintEngine* taintEngine;
 
         //! Removes all symbolic expressions of an instruction.
         void removeSymbolicExpressions(triton::arch::Instruction& inst, std::set<triton::ast::AbstractNode*>& uniqueNodes);
 
+        //! Executes natively the instruction (triton::modes::CONCRETE_FAST_PATH). Returns false if the full semantics must be built.
+        bool buildConcreteSemantics(triton::arch::Instruction& inst);
+
       protected:
         //! x86 ISA builder.
         triton::arch::SemanticsInterface* x86Isa;
 
+        //! x86 native semantics used by the concrete fast path.
+        triton::arch::SemanticsInterface* x86ConcreteIsa;
+
       public:
         //! Constructor.
         IrBuilder(triton::arch::Architecture* architecture,
@@ -0,0 +1,101 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_MAPPEDFILE_H
+#define TRITON_MAPPEDFILE_H
+
+#include <string>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    /*! The different ways to load a binary file */
+    enum loader_e {
+      LOADER_MMAP = 0, /*!< the file is mapped read-only, its pages are loaded on demand. */
+      LOADER_READ,     /*!< the file is read into memory. */
+    };
+
+    /*! \class MappedFile
+     *  \brief The read-only content of a binary file.
+     *
+     * \description
+     * With `LOADER_MMAP`, the file is mapped and nothing is read until it is accessed, thus
+     * opening a large binary is immediate and its unused parts are never loaded. If the file
+     * cannot be mapped (or on systems without `mmap`), it is read into memory.
+     */
+    class MappedFile {
+      protected:
+        //! Path of the file.
+        std::string path;
+
+        //! The content of the file.
+        const triton::uint8* data;
+
+        //! The size of the file.
+        triton::usize size;
+
+        //! True if the content is mapped.
+        bool mapped;
+
+        //! The content of the file when it is read into memory.
+        std::vector<triton::uint8> raw;
+
+        //! Maps the file.
+        bool map(void);
+
+        //! Reads the file into memory.
+        void read(void);
+
+      public:
+        //! Constructor.
+        MappedFile(const std::string& path, triton::format::loader_e mode=triton::format::LOADER_MMAP);
+
+        //! A file cannot be copied.
+        MappedFile(const MappedFile& other) = delete;
+
+        //! A file cannot be copied.
+        MappedFile& operator=(const MappedFile& other) = delete;
+
+        //! Destructor. Unmaps the file.
+        ~MappedFile();
+
+        //! Returns the path of the file.
+        const std::string& getPath(void) const;
+
+        //! Returns the content of the file.
+        const triton::uint8* getData(void) const;
+
+        //! Returns the size of the file.
+        triton::usize getSize(void) const;
+
+        //! Returns true if the content is mapped.
+        bool isMapped(void) const;
+    };
+
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MAPPEDFILE_H */
@@ -43,6 +43,9 @@ namespace triton {
         //! The size of the area.
         triton::uint64 size;
 
+        //! The size of the area once mapped into the memory. The bytes past the size of the area are zero-filled.
+        triton::uint64 virtualSize;
+
       public:
         //! Constructor.
         MemoryMapping(const triton::uint8* binary);
@@ -71,6 +74,9 @@ namespace triton {
         //! Returns the size.
         triton::uint64 getSize(void) const;
 
+        //! Returns the size once mapped into the memory.
+        triton::uint64 getVirtualSize(void) const;
+
         //! Sets the offset.
         void setOffset(triton::uint64 offset);
 
@@ -79,6 +85,9 @@ namespace triton {
 
         //! Sets the size.
         void setSize(triton::uint64 size);
+
+        //! Sets the size once mapped into the memory.
+        void setVirtualSize(triton::uint64 virtualSize);
     };
 
   /*! @} End of format namespace */
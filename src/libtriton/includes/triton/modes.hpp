@@ -31,9 +31,13 @@ namespace triton {
     enum mode_e {
       /* AST */
       AST_DICTIONARIES,      //!< [ast mode] Abstract Syntax Tree dictionaries.
+      AST_SIMPLIFICATION,    //!< [ast mode] Simplify the ASTs of new symbolic expressions with the built-in rules.
+      LAZY_EVALUATION,       //!< [ast mode] Evaluate the ancestors of a modified node only when they are queried.
 
       /* Symbolic */
       ALIGNED_MEMORY,        //!< [symbolic mode] Keep a map of aligned memory.
+      CONCRETE_FAST_PATH,    //!< [symbolic mode] Execute natively instructions which have neither symbolized nor tainted inputs.
+      LAZY_FLAGS,            //!< [symbolic mode] Build the symbolic expressions of the arithmetic flags only when they are read.
       ONLY_ON_SYMBOLIZED,    //!< [symbolic mode] Perform symbolic execution only on symbolized expressions.
       ONLY_ON_TAINTED,       //!< [symbolic mode] Perform symbolic execution only on tainted instructions.
       PC_TRACKING_SYMBOLIC,  //!< [symbolic mode] Track path constraints only if they are symbolized.
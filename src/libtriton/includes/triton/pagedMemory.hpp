@@ -0,0 +1,196 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_PAGEDMEMORY_H
+#define TRITON_PAGEDMEMORY_H
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <triton/cpuSize.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class PagedMemory
+     *  \brief The concrete memory of a CPU.
+     *
+     * \description
+     * The memory is a sparse table of pages of `MEMORY_PAGE_SIZE` bytes. A page is mapped
+     * when one of its bytes is written and is unmapped as a whole. Unmapped bytes are read
+     * as zero.
+     *
+     * A page may also share a read-only area (e.g. a segment of a mapped binary file, or
+     * zeros). Its content is only copied on its first write.
+     *
+     * Once a snapshot is taken, the first write (or unmap) of a page saves its previous
+     * content in a journal. Thus, taking a snapshot is free and restoring it only costs
+     * the pages modified since.
+     */
+    class PagedMemory {
+      protected:
+        //! A page of the memory.
+        struct Page {
+          //! Concrete values of the page if they are not shared.
+          std::vector<triton::uint8> content;
+
+          //! Read-only concrete values shared by the page (nullptr if the page owns its content).
+          const triton::uint8* shared;
+
+          //! Keeps the shared area alive (null if the area is static).
+          std::shared_ptr<const void> owner;
+
+          //! Constructor. The page is not mapped.
+          Page() : shared(nullptr) {}
+
+          //! Returns the concrete values of the page.
+          const triton::uint8* data(void) const { return this->shared ? this->shared : this->content.data(); }
+
+          //! Returns true if the page is mapped.
+          bool isMapped(void) const { return this->shared || !this->content.empty(); }
+        };
+
+        /*! \brief map of page base address -> page
+         *
+         * \description
+         * **item1**: page base address (aligned on `MEMORY_PAGE_SIZE`)<br>
+         * **item2**: the page
+         */
+        std::map<triton::uint64, Page> pages;
+
+        //! Base address of the last page accessed.
+        mutable triton::uint64 lastPageBase;
+
+        //! Content of the last page accessed (nullptr if there is no such page).
+        mutable const triton::uint8* lastPage;
+
+        //! Base address of the last page written.
+        triton::uint64 lastWrittenPageBase;
+
+        //! Content of the last page written (nullptr if there is no such page). The page is already journaled.
+        triton::uint8* lastWrittenPage;
+
+        //! True if a snapshot is taken.
+        bool snapshotFlag;
+
+        /*! \brief map of page base address -> page when the snapshot has been taken
+         *
+         * \description
+         * **item1**: page base address (aligned on `MEMORY_PAGE_SIZE`)<br>
+         * **item2**: the page (not mapped if the page was not mapped)
+         */
+        std::map<triton::uint64, Page> journal;
+
+        //! Copies a PagedMemory.
+        void copy(const PagedMemory& other);
+
+        //! Returns the content of the page which contains the address or nullptr if the page is not mapped.
+        const triton::uint8* findPage(triton::uint64 addr) const;
+
+        //! Returns the content of the page which contains the address. The page is mapped (and journaled) and its shared content is copied if needed.
+        triton::uint8* mapPage(triton::uint64 addr);
+
+        //! Replaces the page at `base` by a page which shares `content`, kept alive by `owner`.
+        void sharePage(triton::uint64 base, const triton::uint8* content, const std::shared_ptr<const void>& owner);
+
+        //! Saves the page in the journal if it is not already saved. The page is moved if `release` is true.
+        void savePage(std::map<triton::uint64, Page>::iterator page, bool release);
+
+        //! Unmaps the pages whose base address is in [firstBase:lastBase].
+        void unmapPages(triton::uint64 firstBase, triton::uint64 lastBase);
+
+        //! Forgets the last pages accessed.
+        void resetLastPages(void);
+
+      public:
+        //! Constructor.
+        PagedMemory();
+
+        //! Constructor by copy.
+        PagedMemory(const PagedMemory& other);
+
+        //! Destructor.
+        virtual ~PagedMemory();
+
+        //! Copies a PagedMemory.
+        void operator=(const PagedMemory& other);
+
+        //! Returns the concrete value of a byte.
+        triton::uint8 read(triton::uint64 addr) const;
+
+        //! Reads `size` bytes from `addr` into `area`.
+        void read(triton::uint64 addr, triton::uint8* area, triton::usize size) const;
+
+        //! Sets the concrete value of a byte.
+        void write(triton::uint64 addr, triton::uint8 value);
+
+        //! Writes `size` bytes from `area` to `addr`.
+        void write(triton::uint64 addr, const triton::uint8* area, triton::usize size);
+
+        /*!
+         * \brief Maps `size` bytes of the read-only `area` at `baseAddr` without copying them.
+         *
+         * \description
+         * The pages fully covered by the area share it until their first write. `owner` keeps the area alive
+         * as long as a page (or a page saved by the snapshot) shares it. The bytes of the partially covered
+         * pages are written.
+         */
+        void mapShared(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner);
+
+        //! Maps zeros on the range [baseAddr:size]. The content of the pages fully covered is only allocated on their first write.
+        void mapZero(triton::uint64 baseAddr, triton::usize size);
+
+        //! Returns true if all pages covering the range [baseAddr:size] are mapped.
+        bool isMapped(triton::uint64 baseAddr, triton::usize size=1) const;
+
+        //! Unmaps all pages covering the range [baseAddr:size].
+        void unmap(triton::uint64 baseAddr, triton::usize size=1);
+
+        //! Unmaps all pages.
+        void clear(void);
+
+        //! Returns the number of mapped pages.
+        triton::usize getNumberOfPages(void) const;
+
+        //! Returns the number of mapped pages which still share a read-only area.
+        triton::usize getNumberOfSharedPages(void) const;
+
+        //! Takes a snapshot of the memory. A previous snapshot is discarded.
+        void takeSnapshot(void);
+
+        //! Restores the memory as it was when the snapshot has been taken. The snapshot is kept.
+        void restoreSnapshot(void);
+
+        //! Discards the snapshot.
+        void discardSnapshot(void);
+
+        //! Returns true if a snapshot is taken.
+        bool isSnapshotEnabled(void) const;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PAGEDMEMORY_H */
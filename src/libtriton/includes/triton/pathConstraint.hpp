@@ -63,6 +63,9 @@ namespace triton {
           //! Destructore.
           virtual ~PathConstraint();
 
+          //! Copies a PathConstraint.
+          void operator=(const PathConstraint &other);
+
           //! Adds a branch to the path constraint.
           void addBranchConstraint(bool taken, triton::uint64 srdAddr, triton::uint64 dstAddr, triton::ast::AbstractNode* pc);
 
@@ -48,6 +48,18 @@ namespace triton {
           //! Modes API.
           triton::modes::Modes* modes;
 
+          //! True if a snapshot is taken.
+          bool snapshotPathFlag;
+
+          //! The number of path constraints when the snapshot has been taken.
+          triton::usize snapshotPathSize;
+
+          //! The path constraints of the snapshot, only saved if they have been cleared since.
+          std::vector<triton::engines::symbolic::PathConstraint> snapshotPathConstraints;
+
+          //! True if the path constraints have been cleared since the snapshot.
+          bool snapshotPathCleared;
+
         protected:
           //! \brief The logical conjunction vector of path constraints.
           std::vector<triton::engines::symbolic::PathConstraint> pathConstraints;
@@ -80,6 +92,15 @@ namespace triton {
           //! Clears the logical conjunction vector of path constraints.
           void clearPathConstraints(void);
 
+          //! Takes a snapshot of the path constraints. A previous snapshot is discarded.
+          void takeSnapshot(void);
+
+          //! Restores the path constraints as they were when the snapshot has been taken. The snapshot is kept.
+          void restoreSnapshot(void);
+
+          //! Discards the snapshot.
+          void discardSnapshot(void);
+
           //! Copies a PathManager.
           void operator=(const PathManager& other);
       };
@@ -13,6 +13,7 @@
 #include <string>
 
 #include <triton/binaryInterface.hpp>
+#include <triton/mappedFile.hpp>
 #include <triton/memoryMapping.hpp>
 #include <triton/peExportDirectory.hpp>
 #include <triton/peHeader.hpp>
@@ -45,18 +46,20 @@ namespace triton {
      */
 
       /*! \class Pe
-       *  \brief The PE format class. */
+       *  \brief The PE format class.
+       *
+       * \description
+       * The PE Header is parsed when the binary is opened. The import and export tables are
+       * parsed from the file the first time they are requested.
+       */
       class Pe : public BinaryInterface {
         protected:
-          //! Path file of the binary.
-          std::string path;
+          //! The binary file.
+          triton::format::MappedFile* file;
 
           //! Total size of the binary file.
           triton::usize totalSize;
 
-          //! The raw binary.
-          std::vector<triton::uint8> raw;
-
           //! The PE Header.
           triton::format::pe::PeHeader header;
 
@@ -64,16 +67,22 @@ namespace triton {
           std::list<triton::format::MemoryMapping> memoryMapping;
 
           //! The import table.
-          std::vector<PeImportDirectory> importTable;
+          mutable std::vector<PeImportDirectory> importTable;
 
           //! DLL Dependencies.
-          std::vector<std::string> dlls;
+          mutable std::vector<std::string> dlls;
 
           //! Export table.
-          PeExportDirectory exportTable;
+          mutable PeExportDirectory exportTable;
+
+          //! True if the import table and the DLL dependencies are parsed.
+          mutable bool importTableParsed;
+
+          //! True if the export table is parsed.
+          mutable bool exportTableParsed;
 
-          //! Open the binary.
-          void open(void);
+          //! Init the members and parse the binary.
+          void init(void);
 
           //! Parse the binary.
           bool parse(void);
@@ -82,17 +91,26 @@ namespace triton {
           void initMemoryMapping(void);
 
           //! Init the export table.
-          void initExportTable(void);
+          void initExportTable(void) const;
 
           //! Init the import table.
-          void initImportTable(void);
+          void initImportTable(void) const;
 
           //! Returns the offset in the file corresponding to the virtual address.
           triton::uint64 getOffsetFromAddress(triton::uint64 vaddr) const;
 
         public:
           //! Constructor.
-          Pe(const std::string& path);
+          Pe(const std::string& path, triton::format::loader_e mode=triton::format::LOADER_MMAP);
+
+          //! Constructor. The Pe takes the ownership of the file.
+          Pe(triton::format::MappedFile* file);
+
+          //! A Pe cannot be copied.
+          Pe(const Pe& other) = delete;
+
+          //! A Pe cannot be copied.
+          Pe& operator=(const Pe& other) = delete;
 
           //! Destructor.
           virtual ~Pe();
@@ -93,6 +93,12 @@ namespace triton {
       //! Initializes the ELF python namespace.
       void initElfNamespace(PyObject* elfDict);
 
+      //! Initializes the EMULATION python namespace.
+      void initEmulationNamespace(PyObject* emulationDict);
+
+      //! Initializes the LOADER python namespace.
+      void initLoaderNamespace(PyObject* loaderDict);
+
       //! Initializes the PE python namespace.
       void initPENamespace(PyObject* peDict);
 
@@ -71,7 +71,7 @@ namespace triton {
       PyObject* PyBitvector(triton::uint32 high, triton::uint32 low);
 
       //! Creates the Elf python class.
-      PyObject* PyElf(const std::string& elf);
+      PyObject* PyElf(const std::string& elf, triton::format::loader_e mode=triton::format::LOADER_MMAP);
 
       //! Creates the ElfDynamicTable python class.
       PyObject* PyElfDynamicTable(const triton::format::elf::ElfDynamicTable& dyn);
@@ -0,0 +1,146 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERCACHE_H
+#define TRITON_SOLVERCACHE_H
+
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include <triton/ast.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SolverCache
+       *  \brief The cache of solver queries.
+       *
+       * \description
+       * Queries are keyed by a structural hash of their DAG (references are followed and the operands of
+       * commutative operators are not ordered), thus the same formula built twice is only solved once. Before
+       * calling the solver, the cache also evaluates the query under the last models found (counterexamples):
+       * if one of them satisfies the query, it is returned without calling the solver. As hashes may collide, a cached
+       * model is only returned if it satisfies the query and a result without model only if the query has the same structure.
+       */
+      class SolverCache {
+        private:
+          //! A cached result.
+          struct Entry {
+            //! True if the query is satisfiable.
+            bool sat;
+
+            //! True if the model is known (a query may be checked without asking a model).
+            bool hasModel;
+
+            //! The model if the query is satisfiable.
+            std::map<triton::uint32, SolverModel> model;
+
+            //! The query, referenced by the cache. A result without model is only returned for the same query.
+            triton::ast::AbstractNode* query;
+          };
+
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! The structural hash per node. Each node is referenced by the cache.
+          std::unordered_map<triton::ast::AbstractNode*, triton::uint64> hashes;
+
+          //! The results per query hash.
+          std::unordered_map<triton::uint64, Entry> queries;
+
+          //! The last models found, the most recent first.
+          std::list<std::map<triton::uint32, SolverModel>> counterexamples;
+
+          //! The revision of symbolic expressions when the caches have been built.
+          triton::usize astRevision;
+
+          //! Number of queries answered by their hash.
+          triton::usize hits;
+
+          //! Number of queries answered by a counterexample.
+          triton::usize counterexampleHits;
+
+          //! Number of queries sent to the solver.
+          triton::usize misses;
+
+          //! Removes all cached queries and hashes.
+          void flush(void);
+
+          //! Flushes the caches if a symbolic expression has a new AST or if the caches are too big.
+          void checkRevision(void);
+
+          //! Returns the structural hash of a node. The hash is kept for the next queries.
+          triton::uint64 getHash(triton::ast::AbstractNode* node);
+
+          //! Computes the structural hash of a node. The hashes of the nodes which are not kept by the cache are added to `local`.
+          triton::uint64 computeHash(triton::ast::AbstractNode* node, std::unordered_map<triton::ast::AbstractNode*, triton::uint64>& local);
+
+          //! Returns true if two queries have the same structure. As for the hash, references are followed and the operands of commutative operators are not ordered.
+          bool isSameQuery(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2);
+
+          /*!
+           * \brief Evaluates a constraint under a model. The variables which are not in the model take their concrete value.
+           *
+           * \description
+           * Returns false if the constraint cannot be evaluated (unsupported node), otherwise `value` is set and
+           * `used` contains the value of each variable of the constraint.
+           */
+          bool evaluate(triton::ast::AbstractNode* node, const std::map<triton::uint32, SolverModel>& model, bool& value, std::map<triton::uint32, SolverModel>& used) const;
+
+        public:
+          //! Constructor.
+          SolverCache(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
+
+          //! Destructor.
+          virtual ~SolverCache();
+
+          //! Looks for the result of a query. Returns true if the query is answered, `sat` and `model` (if `needModel`) are then set.
+          bool find(triton::ast::AbstractNode* node, bool needModel, bool& sat, std::map<triton::uint32, SolverModel>& model);
+
+          //! Records the result of a query. The model is only meaningful if `hasModel` is true.
+          void record(triton::ast::AbstractNode* node, bool sat, bool hasModel, const std::map<triton::uint32, SolverModel>& model);
+
+          //! Returns the statistics of the cache (`entries`, `hits`, `counterexampleHits`, `misses` and `hitRate` as percentage).
+          std::map<std::string, triton::usize> getStats(void) const;
+
+          //! Removes all cached queries and resets the statistics.
+          void clear(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERCACHE_H */
@@ -12,11 +12,15 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include <z3++.h>
 
 #include <triton/ast.hpp>
+#include <triton/solverCache.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/solverPartition.hpp>
+#include <triton/solverSession.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -50,6 +54,30 @@ namespace triton {
           //! Symbolic Engine API
           triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
+          //! The solver session. It is created with the first query.
+          mutable SolverSession* session;
+
+          //! Returns the solver session.
+          SolverSession* getSession(void) const;
+
+          //! The partition of queries into independent clusters. It is created with the first query.
+          mutable SolverPartition* partition;
+
+          //! Returns the partition of queries.
+          SolverPartition* getPartition(void) const;
+
+          //! Solves a cluster or reuses its previous result. Unknown results are not recorded.
+          triton::engines::solver::status_e solveCluster(const SolverPartition::Cluster& cluster, std::map<triton::uint32, SolverModel>& model) const;
+
+          //! Solves a query on its own, cluster by cluster. Returns a model if the query is satisfiable, `status` is set to the result.
+          std::list<std::map<triton::uint32, SolverModel>> solve(triton::ast::AbstractNode* node, triton::engines::solver::status_e& status) const;
+
+          //! The cache of queries. It is created with the first query.
+          mutable SolverCache* cache;
+
+          //! Returns the cache of queries.
+          SolverCache* getCache(void) const;
+
         public:
           //! Constructor.
           SolverEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
@@ -74,6 +102,49 @@ namespace triton {
            * **item2**: model
            */
           std::list<std::map<triton::uint32, SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const;
+
+          /*!
+           * \brief Computes a model per query, in the order of the queries. The queries are solved on their own by a pool of threads.
+           *
+           * \description
+           * `threads` is the number of workers (0 for one per core) and `timeout` is the time limit of each query in
+           * milliseconds (0 for none). An unsat query (or a query out of time) has an empty model.
+           */
+          std::vector<std::map<triton::uint32, SolverModel>> getModels(const std::vector<triton::ast::AbstractNode*>& nodes, triton::uint32 threads, triton::uint32 timeout) const;
+
+          /*!
+           * \brief Computes a model per negated branch of the path constraints, in the order of `indexes`.
+           *
+           * \description
+           * `indexes` are the indexes of multiple branches path constraints (all of them which have a branch not taken if
+           * empty). The query of a branch is the conjunction of the previous path constraints and of the branch which has
+           * not been taken.
+           */
+          std::vector<std::map<triton::uint32, SolverModel>> getNegatedBranchModels(const std::vector<triton::usize>& indexes, triton::uint32 threads, triton::uint32 timeout) const;
+
+          //! Returns true if the constraints of the session and the `node` (if not null) are satisfiable.
+          bool isSat(triton::ast::AbstractNode* node) const;
+
+          //! Creates a new scope of constraints in the solver session.
+          void push(void);
+
+          //! Removes the constraints added to the solver session since the last push.
+          void pop(void);
+
+          //! Returns the number of scopes pushed in the solver session.
+          triton::usize getNumberOfScopes(void) const;
+
+          //! Adds a constraint to the current scope of the solver session. The constraint holds for all next queries until its scope is popped.
+          void addConstraint(triton::ast::AbstractNode* node);
+
+          //! Removes all scopes and constraints of the solver session.
+          void resetSession(void);
+
+          //! Returns the statistics of the cache of queries (`entries`, `hits`, `counterexampleHits`, `misses` and `hitRate` as percentage).
+          std::map<std::string, triton::usize> getCacheStats(void) const;
+
+          //! Removes all cached queries and models, and resets the statistics.
+          void flushCache(void);
       };
 
     /*! @} End of solver namespace */
@@ -0,0 +1,107 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERPARTITION_H
+#define TRITON_SOLVERPARTITION_H
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SolverPartition
+       *  \brief Splits a query into independent clusters of constraints.
+       *
+       * \description
+       * A query is a conjunction of constraints (e.g. the path predicate and a negated branch). Two constraints
+       * are dependent if they share a symbolic variable. The partition groups the constraints in clusters which
+       * do not share any variable, thus each cluster may be solved on its own and the model of a cluster which
+       * did not change since the last query is reused. The symbolic variables of a constraint (references
+       * included) are cached per node, thus splitting a long path predicate only walks the new constraints.
+       */
+      class SolverPartition {
+        public:
+          //! A cluster of constraints, sorted by address.
+          typedef std::vector<triton::ast::AbstractNode*> Cluster;
+
+        private:
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! The sorted ids of symbolic variables per node. Each node is referenced by the cache.
+          std::unordered_map<triton::ast::AbstractNode*, std::vector<triton::uint32>> variables;
+
+          //! The models already computed per cluster. An unsat cluster has no model.
+          std::map<Cluster, std::pair<bool, std::map<triton::uint32, SolverModel>>> models;
+
+          //! The revision of symbolic expressions when the caches have been built.
+          triton::usize astRevision;
+
+          //! Clears the caches if a symbolic expression has a new AST or if the caches are too big.
+          void checkRevision(void);
+
+          //! Collects the variables of a node without following its references. Returns the ASTs of the referenced expressions.
+          std::vector<triton::ast::AbstractNode*> collect(triton::ast::AbstractNode* node, std::vector<triton::uint32>& vars) const;
+
+        public:
+          //! Constructor.
+          SolverPartition(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
+
+          //! Destructor.
+          virtual ~SolverPartition();
+
+          //! Returns the sorted ids of the symbolic variables of a node, references included.
+          const std::vector<triton::uint32>& getVariables(triton::ast::AbstractNode* node);
+
+          //! Splits a constraint (assert node or conjunction) into independent clusters.
+          std::vector<Cluster> split(triton::ast::AbstractNode* node);
+
+          //! Returns true if the cluster has already been solved, `sat` and `model` are then set.
+          bool findModel(const Cluster& cluster, bool& sat, std::map<triton::uint32, SolverModel>& model) const;
+
+          //! Records the result of a cluster.
+          void recordModel(const Cluster& cluster, bool sat, const std::map<triton::uint32, SolverModel>& model);
+
+          //! Clears the caches.
+          void clear(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERPARTITION_H */
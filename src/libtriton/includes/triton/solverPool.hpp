@@ -0,0 +1,79 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERPOOL_H
+#define TRITON_SOLVERPOOL_H
+
+#include <map>
+#include <vector>
+
+#include <triton/ast.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SolverPool
+       *  \brief A pool of threads solving independent queries.
+       *
+       * \description
+       * Each worker has its own Z3 context and takes the next query as soon as it is done with the previous one. Triton's
+       * ASTs are not thread-safe, thus their translation to Z3 is serialized while the solving runs in parallel. Each worker
+       * memoizes its translations, the path predicate shared by the queries is translated once per worker.
+       */
+      class SolverPool {
+        private:
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+        public:
+          //! Constructor.
+          SolverPool(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
+
+          //! Destructor.
+          virtual ~SolverPool();
+
+          /*!
+           * \brief Computes a model per query, in the order of the queries.
+           *
+           * \description
+           * `threads` is the number of workers (0 for one per core) and `timeout` is the time limit of each query
+           * in milliseconds (0 for none). An unsat query (or a query out of time) has an empty model.
+           */
+          std::vector<std::map<triton::uint32, SolverModel>> getModels(const std::vector<triton::ast::AbstractNode*>& nodes, triton::uint32 threads, triton::uint32 timeout) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERPOOL_H */
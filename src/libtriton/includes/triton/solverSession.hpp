@@ -0,0 +1,150 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERSESSION_H
+#define TRITON_SOLVERSESSION_H
+
+#include <list>
+#include <map>
+#include <vector>
+
+#include <z3++.h>
+
+#include <triton/ast.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/tritonToZ3Ast.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! The result of a check */
+      enum status_e {
+        STATUS_UNSAT = 0, /*!< the constraints are not satisfiable. */
+        STATUS_SAT,       /*!< the constraints are satisfiable. */
+        STATUS_UNKNOWN,   /*!< the solver gave up (e.g. timeout or resource limit), the result must not be cached. */
+      };
+
+      /*!
+       * \brief Converts a Z3 model into Triton's models.
+       *
+       * \description
+       * The clauses which exclude this model are added to `blocking` if it is not null.
+       */
+      std::map<triton::uint32, SolverModel> convertModel(z3::context& ctx, z3::model& m, z3::expr_vector* blocking=nullptr);
+
+      /*! \class SolverSession
+       *  \brief A long-lived and incremental Z3 solver.
+       *
+       * \description
+       * The session keeps one Z3 context for its whole life. Triton's ASTs are translated
+       * directly to Z3 (no SMT2 script) and each translated node is memoized, thus nodes shared
+       * between several queries (e.g. the path predicate) are translated only once. Constraints
+       * are added in scopes (push/pop), so checking the branches along a path only sends the new
+       * constraints to the solver.
+       *
+       * The memo keeps its nodes alive. It is cleared when a symbolic expression gets a new AST,
+       * and when it holds more than 65536 nodes while no scope is pushed. Thus a session used
+       * during a whole trace does not keep all the ASTs it has seen.
+       */
+      class SolverSession {
+        private:
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! The translator of ASTs. It holds the Z3 context of the session.
+          triton::ast::TritonToZ3Ast translator;
+
+          //! The incremental solver.
+          z3::solver solver;
+
+          //! The revision of symbolic expressions when the memo of translations has been built.
+          triton::usize astRevision;
+
+          //! The number of constraints added per scope. The first item is the base level, thus there are `size() - 1` scopes pushed.
+          std::vector<triton::usize> constraints;
+
+          //! Translates a constraint (assert node or boolean node) to Z3.
+          z3::expr translate(triton::ast::AbstractNode* node);
+
+        public:
+          //! Constructor.
+          SolverSession(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
+
+          //! Destructor.
+          virtual ~SolverSession();
+
+          //! Creates a new scope of constraints.
+          void push(void);
+
+          //! Removes the constraints added since the last push.
+          void pop(void);
+
+          //! Returns the number of scopes pushed.
+          triton::usize getNumberOfScopes(void) const;
+
+          //! Returns the number of constraints added in all scopes.
+          triton::usize getNumberOfConstraints(void) const;
+
+          //! Adds a constraint to the current scope.
+          void addConstraint(triton::ast::AbstractNode* node);
+
+          //! Checks the constraints of the session and the `node` (if not null).
+          triton::engines::solver::status_e check(triton::ast::AbstractNode* node=nullptr);
+
+          //! Returns true if the constraints of the session and the `node` (if not null) are satisfiable.
+          bool isSat(triton::ast::AbstractNode* node=nullptr);
+
+          /*! \brief Computes and returns several models of the constraints of the session and the `node` (if not null). The `limit` is the number of models returned.
+           *
+           * \description
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           *
+           * If `status` is not null, it is set to the result of the first check.
+           */
+          std::list<std::map<triton::uint32, SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit, triton::engines::solver::status_e* status=nullptr);
+
+          //! Computes and returns several models of the constraints of the session and the conjunction of `nodes`. If `status` is not null, it is set to the result of the first check.
+          std::list<std::map<triton::uint32, SolverModel>> getModels(const std::vector<triton::ast::AbstractNode*>& nodes, triton::uint32 limit, triton::engines::solver::status_e* status=nullptr);
+
+          //! Returns the number of nodes in the memo of translations.
+          triton::usize getNumberOfTranslations(void) const;
+
+          //! Removes all scopes and constraints, and clears the memo of translations.
+          void reset(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERSESSION_H */
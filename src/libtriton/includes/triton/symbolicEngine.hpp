@@ -10,11 +10,15 @@
 
 #include <list>
 #include <map>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <triton/architecture.hpp>
 #include <triton/ast.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/deferredExpression.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/modes.hpp>
 #include <triton/pathManager.hpp>
@@ -93,6 +97,15 @@ namespace triton {
            */
           std::map<triton::uint64, triton::usize> memoryReference;
 
+          /*! \brief map of register -> deferred definition (triton::modes::LAZY_FLAGS).
+           *
+           * \description
+           * The symbolic expression of these registers is built when they are read.<br>
+           * **item1**: parent register id<br>
+           * **item2**: deferred definition
+           */
+          std::map<triton::uint32, DeferredExpression*> deferredRegisters;
+
           /*! \brief map of <address:size> -> symbolic expression.
            *
            * \description
@@ -114,9 +127,83 @@ namespace triton {
           //! Defines if this instance is used as a backup.
           bool backupFlag;
 
+          /*! \brief The memo of full ASTs. Each full AST is referenced by the memo.
+           *
+           * \description
+           * **item1**: symbolic expression id<br>
+           * **item2**: full AST of the expression
+           */
+          std::unordered_map<triton::usize, triton::ast::AbstractNode*> fullAsts;
+
+          //! The revision of symbolic expressions, see getAstRevision().
+          triton::usize astRevision;
+
+          //! The revision of symbolic expressions when the memo of full ASTs has been built.
+          triton::usize fullAstsRevision;
+
+          //! Drops the memo of full ASTs.
+          void clearFullAsts(void);
+
           //! Slices all expressions from a given node.
           void sliceExpressions(triton::ast::AbstractNode* node, std::map<triton::usize, SymbolicExpression*>& exprs);
 
+          //! Builds the symbolic expression of a deferred register.
+          void materializeRegister(triton::uint32 parentId);
+
+          //! Builds the symbolic expressions of all deferred registers.
+          void materializeAllRegisters(void);
+
+          //! Drops the deferred definition of a register.
+          void dropDeferredRegister(triton::uint32 parentId);
+
+          //! Drops all deferred definitions of a map.
+          void clearDeferredRegisters(std::map<triton::uint32, DeferredExpression*>& registers);
+
+          //! Copies the deferred definitions of a map.
+          void copyDeferredRegisters(std::map<triton::uint32, DeferredExpression*>& dst, const std::map<triton::uint32, DeferredExpression*>& src);
+
+          //! Removes one entry of the aligned memory and drops its reference on the node.
+          void removeAlignedMemoryEntry(triton::uint64 address, triton::uint32 size);
+
+          //! True if a snapshot is taken.
+          bool snapshotFlag;
+
+          //! The symbolic register state when the snapshot has been taken.
+          std::vector<triton::usize> snapshotReg;
+
+          //! The deferred registers when the snapshot has been taken.
+          std::map<triton::uint32, DeferredExpression*> snapshotDeferredRegisters;
+
+          //! The first symbolic expression id allocated after the snapshot.
+          triton::usize snapshotSymExprId;
+
+          /*! \brief map of address -> symbolic expression id when the snapshot has been taken
+           *
+           * \description
+           * Only the addresses modified since the snapshot are saved.<br>
+           * **item1**: memory address<br>
+           * **item2**: symbolic reference id (UNSET if the address had no reference)
+           */
+          std::map<triton::uint64, triton::usize> snapshotMemoryReference;
+
+          /*! \brief map of <address:size> -> aligned node when the snapshot has been taken
+           *
+           * \description
+           * Only the entries modified since the snapshot are saved. Each node is referenced by the snapshot.<br>
+           * **item1**: <addr:size><br>
+           * **item2**: aligned node (nullptr if there was no entry)
+           */
+          std::map<std::pair<triton::uint64, triton::uint32>, triton::ast::AbstractNode*> snapshotAlignedMemory;
+
+          //! The symbolic expressions of the snapshot which have been removed since. They are deleted once the snapshot is discarded.
+          std::map<triton::usize, SymbolicExpression*> snapshotRemovedExpressions;
+
+          //! Saves the memory reference of an address if it is not already saved.
+          void saveMemoryReference(triton::uint64 addr);
+
+          //! Saves an entry of the aligned memory if it is not already saved.
+          void saveAlignedMemory(triton::uint64 address, triton::uint32 size);
+
         public:
           //! Constructor. If you use this class as backup or copy you should define the `isBackup` flag as true.
           SymbolicEngine(triton::arch::Architecture* architecture,
@@ -145,6 +232,9 @@ namespace triton {
           //! Removes the symbolic expression corresponding to the id.
           void removeSymbolicExpression(triton::usize symExprId);
 
+          //! Removes the symbolic expressions which are not reachable from the registers, the memory and the path constraints. The ASTs of removed expressions are added to `nodes`.
+          void removeUnreachableExpressions(std::set<triton::ast::AbstractNode*>& nodes);
+
           //! Adds an aligned entry.
           void addAlignedMemory(triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node);
 
@@ -250,18 +340,38 @@ namespace triton {
           //! Assigns a symbolic expression to a register.
           void assignSymbolicExpressionToRegister(SymbolicExpression *se, const triton::arch::Register& reg);
 
+          /*! \brief Defers the symbolic expression of a register until it is read (triton::modes::LAZY_FLAGS).
+           *
+           * \description
+           * The concrete value of `reg` is synchronized at once. The engine takes the ownership of `deferred`.
+           * In the taint-only mode, only the concrete state is synchronized.
+           */
+          void deferSymbolicRegisterExpression(const triton::arch::Register& reg, DeferredExpression* deferred);
+
+          //! Returns true if the symbolic expressions of the flags are built only when they are read (triton::modes::LAZY_FLAGS).
+          bool isLazyFlags(void) const;
+
           //! Assigns a symbolic expression to a memory.
           void assignSymbolicExpressionToMemory(SymbolicExpression *se, const triton::arch::MemoryAccess& mem);
 
-          //! Returns the full AST of a root node.
-          triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node, std::set<triton::usize>& processed);
-
-          //! Returns the full AST of a root node.
+          /*! \brief Returns the full AST of a root node.
+           *
+           * \description
+           * References are replaced by the ASTs of their expressions. The given tree is not modified:
+           * the nodes which contain a reference are rebuilt, the others are shared with the original tree.
+           * The full AST of each referenced expression is memoized, thus next calls only rebuild what is new.
+           */
           triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node);
 
           //! Slices all expressions from a given one.
           std::map<triton::usize, SymbolicExpression*> sliceExpressions(SymbolicExpression* expr);
 
+          //! Returns a counter increased each time the root node of an expression of this engine is replaced. Translations of ASTs which contain references are outdated when it changes.
+          triton::usize getAstRevision(void) const;
+
+          //! Increases the revision of symbolic expressions.
+          void incAstRevision(void);
+
           //! Returns the list of the tainted symbolic expressions.
           std::list<SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
 
@@ -277,6 +387,9 @@ namespace triton {
           //! Adds a symbolic memory reference.
           void addMemoryReference(triton::uint64 mem, triton::usize id);
 
+          //! Adds a path constraint. Does nothing if the symbolic engine is disabled.
+          void addPathConstraint(const triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* expr);
+
           //! Concretizes all symbolic memory references.
           void concretizeAllMemory(void);
 
@@ -298,6 +411,29 @@ namespace triton {
           //! Returns true if the symbolic execution engine is enabled.
           bool isEnabled(void) const;
 
+          /*!
+           * \brief Takes a snapshot of the symbolic state. A previous snapshot is discarded.
+           *
+           * \description
+           * The symbolic registers and the path constraints are saved, the memory references are saved on their
+           * first modification. Thus, the cost of a snapshot only depends on what is modified since.
+           */
+          void takeSnapshot(void);
+
+          /*!
+           * \brief Restores the symbolic state as it was when the snapshot has been taken. The snapshot is kept.
+           *
+           * \description
+           * The symbolic expressions created since the snapshot are deleted. The symbolic variables are kept.
+           */
+          void restoreSnapshot(void);
+
+          //! Discards the snapshot.
+          void discardSnapshot(void);
+
+          //! Returns true if a snapshot is taken.
+          bool isSnapshotEnabled(void) const;
+
           //! Returns true if the symbolic expression ID exists.
           bool isSymbolicExpressionIdExists(triton::usize symExprId) const;
 
@@ -10,6 +10,7 @@
 
 #include <triton/ast.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/modes.hpp>
 
 
 
@@ -43,9 +44,15 @@ namespace triton {
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
+          //! Modes API
+          triton::modes::Modes* modes;
+
+          //! Applies the built-in rules on the root of a tree. Its childs are already simplified.
+          triton::ast::AbstractNode* applyRules(triton::ast::AbstractNode* node) const;
+
         public:
           //! Constructor.
-          SymbolicSimplification(triton::callbacks::Callbacks* callbacks=nullptr);
+          SymbolicSimplification(triton::callbacks::Callbacks* callbacks=nullptr, triton::modes::Modes* modes=nullptr);
 
           //! Constructor.
           SymbolicSimplification(const SymbolicSimplification& copy);
@@ -59,6 +66,15 @@ namespace triton {
           //! Processes all recorded simplifications. Returns the simplified node.
           triton::ast::AbstractNode* processSimplification(triton::ast::AbstractNode* node) const;
 
+          /*! \brief Simplifies a tree with the built-in rules. Returns the simplified node.
+           *
+           * \description
+           * The tree is rewritten from its leaves. Constant subtrees are folded, algebraic identities
+           * are applied and the constant operand of a commutative node is moved on the right.
+           * The given tree is not modified.
+           */
+          triton::ast::AbstractNode* simplify(triton::ast::AbstractNode* node) const;
+
           //! Copies a SymbolicSimplification.
           void operator=(const SymbolicSimplification& other);
       };
@@ -0,0 +1,129 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TAINTBITMAP_H
+#define TRITON_TAINTBITMAP_H
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include <triton/cpuSize.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      /*! \class TaintBitmap
+          \brief The taint state of the memory.
+
+          \description
+          The memory is split into pages of `MEMORY_PAGE_SIZE` bytes. Each page holds one bit per
+          byte and only pages with at least one tainted byte are allocated. Thus, checking or
+          tainting a range of bytes only costs a few word operations per page.
+
+          Once a snapshot is taken, the first modification of a page saves its previous bits in a
+          journal, thus restoring a snapshot only costs the pages modified since.
+       */
+      class TaintBitmap {
+        protected:
+          /*! \brief map of page base address -> taint bits
+           *
+           * \description
+           * **item1**: page base address (aligned on `MEMORY_PAGE_SIZE`)<br>
+           * **item2**: one bit per byte of the page
+           */
+          std::map<triton::uint64, std::vector<triton::uint64>> pages;
+
+          //! True if a snapshot is taken.
+          bool snapshotFlag;
+
+          /*! \brief map of page base address -> taint bits when the snapshot has been taken
+           *
+           * \description
+           * **item1**: page base address (aligned on `MEMORY_PAGE_SIZE`)<br>
+           * **item2**: one bit per byte of the page (empty if the page was not allocated)
+           */
+          std::map<triton::uint64, std::vector<triton::uint64>> journal;
+
+          //! Copies a TaintBitmap.
+          void copy(const TaintBitmap& other);
+
+          //! Saves the page in the journal if a snapshot is taken and if the page is not already saved.
+          void savePage(triton::uint64 base);
+
+        public:
+          //! Constructor.
+          TaintBitmap();
+
+          //! Constructor by copy.
+          TaintBitmap(const TaintBitmap& other);
+
+          //! Destructor.
+          virtual ~TaintBitmap();
+
+          //! Copies a TaintBitmap.
+          void operator=(const TaintBitmap& other);
+
+          //! Returns true if at least one byte of the range [baseAddr:size] is tainted.
+          bool isTainted(triton::uint64 baseAddr, triton::usize size=1) const;
+
+          //! Sets the flag (taint or untaint) to all bytes of the range [baseAddr:size].
+          void setTaint(triton::uint64 baseAddr, triton::usize size, bool flag);
+
+          //! Untaints all bytes.
+          void clear(void);
+
+          //! Returns all tainted addresses.
+          std::set<triton::uint64> getTaintedAddresses(void) const;
+
+          //! Returns the tainted spans (start address -> size) which intersect the range [baseAddr:size], clipped to this range.
+          std::map<triton::uint64, triton::usize> getTaintedRanges(triton::uint64 baseAddr, triton::usize size) const;
+
+          //! Returns all tainted spans (start address -> size).
+          std::map<triton::uint64, triton::usize> getTaintedRanges(void) const;
+
+          //! Takes a snapshot of the taint state. A previous snapshot is discarded.
+          void takeSnapshot(void);
+
+          //! Restores the taint state as it was when the snapshot has been taken. The snapshot is kept.
+          void restoreSnapshot(void);
+
+          //! Discards the snapshot.
+          void discardSnapshot(void);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTBITMAP_H */
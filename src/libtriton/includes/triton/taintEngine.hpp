@@ -8,11 +8,13 @@
 #ifndef TRITON_TAINTENGINE_H
 #define TRITON_TAINTENGINE_H
 
+#include <map>
 #include <set>
 
 #include <triton/memoryAccess.hpp>
 #include <triton/register.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/taintBitmap.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -57,12 +59,18 @@ namespace triton {
           //! Defines if the taint engine is enabled or disabled.
           bool enableFlag;
 
-          //! The set of tainted addresses.
-          std::set<triton::uint64> taintedMemory;
+          //! The taint state of the memory.
+          triton::engines::taint::TaintBitmap taintedMemory;
 
           //! The set of tainted registers. Currently it is an over approximation of the taint.
           std::set<triton::arch::Register> taintedRegisters;
 
+          //! True if a snapshot is taken.
+          bool snapshotFlag;
+
+          //! The set of tainted registers when the snapshot has been taken.
+          std::set<triton::arch::Register> snapshotRegisters;
+
           //! Copies a TaintEngine.
           void copy(const TaintEngine& other);
 
@@ -83,7 +91,13 @@ namespace triton {
           void enable(bool flag);
 
           //! Returns the tainted addresses.
-          const std::set<triton::uint64>& getTaintedMemory(void) const;
+          std::set<triton::uint64> getTaintedMemory(void) const;
+
+          //! Returns the tainted spans (start address -> size) which intersect the range [baseAddr:size].
+          std::map<triton::uint64, triton::usize> getTaintedMemoryRanges(triton::uint64 baseAddr, triton::usize size) const;
+
+          //! Returns all tainted spans (start address -> size).
+          std::map<triton::uint64, triton::usize> getTaintedMemoryRanges(void) const;
 
           //! Returns the tainted registers.
           const std::set<triton::arch::Register>& getTaintedRegisters(void) const;
@@ -92,7 +106,7 @@ namespace triton {
           bool isEnabled(void) const;
 
           //! Returns true if the addr is tainted.
-          bool isMemoryTainted(triton::uint64 addr, triton::uint32 size=1) const;
+          bool isMemoryTainted(triton::uint64 addr, triton::usize size=1) const;
 
           //! Returns true if the memory is tainted.
           bool isMemoryTainted(const triton::arch::MemoryAccess& mem) const;
@@ -118,6 +132,9 @@ namespace triton {
           //! Taints a memory. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
           bool taintMemory(const triton::arch::MemoryAccess& mem);
 
+          //! Taints the range [baseAddr:size]. Returns TAINTED if the range has been tainted correctly. Otherwise it returns the last defined state.
+          bool taintMemoryArea(triton::uint64 baseAddr, triton::usize size);
+
           //! Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
           bool taintRegister(const triton::arch::Register& reg);
 
@@ -127,9 +144,21 @@ namespace triton {
           //! Untaints a memory. Returns !TAINTED if the memory has been untainted correctly. Otherwise it returns the last defined state.
           bool untaintMemory(const triton::arch::MemoryAccess& mem);
 
+          //! Untaints the range [baseAddr:size]. Returns !TAINTED if the range has been untainted correctly. Otherwise it returns the last defined state.
+          bool untaintMemoryArea(triton::uint64 baseAddr, triton::usize size);
+
           //! Untaints a register. Returns !TAINTED if the register has been untainted correctly. Otherwise it returns the last defined state.
           bool untaintRegister(const triton::arch::Register& reg);
 
+          //! Takes a snapshot of the taint state. A previous snapshot is discarded.
+          void takeSnapshot(void);
+
+          //! Restores the taint state as it was when the snapshot has been taken. The snapshot is kept.
+          void restoreSnapshot(void);
+
+          //! Discards the snapshot.
+          void discardSnapshot(void);
+
           //! Abstract union tainting.
           bool taintUnion(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2);
 
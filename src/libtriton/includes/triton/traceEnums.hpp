@@ -0,0 +1,70 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TRACEENUMS_H
+#define TRITON_TRACEENUMS_H
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    //! The binary trace format namespace
+    namespace trace {
+    /*!
+     *  \ingroup format
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*!
+       *  \brief The binary trace format enums.
+       *
+       *  \description
+       *  All fields are little-endian and packed. A trace starts by a header followed by one record per executed instruction.
+       *
+       *  <pre>
+       *  header  : uint32 magic, uint16 version, uint16 architecture
+       *  record  : uint64 address, uint32 tid, uint8 opcodeSize, uint8 numberOfRegisters, uint16 numberOfMemoryAccesses
+       *            uint8 opcodes[opcodeSize]
+       *            numberOfRegisters      x { uint16 regId, uint8 size, uint8 value[size] }
+       *            numberOfMemoryAccesses x { uint64 address, uint16 size, uint8 value[size] }
+       *  </pre>
+       *
+       *  Registers and memory values are the concrete values before the execution of the instruction. Registers are
+       *  only recorded when their value differs from the previous recorded value (deltas).
+       */
+      enum trace_e {
+        TRACE_MAGIC             = 0x52545254, //!< The magic number ("TRTR").
+        TRACE_VERSION           = 1,          //!< The version of the format.
+        TRACE_HEADER_SIZE       = 8,          //!< Size of the header.
+        TRACE_RECORD_SIZE       = 16,         //!< Size of the fixed part of a record.
+        TRACE_REGISTER_SIZE     = 3,          //!< Size of the fixed part of a register entry.
+        TRACE_MEMORY_SIZE       = 10,         //!< Size of the fixed part of a memory access entry.
+        TRACE_MAX_VALUE_SIZE    = 64,         //!< Maximum size of a register or memory value.
+      };
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEENUMS_H */
@@ -0,0 +1,135 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TRACEREADER_H
+#define TRITON_TRACEREADER_H
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <triton/instruction.hpp>
+#include <triton/register.hpp>
+#include <triton/traceEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    //! The binary trace format namespace
+    namespace trace {
+    /*!
+     *  \ingroup format
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*! \brief The prototype of a replay hook.
+       *
+       * \description The hook takes as unique argument the instruction which has just been processed.
+       * Returning false stops the replay.
+       */
+      using replayHookCallback = std::function<bool(triton::arch::Instruction&)>;
+
+      /*! \class TraceReader
+       *  \brief Reads a binary trace. See triton::format::trace::trace_e for the layout.
+       *
+       *  \description On Unix systems, the trace is mapped in memory instead of being read. */
+      class TraceReader {
+        private:
+          //! Path file of the trace.
+          std::string path;
+
+          //! The raw trace (used when the trace cannot be mapped).
+          std::vector<triton::uint8> raw;
+
+          //! The trace content.
+          const triton::uint8* data;
+
+          //! The trace size.
+          triton::usize size;
+
+          //! True if `data` is a memory mapping of the file.
+          bool mapped;
+
+          //! The offset of the next record.
+          triton::usize offset;
+
+          //! The architecture of the trace.
+          triton::uint32 architecture;
+
+          //! The last read value of each register per thread id (the trace only records deltas).
+          std::map<triton::uint32, std::map<triton::uint32, triton::arch::Register>> registers;
+
+          //! Opens the trace.
+          void open(void);
+
+          //! Reads a little-endian value and moves the offset forward.
+          triton::uint64 read(triton::uint32 size);
+
+          //! Reads a concrete value and moves the offset forward.
+          triton::uint512 readValue(triton::uint32 size);
+
+          //! Throws an exception if less than `size` bytes are available.
+          void checkAvailable(triton::usize size) const;
+
+          //! Not copyable.
+          TraceReader(const TraceReader& other);
+
+          //! Not copyable.
+          void operator=(const TraceReader& other);
+
+        public:
+          //! Constructor. Opens and checks the trace.
+          TraceReader(const std::string& path);
+
+          //! Destructor.
+          virtual ~TraceReader();
+
+          //! Returns the architecture of the trace.
+          triton::uint32 getArchitecture(void) const;
+
+          //! Returns true if all records have been read.
+          bool isEnd(void) const;
+
+          //! Goes back to the first record.
+          void rewind(void);
+
+          /*!
+           * \brief Reads the next record into `inst`. Returns false if there is no more record.
+           *
+           * \description The address, the thread id, the opcodes and the concrete context of the instruction
+           * are set. The architecture of the trace must be defined. As the trace only records the registers which
+           * have changed, the context holds the last read value of every register of the thread. Thus, the replay
+           * does not depend on the instructions modelled by the semantics nor on the thread switches.
+           */
+          bool nextInstruction(triton::arch::Instruction& inst);
+      };
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEREADER_H */
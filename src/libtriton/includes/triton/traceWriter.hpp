@@ -0,0 +1,99 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TRACEWRITER_H
+#define TRITON_TRACEWRITER_H
+
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <triton/instruction.hpp>
+#include <triton/traceEnums.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    //! The binary trace format namespace
+    namespace trace {
+    /*!
+     *  \ingroup format
+     *  \addtogroup trace
+     *  @{
+     */
+
+      /*! \class TraceWriter
+       *  \brief Records instructions into a binary trace. See triton::format::trace::trace_e for the layout. */
+      class TraceWriter {
+        private:
+          //! The output stream.
+          std::ofstream stream;
+
+          //! The record currently built.
+          std::vector<triton::uint8> record;
+
+          //! The last recorded value of each register per thread id (used to only record deltas).
+          std::map<triton::uint32, std::map<triton::uint32, triton::uint512>> lastRegisters;
+
+          //! Appends a little-endian value to the current record.
+          void append(triton::uint64 value, triton::uint32 size);
+
+          //! Appends the first `size` bytes of a concrete value to the current record.
+          void appendValue(const triton::uint512& value, triton::uint32 size);
+
+          //! Not copyable.
+          TraceWriter(const TraceWriter& other);
+
+          //! Not copyable.
+          void operator=(const TraceWriter& other);
+
+        public:
+          //! Constructor. Creates the trace file and writes the header for the given architecture.
+          TraceWriter(const std::string& path, triton::uint32 architecture);
+
+          //! Destructor. Closes the trace.
+          virtual ~TraceWriter();
+
+          /*!
+           * \brief Records an instruction.
+           *
+           * \description The address, the thread id and the opcodes are recorded as well as the concrete
+           * context of the instruction (see triton::arch::Instruction::updateContext()) which is the state
+           * before its execution. If the instruction has been processed, the memory it has loaded is recorded
+           * instead, stores are never recorded. Registers whose value has not changed since their last record
+           * in the same thread are skipped, the reader restores them (see triton::format::trace::TraceReader::nextInstruction()).
+           */
+          void addInstruction(const triton::arch::Instruction& inst);
+
+          //! Flushes and closes the trace.
+          void close(void);
+      };
+
+    /*! @} End of trace namespace */
+    };
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEWRITER_H */
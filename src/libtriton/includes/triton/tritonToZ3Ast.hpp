@@ -8,6 +8,10 @@
 #ifndef TRITON_TRITONTOZ3AST_H
 #define TRITON_TRITONTOZ3AST_H
 
+#include <list>
+#include <unordered_map>
+#include <vector>
+
 #include <z3++.h>
 
 #include <triton/ast.hpp>
@@ -46,6 +50,27 @@ namespace triton {
         //! The map of symbols. E.g: (let (symbols expr1) expr2)
         std::map<std::string, triton::ast::AbstractNode*> symbols;
 
+        //! The memo of translated nodes. Nodes are referenced while they are in the memo.
+        std::unordered_map<triton::ast::AbstractNode*, z3::expr> translations;
+
+        //! The memos of the nodes translated under let nodes, one per let being translated. Nodes are not referenced.
+        std::list<std::unordered_map<triton::ast::AbstractNode*, z3::expr>> scopes;
+
+        //! Translates iteratively a node and the nodes it depends on which are not yet in the memo.
+        z3::expr translate(triton::ast::AbstractNode* node);
+
+        //! Returns the memo of the current scope.
+        std::unordered_map<triton::ast::AbstractNode*, z3::expr>& getMemo(void);
+
+        //! Sets the nodes which must be translated before a node.
+        void getDependencies(triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& dependencies);
+
+        //! Returns the translation of a node of the memo.
+        z3::expr& getTranslation(triton::ast::AbstractNode* node);
+
+        //! Returns the value of a decimal node.
+        triton::uint32 getDecimalValue(triton::ast::AbstractNode* node) const;
+
       protected:
         //! The result.
         Z3Result result;
@@ -57,9 +82,18 @@ namespace triton {
         //! Destructor.
         virtual ~TritonToZ3Ast();
 
-        //! Evaluates a Triton AST.
+        //! Evaluates a Triton AST. The DAG is walked iteratively and nodes already translated by this instance are taken from the memo.
         virtual Z3Result& eval(triton::ast::AbstractNode& e);
 
+        //! Returns the Z3 context of the translations.
+        z3::context& getContext(void);
+
+        //! Clears the memo of translated nodes.
+        void clearTranslations(void);
+
+        //! Returns the number of translated nodes in the memo.
+        triton::usize getNumberOfTranslations(void) const;
+
         //! Evaluate operator.
         virtual void operator()(triton::ast::AbstractNode& e);
         //! Evaluate operator.
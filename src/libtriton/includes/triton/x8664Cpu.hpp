@@ -10,12 +10,16 @@
 
 #include <map>
 #include <set>
+#include <string>
 #include <vector>
 
 #include <triton/callbacks.hpp>
 #include <triton/cpuInterface.hpp>
+#include <triton/disassemblyCache.hpp>
+#include <triton/externalLibs.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/pagedMemory.hpp>
 #include <triton/register.hpp>
 #include <triton/registerSpecification.hpp>
 #include <triton/tritonTypes.hpp>
@@ -53,14 +57,21 @@ namespace triton {
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
+          //! The capstone handle. It is opened once and kept during the whole life of the CPU.
+          triton::extlibs::capstone::csh handle;
+
+          //! The cache of decoded instructions.
+          mutable triton::arch::DisassemblyCache disassemblyCache;
+
+          //! Opens and configures the capstone handle.
+          void openCapstone(void);
+
         protected:
-          /*! \brief map of address -> concrete value
-           *
-           * \description
-           * **item1**: memory address<br>
-           * **item2**: concrete value
-           */
-          std::map<triton::uint64, triton::uint8> memory;
+          //! Concrete memory (sparse table of pages).
+          triton::arch::PagedMemory memory;
+
+          //! The parent registers (with their concrete value) when the snapshot has been taken.
+          std::vector<triton::arch::Register> snapshotRegisters;
 
           //! Concrete value of rax
           triton::uint8 rax[QWORD_SIZE];
@@ -329,8 +340,12 @@ namespace triton {
           /* Virtual pure inheritance ================================================= */
           bool isFlag(triton::uint32 regId) const;
           bool isMemoryMapped(triton::uint64 baseAddr, triton::usize size=1);
+          bool isSnapshotEnabled(void) const;
           bool isRegister(triton::uint32 regId) const;
           bool isRegisterValid(triton::uint32 regId) const;
+          bool isSyscall(const triton::arch::Instruction& inst) const;
+          const triton::arch::Register& getProgramCounter(void) const;
+          std::map<std::string, triton::usize> getDisassemblyCacheStats(void) const;
           std::set<triton::arch::Register*> getAllRegisters(void) const;
           std::set<triton::arch::Register*> getParentRegisters(void) const;
           std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
@@ -342,13 +357,19 @@ namespace triton {
           triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
           triton::uint8 getConcreteMemoryValue(triton::uint64 addr) const;
           void clear(void);
+          void discardSnapshot(void);
           void disassembly(triton::arch::Instruction& inst) const;
+          void flushDisassemblyCache(void);
           void init(void);
+          void mapMemoryArea(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size, const std::shared_ptr<const void>& owner);
+          void mapZeroMemory(triton::uint64 baseAddr, triton::usize size);
+          void restoreSnapshot(void);
           void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values);
           void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
           void setConcreteMemoryValue(const triton::arch::MemoryAccess& mem);
           void setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value);
           void setConcreteRegisterValue(const triton::arch::Register& reg);
+          void takeSnapshot(void);
           void unmapMemory(triton::uint64 baseAddr, triton::usize size=1);
           /* End of virtual pure inheritance ========================================== */
       };
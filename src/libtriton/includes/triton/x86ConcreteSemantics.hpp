@@ -0,0 +1,145 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_X86CONCRETESEMANTICS_H
+#define TRITON_X86CONCRETESEMANTICS_H
+
+#include <vector>
+
+#include <triton/architecture.hpp>
+#include <triton/instruction.hpp>
+#include <triton/operandWrapper.hpp>
+#include <triton/semanticsInterface.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The x86 namespace
+    namespace x86 {
+    /*!
+     *  \ingroup arch
+     *  \addtogroup x86
+     *  @{
+     */
+
+      /*! \class x86ConcreteSemantics
+          \brief The native (concrete only) semantics of a subset of the x86 ISA.
+
+          \description
+          Used when the triton::modes::CONCRETE_FAST_PATH mode is enabled. If none of the registers and memory cells read by the
+          instruction is symbolized or tainted, the concrete state is updated with native arithmetic, the written registers and
+          memory cells are concretized and untainted, and no AST is built. The registers, memory cells and immediates accessed are
+          still recorded into the instruction, with a null AST. Otherwise, `buildSemantics()` returns false without any side effect
+          and the full semantics (x86Semantics) must be used.
+
+          If the symbolic engine is disabled (taint-only mode), the inputs may be tainted. The taint is then spread through the
+          operands with the triton::engines::taint::TaintEngine routines, as the full semantics do, and only the concrete state
+          is updated.
+      */
+      class x86ConcreteSemantics : public SemanticsInterface {
+        private:
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! Taint Engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! The effective addresses of the memory operands of the current instruction (same order as the operands).
+          std::vector<triton::uint64> addresses;
+
+          //! True if the symbolic engine is disabled. The taint is then spread and the symbolic state is left untouched.
+          bool taintOnly;
+
+          //! Returns true if the register is neither symbolized nor tainted (tainted is allowed in the taint-only mode).
+          bool isConcreteRegister(const triton::arch::Register& reg) const;
+
+          //! Returns true if the memory area is neither symbolized nor tainted (tainted is allowed in the taint-only mode).
+          bool isConcreteMemory(triton::uint64 addr, triton::uint32 size) const;
+
+          //! Returns true if the operand is neither symbolized nor tainted. `index` is the index of the operand.
+          bool isConcreteOperand(const triton::arch::OperandWrapper& op, triton::usize index) const;
+
+          //! Returns true if a write into the register overwrites its whole parent register.
+          bool isFullWrite(const triton::arch::Register& reg) const;
+
+          //! Returns true if the operands may be handled natively and computes the effective addresses of the memory operands.
+          bool initOperands(triton::arch::Instruction& inst);
+
+          //! Returns the concrete value of a register and records it as read by the instruction.
+          triton::uint64 readRegister(triton::arch::Instruction& inst, const triton::arch::Register& reg);
+
+          //! Returns the concrete value of a memory area and records it as loaded by the instruction.
+          triton::uint64 readMemory(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem);
+
+          //! Returns the concrete value of an operand and records it as read by the instruction.
+          triton::uint64 readOperand(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op);
+
+          //! Writes the concrete value of a register, concretizes it and records it as written by the instruction.
+          void writeRegister(triton::arch::Instruction& inst, const triton::arch::Register& reg, triton::uint64 value);
+
+          //! Writes the concrete value of a memory area, concretizes it and records it as stored by the instruction.
+          void writeMemory(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem, triton::uint64 value);
+
+          //! Writes the concrete value of an operand, concretizes it and records it as written by the instruction.
+          void writeOperand(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op, triton::uint64 value);
+
+          //! Sets the parity, sign and zero flags according to a result.
+          void setResultFlags(triton::arch::Instruction& inst, triton::uint64 result, triton::uint32 size);
+
+          //! Returns the condition of a conditional jump.
+          bool getCondition(triton::arch::Instruction& inst, triton::uint32 type);
+
+          //! Returns the number of flags read by a conditional jump and stores them into `flags`.
+          triton::usize getConditionFlags(triton::uint32 type, const triton::arch::Register* flags[3]) const;
+
+          //! Returns true if the flags read by a conditional jump are concrete.
+          bool isConcreteCondition(triton::uint32 type) const;
+
+          //! Spreads the taint of the instruction before its execution (taint-only mode). Returns true if something is tainted.
+          bool spreadTaint(triton::arch::Instruction& inst);
+
+        public:
+          //! Constructor.
+          x86ConcreteSemantics(triton::arch::Architecture* architecture,
+                               triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                               triton::engines::taint::TaintEngine* taintEngine);
+
+          //! Destructor.
+          virtual ~x86ConcreteSemantics();
+
+          //! Executes natively the instruction. Returns false if the instruction must go through the full semantics.
+          bool buildSemantics(triton::arch::Instruction& inst);
+      };
+
+    /*! @} End of x86 namespace */
+    };
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_X86CONCRETESEMANTICS_H */
@@ -76,6 +76,18 @@ namespace triton {
           //! Sets a flag.
           void setFlag_s(triton::arch::Instruction& inst, triton::arch::Register& flag, std::string comment="");
 
+          //! Sets the concrete value of a flag and defers its symbolic expression until it is read (triton::modes::LAZY_FLAGS).
+          void deferFlag_s(triton::arch::Register& flag,
+                           triton::engines::symbolic::SymbolicExpression* parent,
+                           bool value,
+                           const std::string& comment,
+                           const triton::engines::symbolic::deferredBuilder& semantics,
+                           triton::ast::AbstractNode* op1=nullptr,
+                           triton::ast::AbstractNode* op2=nullptr);
+
+          //! Returns the concrete value of the bits [high:low] of a symbolic expression.
+          triton::uint512 extractConcreteValue(triton::engines::symbolic::SymbolicExpression* expr, triton::uint32 high, triton::uint32 low) const;
+
           //! Control flow semantics. Used to represent IP.
           void controlFlow_s(triton::arch::Instruction& inst);
 
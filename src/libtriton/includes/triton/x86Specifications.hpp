@@ -36,228 +36,228 @@ namespace triton {
      *  @{
      */
 
-      extern triton::arch::Register x86_reg_invalid;
-
-      extern triton::arch::Register x86_reg_rax;
-      extern triton::arch::Register x86_reg_eax;
-      extern triton::arch::Register x86_reg_ax;
-      extern triton::arch::Register x86_reg_ah;
-      extern triton::arch::Register x86_reg_al;
-
-      extern triton::arch::Register x86_reg_rbx;
-      extern triton::arch::Register x86_reg_ebx;
-      extern triton::arch::Register x86_reg_bx;
-      extern triton::arch::Register x86_reg_bh;
-      extern triton::arch::Register x86_reg_bl;
-
-      extern triton::arch::Register x86_reg_rcx;
-      extern triton::arch::Register x86_reg_ecx;
-      extern triton::arch::Register x86_reg_cx;
-      extern triton::arch::Register x86_reg_ch;
-      extern triton::arch::Register x86_reg_cl;
-
-      extern triton::arch::Register x86_reg_rdx;
-      extern triton::arch::Register x86_reg_edx;
-      extern triton::arch::Register x86_reg_dx;
-      extern triton::arch::Register x86_reg_dh;
-      extern triton::arch::Register x86_reg_dl;
-
-      extern triton::arch::Register x86_reg_rdi;
-      extern triton::arch::Register x86_reg_edi;
-      extern triton::arch::Register x86_reg_di;
-      extern triton::arch::Register x86_reg_dil;
-
-      extern triton::arch::Register x86_reg_rsi;
-      extern triton::arch::Register x86_reg_esi;
-      extern triton::arch::Register x86_reg_si;
-      extern triton::arch::Register x86_reg_sil;
-
-      extern triton::arch::Register x86_reg_rsp;
-      extern triton::arch::Register x86_reg_esp;
-      extern triton::arch::Register x86_reg_sp;
-      extern triton::arch::Register x86_reg_spl;
-      extern triton::arch::Register x86_reg_stack;
-
-      extern triton::arch::Register x86_reg_rbp;
-      extern triton::arch::Register x86_reg_ebp;
-      extern triton::arch::Register x86_reg_bp;
-      extern triton::arch::Register x86_reg_bpl;
-
-      extern triton::arch::Register x86_reg_rip;
-      extern triton::arch::Register x86_reg_eip;
-      extern triton::arch::Register x86_reg_ip;
-      extern triton::arch::Register x86_reg_pc;
-
-      extern triton::arch::Register x86_reg_eflags;
-
-      extern triton::arch::Register x86_reg_r8;
-      extern triton::arch::Register x86_reg_r8d;
-      extern triton::arch::Register x86_reg_r8w;
-      extern triton::arch::Register x86_reg_r8b;
-
-      extern triton::arch::Register x86_reg_r9;
-      extern triton::arch::Register x86_reg_r9d;
-      extern triton::arch::Register x86_reg_r9w;
-      extern triton::arch::Register x86_reg_r9b;
-
-      extern triton::arch::Register x86_reg_r10;
-      extern triton::arch::Register x86_reg_r10d;
-      extern triton::arch::Register x86_reg_r10w;
-      extern triton::arch::Register x86_reg_r10b;
-
-      extern triton::arch::Register x86_reg_r11;
-      extern triton::arch::Register x86_reg_r11d;
-      extern triton::arch::Register x86_reg_r11w;
-      extern triton::arch::Register x86_reg_r11b;
-
-      extern triton::arch::Register x86_reg_r12;
-      extern triton::arch::Register x86_reg_r12d;
-      extern triton::arch::Register x86_reg_r12w;
-      extern triton::arch::Register x86_reg_r12b;
-
-      extern triton::arch::Register x86_reg_r13;
-      extern triton::arch::Register x86_reg_r13d;
-      extern triton::arch::Register x86_reg_r13w;
-      extern triton::arch::Register x86_reg_r13b;
-
-      extern triton::arch::Register x86_reg_r14;
-      extern triton::arch::Register x86_reg_r14d;
-      extern triton::arch::Register x86_reg_r14w;
-      extern triton::arch::Register x86_reg_r14b;
-
-      extern triton::arch::Register x86_reg_r15;
-      extern triton::arch::Register x86_reg_r15d;
-      extern triton::arch::Register x86_reg_r15w;
-      extern triton::arch::Register x86_reg_r15b;
-
-      extern triton::arch::Register x86_reg_mm0;
-      extern triton::arch::Register x86_reg_mm1;
-      extern triton::arch::Register x86_reg_mm2;
-      extern triton::arch::Register x86_reg_mm3;
-      extern triton::arch::Register x86_reg_mm4;
-      extern triton::arch::Register x86_reg_mm5;
-      extern triton::arch::Register x86_reg_mm6;
-      extern triton::arch::Register x86_reg_mm7;
-
-      extern triton::arch::Register x86_reg_xmm0;
-      extern triton::arch::Register x86_reg_xmm1;
-      extern triton::arch::Register x86_reg_xmm2;
-      extern triton::arch::Register x86_reg_xmm3;
-      extern triton::arch::Register x86_reg_xmm4;
-      extern triton::arch::Register x86_reg_xmm5;
-      extern triton::arch::Register x86_reg_xmm6;
-      extern triton::arch::Register x86_reg_xmm7;
-      extern triton::arch::Register x86_reg_xmm8;
-      extern triton::arch::Register x86_reg_xmm9;
-      extern triton::arch::Register x86_reg_xmm10;
-      extern triton::arch::Register x86_reg_xmm11;
-      extern triton::arch::Register x86_reg_xmm12;
-      extern triton::arch::Register x86_reg_xmm13;
-      extern triton::arch::Register x86_reg_xmm14;
-      extern triton::arch::Register x86_reg_xmm15;
-
-      extern triton::arch::Register x86_reg_ymm0;
-      extern triton::arch::Register x86_reg_ymm1;
-      extern triton::arch::Register x86_reg_ymm2;
-      extern triton::arch::Register x86_reg_ymm3;
-      extern triton::arch::Register x86_reg_ymm4;
-      extern triton::arch::Register x86_reg_ymm5;
-      extern triton::arch::Register x86_reg_ymm6;
-      extern triton::arch::Register x86_reg_ymm7;
-      extern triton::arch::Register x86_reg_ymm8;
-      extern triton::arch::Register x86_reg_ymm9;
-      extern triton::arch::Register x86_reg_ymm10;
-      extern triton::arch::Register x86_reg_ymm11;
-      extern triton::arch::Register x86_reg_ymm12;
-      extern triton::arch::Register x86_reg_ymm13;
-      extern triton::arch::Register x86_reg_ymm14;
-      extern triton::arch::Register x86_reg_ymm15;
-
-      extern triton::arch::Register x86_reg_zmm0;
-      extern triton::arch::Register x86_reg_zmm1;
-      extern triton::arch::Register x86_reg_zmm2;
-      extern triton::arch::Register x86_reg_zmm3;
-      extern triton::arch::Register x86_reg_zmm4;
-      extern triton::arch::Register x86_reg_zmm5;
-      extern triton::arch::Register x86_reg_zmm6;
-      extern triton::arch::Register x86_reg_zmm7;
-      extern triton::arch::Register x86_reg_zmm8;
-      extern triton::arch::Register x86_reg_zmm9;
-      extern triton::arch::Register x86_reg_zmm10;
-      extern triton::arch::Register x86_reg_zmm11;
-      extern triton::arch::Register x86_reg_zmm12;
-      extern triton::arch::Register x86_reg_zmm13;
-      extern triton::arch::Register x86_reg_zmm14;
-      extern triton::arch::Register x86_reg_zmm15;
-      extern triton::arch::Register x86_reg_zmm16;
-      extern triton::arch::Register x86_reg_zmm17;
-      extern triton::arch::Register x86_reg_zmm18;
-      extern triton::arch::Register x86_reg_zmm19;
-      extern triton::arch::Register x86_reg_zmm20;
-      extern triton::arch::Register x86_reg_zmm21;
-      extern triton::arch::Register x86_reg_zmm22;
-      extern triton::arch::Register x86_reg_zmm23;
-      extern triton::arch::Register x86_reg_zmm24;
-      extern triton::arch::Register x86_reg_zmm25;
-      extern triton::arch::Register x86_reg_zmm26;
-      extern triton::arch::Register x86_reg_zmm27;
-      extern triton::arch::Register x86_reg_zmm28;
-      extern triton::arch::Register x86_reg_zmm29;
-      extern triton::arch::Register x86_reg_zmm30;
-      extern triton::arch::Register x86_reg_zmm31;
-
-      extern triton::arch::Register x86_reg_mxcsr;
-
-      extern triton::arch::Register x86_reg_cr0;
-      extern triton::arch::Register x86_reg_cr1;
-      extern triton::arch::Register x86_reg_cr2;
-      extern triton::arch::Register x86_reg_cr3;
-      extern triton::arch::Register x86_reg_cr4;
-      extern triton::arch::Register x86_reg_cr5;
-      extern triton::arch::Register x86_reg_cr6;
-      extern triton::arch::Register x86_reg_cr7;
-      extern triton::arch::Register x86_reg_cr8;
-      extern triton::arch::Register x86_reg_cr9;
-      extern triton::arch::Register x86_reg_cr10;
-      extern triton::arch::Register x86_reg_cr11;
-      extern triton::arch::Register x86_reg_cr12;
-      extern triton::arch::Register x86_reg_cr13;
-      extern triton::arch::Register x86_reg_cr14;
-      extern triton::arch::Register x86_reg_cr15;
-
-      extern triton::arch::Register x86_reg_af;
-      extern triton::arch::Register x86_reg_cf;
-      extern triton::arch::Register x86_reg_df;
-      extern triton::arch::Register x86_reg_if;
-      extern triton::arch::Register x86_reg_of;
-      extern triton::arch::Register x86_reg_pf;
-      extern triton::arch::Register x86_reg_sf;
-      extern triton::arch::Register x86_reg_tf;
-      extern triton::arch::Register x86_reg_zf;
-
-      extern triton::arch::Register x86_reg_ie;
-      extern triton::arch::Register x86_reg_de;
-      extern triton::arch::Register x86_reg_ze;
-      extern triton::arch::Register x86_reg_oe;
-      extern triton::arch::Register x86_reg_ue;
-      extern triton::arch::Register x86_reg_pe;
-      extern triton::arch::Register x86_reg_daz;
-      extern triton::arch::Register x86_reg_im;
-      extern triton::arch::Register x86_reg_dm;
-      extern triton::arch::Register x86_reg_zm;
-      extern triton::arch::Register x86_reg_om;
-      extern triton::arch::Register x86_reg_um;
-      extern triton::arch::Register x86_reg_pm;
-      extern triton::arch::Register x86_reg_rl;
-      extern triton::arch::Register x86_reg_rh;
-      extern triton::arch::Register x86_reg_fz;
-
-      extern triton::arch::Register x86_reg_cs;
-      extern triton::arch::Register x86_reg_ds;
-      extern triton::arch::Register x86_reg_es;
-      extern triton::arch::Register x86_reg_fs;
-      extern triton::arch::Register x86_reg_gs;
-      extern triton::arch::Register x86_reg_ss;
+      extern thread_local triton::arch::Register x86_reg_invalid;
+
+      extern thread_local triton::arch::Register x86_reg_rax;
+      extern thread_local triton::arch::Register x86_reg_eax;
+      extern thread_local triton::arch::Register x86_reg_ax;
+      extern thread_local triton::arch::Register x86_reg_ah;
+      extern thread_local triton::arch::Register x86_reg_al;
+
+      extern thread_local triton::arch::Register x86_reg_rbx;
+      extern thread_local triton::arch::Register x86_reg_ebx;
+      extern thread_local triton::arch::Register x86_reg_bx;
+      extern thread_local triton::arch::Register x86_reg_bh;
+      extern thread_local triton::arch::Register x86_reg_bl;
+
+      extern thread_local triton::arch::Register x86_reg_rcx;
+      extern thread_local triton::arch::Register x86_reg_ecx;
+      extern thread_local triton::arch::Register x86_reg_cx;
+      extern thread_local triton::arch::Register x86_reg_ch;
+      extern thread_local triton::arch::Register x86_reg_cl;
+
+      extern thread_local triton::arch::Register x86_reg_rdx;
+      extern thread_local triton::arch::Register x86_reg_edx;
+      extern thread_local triton::arch::Register x86_reg_dx;
+      extern thread_local triton::arch::Register x86_reg_dh;
+      extern thread_local triton::arch::Register x86_reg_dl;
+
+      extern thread_local triton::arch::Register x86_reg_rdi;
+      extern thread_local triton::arch::Register x86_reg_edi;
+      extern thread_local triton::arch::Register x86_reg_di;
+      extern thread_local triton::arch::Register x86_reg_dil;
+
+      extern thread_local triton::arch::Register x86_reg_rsi;
+      extern thread_local triton::arch::Register x86_reg_esi;
+      extern thread_local triton::arch::Register x86_reg_si;
+      extern thread_local triton::arch::Register x86_reg_sil;
+
+      extern thread_local triton::arch::Register x86_reg_rsp;
+      extern thread_local triton::arch::Register x86_reg_esp;
+      extern thread_local triton::arch::Register x86_reg_sp;
+      extern thread_local triton::arch::Register x86_reg_spl;
+      extern thread_local triton::arch::Register x86_reg_stack;
+
+      extern thread_local triton::arch::Register x86_reg_rbp;
+      extern thread_local triton::arch::Register x86_reg_ebp;
+      extern thread_local triton::arch::Register x86_reg_bp;
+      extern thread_local triton::arch::Register x86_reg_bpl;
+
+      extern thread_local triton::arch::Register x86_reg_rip;
+      extern thread_local triton::arch::Register x86_reg_eip;
+      extern thread_local triton::arch::Register x86_reg_ip;
+      extern thread_local triton::arch::Register x86_reg_pc;
+
+      extern thread_local triton::arch::Register x86_reg_eflags;
+
+      extern thread_local triton::arch::Register x86_reg_r8;
+      extern thread_local triton::arch::Register x86_reg_r8d;
+      extern thread_local triton::arch::Register x86_reg_r8w;
+      extern thread_local triton::arch::Register x86_reg_r8b;
+
+      extern thread_local triton::arch::Register x86_reg_r9;
+      extern thread_local triton::arch::Register x86_reg_r9d;
+      extern thread_local triton::arch::Register x86_reg_r9w;
+      extern thread_local triton::arch::Register x86_reg_r9b;
+
+      extern thread_local triton::arch::Register x86_reg_r10;
+      extern thread_local triton::arch::Register x86_reg_r10d;
+      extern thread_local triton::arch::Register x86_reg_r10w;
+      extern thread_local triton::arch::Register x86_reg_r10b;
+
+      extern thread_local triton::arch::Register x86_reg_r11;
+      extern thread_local triton::arch::Register x86_reg_r11d;
+      extern thread_local triton::arch::Register x86_reg_r11w;
+      extern thread_local triton::arch::Register x86_reg_r11b;
+
+      extern thread_local triton::arch::Register x86_reg_r12;
+      extern thread_local triton::arch::Register x86_reg_r12d;
+      extern thread_local triton::arch::Register x86_reg_r12w;
+      extern thread_local triton::arch::Register x86_reg_r12b;
+
+      extern thread_local triton::arch::Register x86_reg_r13;
+      extern thread_local triton::arch::Register x86_reg_r13d;
+      extern thread_local triton::arch::Register x86_reg_r13w;
+      extern thread_local triton::arch::Register x86_reg_r13b;
+
+      extern thread_local triton::arch::Register x86_reg_r14;
+      extern thread_local triton::arch::Register x86_reg_r14d;
+      extern thread_local triton::arch::Register x86_reg_r14w;
+      extern thread_local triton::arch::Register x86_reg_r14b;
+
+      extern thread_local triton::arch::Register x86_reg_r15;
+      extern thread_local triton::arch::Register x86_reg_r15d;
+      extern thread_local triton::arch::Register x86_reg_r15w;
+      extern thread_local triton::arch::Register x86_reg_r15b;
+
+      extern thread_local triton::arch::Register x86_reg_mm0;
+      extern thread_local triton::arch::Register x86_reg_mm1;
+      extern thread_local triton::arch::Register x86_reg_mm2;
+      extern thread_local triton::arch::Register x86_reg_mm3;
+      extern thread_local triton::arch::Register x86_reg_mm4;
+      extern thread_local triton::arch::Register x86_reg_mm5;
+      extern thread_local triton::arch::Register x86_reg_mm6;
+      extern thread_local triton::arch::Register x86_reg_mm7;
+
+      extern thread_local triton::arch::Register x86_reg_xmm0;
+      extern thread_local triton::arch::Register x86_reg_xmm1;
+      extern thread_local triton::arch::Register x86_reg_xmm2;
+      extern thread_local triton::arch::Register x86_reg_xmm3;
+      extern thread_local triton::arch::Register x86_reg_xmm4;
+      extern thread_local triton::arch::Register x86_reg_xmm5;
+      extern thread_local triton::arch::Register x86_reg_xmm6;
+      extern thread_local triton::arch::Register x86_reg_xmm7;
+      extern thread_local triton::arch::Register x86_reg_xmm8;
+      extern thread_local triton::arch::Register x86_reg_xmm9;
+      extern thread_local triton::arch::Register x86_reg_xmm10;
+      extern thread_local triton::arch::Register x86_reg_xmm11;
+      extern thread_local triton::arch::Register x86_reg_xmm12;
+      extern thread_local triton::arch::Register x86_reg_xmm13;
+      extern thread_local triton::arch::Register x86_reg_xmm14;
+      extern thread_local triton::arch::Register x86_reg_xmm15;
+
+      extern thread_local triton::arch::Register x86_reg_ymm0;
+      extern thread_local triton::arch::Register x86_reg_ymm1;
+      extern thread_local triton::arch::Register x86_reg_ymm2;
+      extern thread_local triton::arch::Register x86_reg_ymm3;
+      extern thread_local triton::arch::Register x86_reg_ymm4;
+      extern thread_local triton::arch::Register x86_reg_ymm5;
+      extern thread_local triton::arch::Register x86_reg_ymm6;
+      extern thread_local triton::arch::Register x86_reg_ymm7;
+      extern thread_local triton::arch::Register x86_reg_ymm8;
+      extern thread_local triton::arch::Register x86_reg_ymm9;
+      extern thread_local triton::arch::Register x86_reg_ymm10;
+      extern thread_local triton::arch::Register x86_reg_ymm11;
+      extern thread_local triton::arch::Register x86_reg_ymm12;
+      extern thread_local triton::arch::Register x86_reg_ymm13;
+      extern thread_local triton::arch::Register x86_reg_ymm14;
+      extern thread_local triton::arch::Register x86_reg_ymm15;
+
+      extern thread_local triton::arch::Register x86_reg_zmm0;
+      extern thread_local triton::arch::Register x86_reg_zmm1;
+      extern thread_local triton::arch::Register x86_reg_zmm2;
+      extern thread_local triton::arch::Register x86_reg_zmm3;
+      extern thread_local triton::arch::Register x86_reg_zmm4;
+      extern thread_local triton::arch::Register x86_reg_zmm5;
+      extern thread_local triton::arch::Register x86_reg_zmm6;
+      extern thread_local triton::arch::Register x86_reg_zmm7;
+      extern thread_local triton::arch::Register x86_reg_zmm8;
+      extern thread_local triton::arch::Register x86_reg_zmm9;
+      extern thread_local triton::arch::Register x86_reg_zmm10;
+      extern thread_local triton::arch::Register x86_reg_zmm11;
+      extern thread_local triton::arch::Register x86_reg_zmm12;
+      extern thread_local triton::arch::Register x86_reg_zmm13;
+      extern thread_local triton::arch::Register x86_reg_zmm14;
+      extern thread_local triton::arch::Register x86_reg_zmm15;
+      extern thread_local triton::arch::Register x86_reg_zmm16;
+      extern thread_local triton::arch::Register x86_reg_zmm17;
+      extern thread_local triton::arch::Register x86_reg_zmm18;
+      extern thread_local triton::arch::Register x86_reg_zmm19;
+      extern thread_local triton::arch::Register x86_reg_zmm20;
+      extern thread_local triton::arch::Register x86_reg_zmm21;
+      extern thread_local triton::arch::Register x86_reg_zmm22;
+      extern thread_local triton::arch::Register x86_reg_zmm23;
+      extern thread_local triton::arch::Register x86_reg_zmm24;
+      extern thread_local triton::arch::Register x86_reg_zmm25;
+      extern thread_local triton::arch::Register x86_reg_zmm26;
+      extern thread_local triton::arch::Register x86_reg_zmm27;
+      extern thread_local triton::arch::Register x86_reg_zmm28;
+      extern thread_local triton::arch::Register x86_reg_zmm29;
+      extern thread_local triton::arch::Register x86_reg_zmm30;
+      extern thread_local triton::arch::Register x86_reg_zmm31;
+
+      extern thread_local triton::arch::Register x86_reg_mxcsr;
+
+      extern thread_local triton::arch::Register x86_reg_cr0;
+      extern thread_local triton::arch::Register x86_reg_cr1;
+      extern thread_local triton::arch::Register x86_reg_cr2;
+      extern thread_local triton::arch::Register x86_reg_cr3;
+      extern thread_local triton::arch::Register x86_reg_cr4;
+      extern thread_local triton::arch::Register x86_reg_cr5;
+      extern thread_local triton::arch::Register x86_reg_cr6;
+      extern thread_local triton::arch::Register x86_reg_cr7;
+      extern thread_local triton::arch::Register x86_reg_cr8;
+      extern thread_local triton::arch::Register x86_reg_cr9;
+      extern thread_local triton::arch::Register x86_reg_cr10;
+      extern thread_local triton::arch::Register x86_reg_cr11;
+      extern thread_local triton::arch::Register x86_reg_cr12;
+      extern thread_local triton::arch::Register x86_reg_cr13;
+      extern thread_local triton::arch::Register x86_reg_cr14;
+      extern thread_local triton::arch::Register x86_reg_cr15;
+
+      extern thread_local triton::arch::Register x86_reg_af;
+      extern thread_local triton::arch::Register x86_reg_cf;
+      extern thread_local triton::arch::Register x86_reg_df;
+      extern thread_local triton::arch::Register x86_reg_if;
+      extern thread_local triton::arch::Register x86_reg_of;
+      extern thread_local triton::arch::Register x86_reg_pf;
+      extern thread_local triton::arch::Register x86_reg_sf;
+      extern thread_local triton::arch::Register x86_reg_tf;
+      extern thread_local triton::arch::Register x86_reg_zf;
+
+      extern thread_local triton::arch::Register x86_reg_ie;
+      extern thread_local triton::arch::Register x86_reg_de;
+      extern thread_local triton::arch::Register x86_reg_ze;
+      extern thread_local triton::arch::Register x86_reg_oe;
+      extern thread_local triton::arch::Register x86_reg_ue;
+      extern thread_local triton::arch::Register x86_reg_pe;
+      extern thread_local triton::arch::Register x86_reg_daz;
+      extern thread_local triton::arch::Register x86_reg_im;
+      extern thread_local triton::arch::Register x86_reg_dm;
+      extern thread_local triton::arch::Register x86_reg_zm;
+      extern thread_local triton::arch::Register x86_reg_om;
+      extern thread_local triton::arch::Register x86_reg_um;
+      extern thread_local triton::arch::Register x86_reg_pm;
+      extern thread_local triton::arch::Register x86_reg_rl;
+      extern thread_local triton::arch::Register x86_reg_rh;
+      extern thread_local triton::arch::Register x86_reg_fz;
+
+      extern thread_local triton::arch::Register x86_reg_cs;
+      extern thread_local triton::arch::Register x86_reg_ds;
+      extern thread_local triton::arch::Register x86_reg_es;
+      extern thread_local triton::arch::Register x86_reg_fs;
+      extern thread_local triton::arch::Register x86_reg_gs;
+      extern thread_local triton::arch::Register x86_reg_ss;
 
 
       //! \class x86Specifications
@@ -9,6 +9,7 @@
 #define TRITON_Z3INTERFACE_HPP
 
 #include <triton/symbolicEngine.hpp>
+#include <triton/tritonToZ3Ast.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -35,6 +36,12 @@ namespace triton {
         //! Symbolic Engine API
         triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
+        //! The translator used by simplify(). Its memo is kept between calls, until it holds more than 65536 nodes.
+        mutable triton::ast::TritonToZ3Ast translator;
+
+        //! The revision of symbolic expressions when the memo of translations has been built.
+        mutable triton::usize astRevision;
+
       public:
         //! Constructor.
         Z3Interface(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
@@ -8,6 +8,7 @@
 #ifndef TRITON_Z3TOTRITONAST_H
 #define TRITON_Z3TOTRITONAST_H
 
+#include <unordered_map>
 #include <z3++.h>
 
 #include <triton/ast.hpp>
@@ -38,9 +39,15 @@ namespace triton {
         //! Symbolic Engine API
         triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
-        //! Vists and converts
+        //! The memo of the conversion in progress. Keys are the ids of the Z3's nodes.
+        std::unordered_map<unsigned, triton::ast::AbstractNode*> translations;
+
+        //! Converts a node whose arguments have already been converted.
         triton::ast::AbstractNode* visit(z3::expr const& expr);
 
+        //! Returns the conversion of a node of the memo.
+        triton::ast::AbstractNode* getTranslation(z3::expr const& expr);
+
       protected:
         //! Z3's context
         z3::context context;
@@ -64,7 +71,7 @@ namespace triton {
         //! Sets the expression.
         void setExpr(z3::expr& expr);
 
-        //! Converts to Triton's AST
+        //! Converts to Triton's AST. The DAG is walked iteratively and each node is converted once.
         triton::ast::AbstractNode* convert(void);
     };
 
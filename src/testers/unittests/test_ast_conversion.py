@@ -67,3 +67,10 @@ class TestAstConversion(unittest.TestCase):
         for n in self.node:
             self.assertEqual(n.evaluate(), simplify(n, True).evaluate())
 
+
+    def test_shared_dag(self):
+        """Check that shared nodes are converted once (2^200 paths)."""
+        node = self.v1
+        for i in range(200):
+            node = (node ^ bv(i, 8)) + (node * bv(3, 8))
+        self.assertEqual(node.evaluate(), simplify(node, True).evaluate())
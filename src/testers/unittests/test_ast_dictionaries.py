@@ -41,3 +41,102 @@ class TestAstDictionaries(unittest.TestCase):
         self.assertEqual(d['decimal'], 3)
         self.assertEqual(d['allocatedDictionaries'], 5)
         self.assertEqual(d['allocatedNodes'], 12)
+
+    def test_table_stats(self):
+        for i in range(2000):
+            bv(i, 32)
+
+        d = getAstDictionariesStats()
+        self.assertEqual(d['decimal'], 2000)
+        self.assertEqual(d['bv'], 2000)
+        self.assertEqual(d['allocatedDictionaries'], 4000)
+        self.assertGreaterEqual(d['capacity'], 4000)
+        self.assertLessEqual(d['loadFactor'], 75)
+        self.assertGreaterEqual(d['maxProbeLength'], 1)
+        self.assertGreaterEqual(d['totalProbeLength'], d['allocatedDictionaries'])
+
+    def test_reclamation(self):
+        """Nodes of removed expressions are deleted if they are not used anymore."""
+        enableMode(MODE.ONLY_ON_SYMBOLIZED, True)
+
+        def run(start, end):
+            for i in range(start, end):
+                setConcreteRegisterValue(Register(REG.RAX, i))
+                processing(Instruction("\x48\xff\xc0")) # inc rax
+            return getAstDictionariesStats()['allocatedDictionaries']
+
+        d1 = run(0, 100)
+        d2 = run(100, 1000)
+
+        # Without reclamation, each instruction leaves several new nodes
+        self.assertLess(d2 - d1, 100)
+
+        # Nodes held by Python are never deleted
+        node = bv(0x1000, 64)
+        run(0x1000, 0x1010)
+        self.assertEqual(node.evaluate(), 0x1000)
+        self.assertEqual(node.getChilds()[0].getValue(), 0x1000)
+
+    def test_concretization(self):
+        """Nodes of the expressions which are not reachable anymore are deleted by the concretization."""
+        setConcreteRegisterValue(Register(REG.RBX, 0x1000))
+        for i in range(100):
+            processing(Instruction("\x48\xff\xc0"))     # inc rax
+            processing(Instruction("\x48\x89\x03"))     # mov [rbx], rax
+            processing(Instruction("\x48\x83\xc3\x08")) # add rbx, 8
+
+        def stats():
+            return (getAstDictionariesStats()['allocatedDictionaries'], getAstAllocatorStats()['usedBlocks'], len(getSymbolicExpressions()))
+
+        d1, b1, e1 = stats()
+        concretizeAllMemory()
+        d2, b2, e2 = stats()
+        self.assertLess(d2, d1)
+        self.assertLess(b2, b1)
+        self.assertLess(e2, e1)
+
+        # Expressions used by registers are kept
+        self.assertEqual(getFullAstFromId(getSymbolicRegisterId(REG.RAX)).evaluate(), 100)
+
+        concretizeAllRegister()
+        d3, b3, e3 = stats()
+        self.assertLess(d3, d2)
+        self.assertLess(b3, b2)
+        self.assertEqual(e3, 0)
+
+    def test_shared_node(self):
+        """A node shared by a lot of parents."""
+        shared = bv(1, 64)
+        nodes  = [bvadd(bv(i, 64), shared) for i in range(100)]
+        self.assertEqual(len(shared.getParents()), 100)
+
+        del nodes
+        resetEngines()
+        self.assertEqual(shared.evaluate(), 1)
+        self.assertEqual(bvadd(shared, bv(2, 64)).evaluate(), 3)
+
+    def test_modified_node(self):
+        """A node whose childs have changed since its recording is still removed from the dictionaries."""
+        node = bvadd(bv(0x1111, 64), bv(0x2222, 64))
+        assignSymbolicExpressionToRegister(newSymbolicExpression(node), REG.RAX)
+        node.setChild(1, bv(0x3333, 64))
+        self.assertEqual(node.evaluate(), 0x4444)
+        self.assertEqual(getAstDictionariesStats()['bvadd'], 1)
+
+        del node
+        concretizeAllRegister()
+        self.assertEqual(getAstDictionariesStats()['bvadd'], 0)
+
+    def test_free_all(self):
+        """Resetting the engines releases the slabs of the nodes as a whole, except the ones of referenced nodes."""
+        for i in range(5000):
+            bvadd(bv(i, 64), bv(i + 1, 64))
+
+        node = bvmul(bv(3, 64), bv(5, 64))
+        b1 = getAstAllocatorStats()
+
+        resetEngines()
+        b2 = getAstAllocatorStats()
+        self.assertLess(b2['usedBlocks'], b1['usedBlocks'])
+        self.assertLess(b2['slabs'], b1['slabs'])
+        self.assertEqual(node.evaluate(), 15)
@@ -4,10 +4,12 @@
 
 import unittest
 
-from triton import setArchitecture, ARCH, evaluateAstViaZ3
+from triton import (setArchitecture, ARCH, evaluateAstViaZ3, enableMode, MODE,
+                    newSymbolicVariable, newSymbolicExpression)
 from triton.ast import (bv, bvsub, bvadd, bvxor, bvor, bvand, bvnand, bvnor,
                         bvxnor, bvmul, bvneg, bvnot, bvsdiv, sx, zx, bvudiv,
-                        bvashr, bvlshr, bvshl, bvrol, bvror, bvsmod, bvsrem)
+                        bvashr, bvlshr, bvshl, bvrol, bvror, bvsmod, bvsrem,
+                        concat, extract, variable, reference)
 
 
 class TestAstEval(unittest.TestCase):
@@ -802,3 +804,65 @@ class TestAstEval(unittest.TestCase):
             bvsrem(zx(64, bv(9223372036854775808, 64)), sx(64, bv(18446744073709551615, 64))),
         ]
         self.check_ast(tests)
+
+    def test_native_boundaries(self):
+        """Check operations around the 64-bit boundary (native and wide values)."""
+        tests = [
+            bvsdiv(bv(0x8000000000000000, 64), bv(0xffffffffffffffff, 64)),
+            bvsrem(bv(0x8000000000000000, 64), bv(0xffffffffffffffff, 64)),
+            bvsmod(bv(0x8000000000000000, 64), bv(0xffffffffffffffff, 64)),
+            bvsmod(bv(0x7fffffffffffffff, 64), bv(0x8000000000000001, 64)),
+            bvashr(bv(0x8000000000000000, 64), bv(63, 64)),
+            bvashr(bv(0x8000000000000000, 64), bv(64, 64)),
+            bvlshr(bv(0x8000000000000000, 64), bv(64, 64)),
+            bvshl(bv(0x8000000000000001, 64), bv(64, 64)),
+            bvrol(64, bv(0x8000000000000001, 64)),
+            bvror(1, bv(0x8000000000000001, 64)),
+            bvmul(bv(0xffffffffffffffff, 64), bv(0xffffffffffffffff, 64)),
+            bvadd(bv(0xffffffffffffffff, 64), bv(1, 64)),
+            bvneg(bv(0x8000000000000000, 64)),
+            concat([bv(0x12345678, 32), bv(0x9abcdef0, 32)]),
+            concat([bv(0xffffffffffffffff, 64), bv(1, 64)]),
+            extract(63, 0, concat([bv(0x1122334455667788, 64), bv(0x99aabbccddeeff00, 64)])),
+            extract(127, 64, concat([bv(0x1122334455667788, 64), bv(0x99aabbccddeeff00, 64)])),
+            extract(71, 8, concat([bv(0x1122334455667788, 64), bv(0x99aabbccddeeff00, 64)])),
+            sx(64, bv(0x8000000000000000, 64)),
+            zx(64, bv(0x8000000000000000, 64)),
+            bvadd(bv(0xffffffffffffffffffffffffffffffff, 128), bv(2, 128)),
+            bvsdiv(bv(0x80000000000000000000000000000000, 128), bv(3, 128)),
+            bvashr(bv(0x80000000000000000000000000000000, 128), bv(65, 128)),
+        ]
+        self.check_ast(tests)
+
+
+class TestAstLazyEval(unittest.TestCase):
+
+    """Testing the LAZY_EVALUATION mode."""
+
+    def setUp(self):
+        """Define the arch."""
+        setArchitecture(ARCH.X86_64)
+
+    def build(self):
+        """Build a chain of expressions on top of a symbolic variable."""
+        var   = newSymbolicVariable(32)
+        nodes = [variable(var)]
+        for i in range(200):
+            expr = newSymbolicExpression(bvxor(bvmul(nodes[-1], bv(3, 32)), bv(i, 32)))
+            nodes.append(reference(expr.getId()))
+        return var, nodes
+
+    def test_lazy_eval(self):
+        """Check lazy and eager evaluations give the same values."""
+        var, nodes = self.build()
+        values = list()
+        for value in [1, 0x1234, 0xffffffff]:
+            var.setConcreteValue(value)
+            values.append([nodes[i].evaluate() for i in range(0, 201, 20)])
+
+        setArchitecture(ARCH.X86_64)
+        enableMode(MODE.LAZY_EVALUATION, True)
+        var, nodes = self.build()
+        for index, value in enumerate([1, 0x1234, 0xffffffff]):
+            var.setConcreteValue(value)
+            self.assertEqual(values[index], [nodes[i].evaluate() for i in range(0, 201, 20)])
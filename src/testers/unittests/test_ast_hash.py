@@ -0,0 +1,79 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the structural hash of AST nodes."""
+
+import unittest
+
+from triton     import *
+from triton.ast import *
+
+
+class TestAstHash(unittest.TestCase):
+
+    """Testing the structural hash cached in AST nodes."""
+
+    def setUp(self):
+        """Define the arch."""
+        setArchitecture(ARCH.X86_64)
+
+        self.v1 = variable(newSymbolicVariable(8))
+        self.v2 = variable(newSymbolicVariable(8))
+
+    def test_structural(self):
+        """Check that the hash only depends on the structure of the tree."""
+        a = bvadd(bvxor(self.v1, bv(1, 8)), self.v2)
+        b = bvadd(bvxor(self.v1, bv(1, 8)), self.v2)
+        self.assertEqual(a.getHash(), b.getHash())
+        self.assertTrue(a.equalTo(b))
+
+        c = bvadd(self.v2, bvxor(self.v1, bv(1, 8)))
+        d = bvadd(bvxor(self.v1, bv(2, 8)), self.v2)
+        e = bvsub(bvxor(self.v1, bv(1, 8)), self.v2)
+        for n in [c, d, e]:
+            self.assertNotEqual(a.getHash(), n.getHash())
+            self.assertFalse(a.equalTo(n))
+
+        self.assertNotEqual(bv(1, 8).getHash(), bv(1, 16).getHash())
+        self.assertNotEqual(self.v1.getHash(), self.v2.getHash())
+        self.assertNotEqual(string("a").getHash(), string("b").getHash())
+
+    def test_update(self):
+        """Check that the hash follows the modifications of the tree."""
+        a = bvadd(bvxor(self.v1, bv(1, 8)), self.v2)
+        b = bvadd(bvxor(self.v1, bv(2, 8)), self.v2)
+        self.assertNotEqual(a.getHash(), b.getHash())
+
+        # The hash of the root is updated from a change deep in the tree
+        a.getChilds()[0].setChild(1, bv(2, 8))
+        self.assertEqual(a.getHash(), b.getHash())
+        self.assertTrue(a.equalTo(b))
+
+    def test_lazy_evaluation(self):
+        """Check that the hash of dirty nodes is computed when it is queried."""
+        enableMode(MODE.LAZY_EVALUATION, True)
+        a = bvadd(bvxor(self.v1, bv(1, 8)), self.v2)
+        b = bvadd(bvxor(self.v1, bv(2, 8)), self.v2)
+        a.getChilds()[0].setChild(1, bv(2, 8))
+        self.assertEqual(a.getHash(), b.getHash())
+        enableMode(MODE.LAZY_EVALUATION, False)
+
+    def test_deep(self):
+        """Check the hash and the comparison of deep trees with shared sub-trees."""
+        a = self.v1
+        b = self.v1
+        for i in range(2000):
+            a = bvadd(a, a)
+            b = bvadd(b, b)
+        self.assertEqual(a.getHash(), b.getHash())
+        self.assertTrue(a.equalTo(b))
+        self.assertFalse(a.equalTo(bvadd(b, self.v2)))
+
+    def test_full_ast(self):
+        """Check that the full AST of an expression has the hash of the same tree built from scratch."""
+        expr1 = newSymbolicExpression(bvxor(self.v1, bv(1, 8)))
+        expr2 = newSymbolicExpression(bvadd(reference(expr1.getId()), self.v2))
+        a = getFullAstFromId(expr2.getId())
+        b = bvadd(bvxor(self.v1, bv(1, 8)), self.v2)
+        self.assertEqual(a.getHash(), b.getHash())
+        self.assertTrue(a.equalTo(b))
+        self.assertNotEqual(a.getHash(), expr2.getAst().getHash())
@@ -94,3 +94,55 @@ class TestAstSimplification(unittest.TestCase):
                     return c1_nonNot ^ c2_nonNot
 
         return node
+
+
+class TestAstNativeSimplification(unittest.TestCase):
+
+    """Testing the built-in simplification rules."""
+
+    def setUp(self):
+        setArchitecture(ARCH.X86_64)
+        enableMode(MODE.AST_SIMPLIFICATION, True)
+        self.a = variable(newSymbolicVariable(32))
+        self.b = variable(newSymbolicVariable(8))
+
+    def check(self, node, expected):
+        simplified = simplify(node)
+        self.assertEqual(str(simplified), expected)
+        self.assertEqual(len(getModel(assert_(distinct(node, simplified)))), 0)
+
+    def test_constant_folding(self):
+        self.check((bv(2, 32) * bv(3, 32)) + self.a, "(bvadd SymVar_0 (_ bv6 32))")
+        self.check(extract(7, 0, bv(0x1234, 32)) ^ self.b, "(bvxor SymVar_1 (_ bv52 8))")
+
+    def test_identities(self):
+        self.check(self.a ^ self.a, "(_ bv0 32)")
+        self.check(self.a & bv(0, 32), "(_ bv0 32)")
+        self.check(self.a | bv(0xffffffff, 32), "(_ bv4294967295 32)")
+        self.check((self.a + bv(0, 32)) * bv(1, 32), "SymVar_0")
+        self.check(~~self.a, "SymVar_0")
+        self.check(ite(equal(bv(1, 8), bv(1, 8)), self.a, bv(0, 32)), "SymVar_0")
+
+    def test_extract(self):
+        self.check(extract(7, 0, concat([bv(1, 8), (bv(2, 32) + self.a) + bv(3, 32)])), "((_ extract 7 0) (bvadd SymVar_0 (_ bv5 32)))")
+        self.check(extract(39, 32, concat([self.b, self.a])), "SymVar_1")
+        self.check(extract(3, 0, extract(15, 8, self.a)), "((_ extract 11 8) SymVar_0)")
+        self.check(extract(7, 0, zx(32, self.a)), "((_ extract 7 0) SymVar_0)")
+        self.check(extract(63, 32, zx(32, self.a)), "(_ bv0 32)")
+        self.check(extract(31, 0, sx(32, self.a)), "SymVar_0")
+
+    def test_extend(self):
+        self.check(zx(8, zx(16, self.b)), "((_ zero_extend 24) SymVar_1)")
+        self.check(sx(8, sx(16, self.b)), "((_ sign_extend 24) SymVar_1)")
+        self.check(sx(8, zx(16, self.b)), "((_ zero_extend 24) SymVar_1)")
+
+    def test_expression(self):
+        expr = newSymbolicExpression((self.a ^ self.a) + extract(31, 0, zx(32, self.a)))
+        self.assertEqual(str(expr.getAst()), "SymVar_0")
+
+    def test_symbolized(self):
+        node = equal(self.a ^ self.a, bv(0, 32))
+        self.assertTrue(node.isSymbolized())
+        simplified = simplify(node)
+        self.assertEqual(str(simplified), "(= (_ bv0 32) (_ bv0 32))")
+        self.assertFalse(simplified.isSymbolized())
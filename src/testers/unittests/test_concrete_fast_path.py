@@ -0,0 +1,164 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the concrete fast path."""
+
+import unittest
+
+from triton import (setArchitecture, ARCH, REG, MODE, Register, Instruction, MemoryAccess, CPUSIZE,
+                    enableMode, isModeEnabled, processing, setConcreteRegisterValue,
+                    getConcreteRegisterValue, getConcreteMemoryValue, convertRegisterToSymbolicVariable,
+                    isRegisterSymbolized, isMemorySymbolized, taintRegister, isRegisterTainted,
+                    getPathConstraints, concretizeAllRegister)
+
+
+class TestConcreteFastPath(unittest.TestCase):
+
+    """Testing the native execution of concrete instructions."""
+
+    def setUp(self):
+        """Define the arch and enable the mode."""
+        setArchitecture(ARCH.X86_64)
+        enableMode(MODE.CONCRETE_FAST_PATH, True)
+
+    def tearDown(self):
+        """Disable the mode."""
+        enableMode(MODE.CONCRETE_FAST_PATH, False)
+
+    def test_mode(self):
+        """Check the mode."""
+        self.assertTrue(isModeEnabled(MODE.CONCRETE_FAST_PATH))
+        enableMode(MODE.CONCRETE_FAST_PATH, False)
+        self.assertFalse(isModeEnabled(MODE.CONCRETE_FAST_PATH))
+
+    def test_concrete(self):
+        """Check that concrete instructions build no expression."""
+        setConcreteRegisterValue(Register(REG.RAX, 0xffffffffffffffff))
+        setConcreteRegisterValue(Register(REG.RSP, 0x7000))
+
+        inst = Instruction("\x48\x83\xc0\x01")  # add rax, 1
+        processing(inst)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 0)
+        self.assertEqual(getConcreteRegisterValue(REG.ZF), 1)
+        self.assertEqual(getConcreteRegisterValue(REG.CF), 1)
+
+        inst = Instruction("\x50")  # push rax
+        processing(inst)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertEqual(getConcreteRegisterValue(REG.RSP), 0x6ff8)
+        self.assertEqual(getConcreteMemoryValue(MemoryAccess(0x6ff8, CPUSIZE.QWORD)), 0)
+
+        inst = Instruction("\x74\x10")  # je +0x10
+        inst.setAddress(0x1000)
+        processing(inst)
+        self.assertTrue(inst.isConditionTaken())
+        self.assertEqual(getConcreteRegisterValue(REG.RIP), 0x1012)
+        self.assertEqual(len(getPathConstraints()), 0)
+
+    def test_accesses(self):
+        """Check that the accesses of concrete instructions are recorded."""
+        setConcreteRegisterValue(Register(REG.RAX, 0x5000))
+        setConcreteRegisterValue(Register(REG.RBX, 0x41))
+
+        inst = Instruction("\x48\x89\x18")  # mov qword ptr [rax], rbx
+        processing(inst)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertTrue(inst.isMemoryWrite())
+        self.assertFalse(inst.isMemoryRead())
+        stores = inst.getStoreAccess()
+        self.assertEqual(len(stores), 1)
+        self.assertEqual(stores[0][0].getAddress(), 0x5000)
+        self.assertEqual(stores[0][0].getSize(), CPUSIZE.QWORD)
+        self.assertEqual(stores[0][0].getConcreteValue(), 0x41)
+        self.assertIsNone(stores[0][1])
+        self.assertTrue("rbx" in [r.getName() for r, _ in inst.getReadRegisters()])
+        self.assertTrue("rip" in [r.getName() for r, _ in inst.getWrittenRegisters()])
+
+        inst = Instruction("\x48\x8b\x08")  # mov rcx, qword ptr [rax]
+        processing(inst)
+        self.assertTrue(inst.isMemoryRead())
+        self.assertFalse(inst.isMemoryWrite())
+        self.assertEqual(inst.getLoadAccess()[0][0].getConcreteValue(), 0x41)
+        self.assertEqual(getConcreteRegisterValue(REG.RCX), 0x41)
+
+    def test_same_semantics(self):
+        """Check that the fast path and the full semantics compute the same registers and flags."""
+        # AF is undefined after and/or/xor/test, the fast path leaves it unchanged
+        code = [
+            ("\x48\x01\xd8", True),      # add rax, rbx
+            ("\x48\x29\xd8", True),      # sub rax, rbx
+            ("\x48\x39\xd8", True),      # cmp rax, rbx
+            ("\x48\xff\xc0", True),      # inc rax
+            ("\x48\xff\xc8", True),      # dec rax
+            ("\x48\x21\xd8", False),     # and rax, rbx
+            ("\x48\x09\xd8", False),     # or rax, rbx
+            ("\x48\x31\xd8", False),     # xor rax, rbx
+            ("\x48\x85\xd8", False),     # test rax, rbx
+            ("\x24\x0f",     False),     # and al, 0xf
+            ("\x0c\x0f",     False),     # or al, 0xf
+            ("\x34\x0f",     False),     # xor al, 0xf
+            ("\xa8\x0f",     False),     # test al, 0xf
+        ]
+        registers = [REG.RAX, REG.RBX, REG.AF, REG.CF, REG.OF, REG.PF, REG.SF, REG.ZF]
+        values = [(0x0f, 0x01), (0x7fffffffffffffff, 0xffffffffffffffff), (0x8000000000000000, 0x8000000000000001)]
+
+        def run(fast, opcodes, rax, rbx):
+            enableMode(MODE.CONCRETE_FAST_PATH, fast)
+            concretizeAllRegister()
+            setConcreteRegisterValue(Register(REG.RAX, rax))
+            setConcreteRegisterValue(Register(REG.RBX, rbx))
+            # Flags left unchanged by the semantics must not differ
+            for flag in registers[2:]:
+                setConcreteRegisterValue(Register(flag, 1))
+            inst = Instruction(opcodes)
+            processing(inst)
+            return [getConcreteRegisterValue(r) for r in registers], len(inst.getSymbolicExpressions())
+
+        for opcodes, af in code:
+            for rax, rbx in values:
+                fast, count = run(True, opcodes, rax, rbx)
+                self.assertEqual(count, 0)
+                full, count = run(False, opcodes, rax, rbx)
+                self.assertNotEqual(count, 0)
+                if not af:
+                    del fast[2], full[2]
+                self.assertEqual(fast, full, "%s with rax=%#x rbx=%#x" % (opcodes.encode("hex"), rax, rbx))
+
+    def test_symbolic(self):
+        """Check that symbolic inputs go through the full semantics."""
+        convertRegisterToSymbolicVariable(REG.RBX)
+        setConcreteRegisterValue(Register(REG.RSP, 0x7000))
+
+        inst = Instruction("\x48\x01\xd8")  # add rax, rbx
+        processing(inst)
+        self.assertNotEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertTrue(isRegisterSymbolized(REG.RAX))
+
+        inst = Instruction("\x53")  # push rbx
+        processing(inst)
+        self.assertTrue(isMemorySymbolized(MemoryAccess(0x6ff8, CPUSIZE.QWORD)))
+
+        # Overwriting a symbolic register with a concrete value concretizes it
+        inst = Instruction("\x48\xc7\xc0\x01\x00\x00\x00")  # mov rax, 1
+        processing(inst)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertFalse(isRegisterSymbolized(REG.RAX))
+
+    def test_tainted(self):
+        """Check that tainted inputs go through the full semantics."""
+        taintRegister(REG.RCX)
+
+        inst = Instruction("\x48\x89\xca")  # mov rdx, rcx
+        processing(inst)
+        self.assertNotEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertTrue(isRegisterTainted(REG.RDX))
+
+        # Overwriting a tainted register with an untainted value untaints it
+        inst = Instruction("\x48\x31\xc9")  # xor rcx, rcx
+        processing(inst)
+        self.assertTrue(isRegisterTainted(REG.RCX))
+
+        inst = Instruction("\x48\xc7\xc1\x01\x00\x00\x00")  # mov rcx, 1
+        processing(inst)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+        self.assertFalse(isRegisterTainted(REG.RCX))
@@ -7,7 +7,8 @@ import unittest
 from triton import (setArchitecture, ARCH, REG, getAllRegisters, getParentRegisters,
                     setConcreteRegisterValue, Register, getConcreteRegisterValue,
                     isMemoryMapped, setConcreteMemoryValue, getConcreteMemoryValue,
-                    unmapMemory, setConcreteMemoryAreaValue, getConcreteMemoryAreaValue)
+                    unmapMemory, setConcreteMemoryAreaValue, getConcreteMemoryAreaValue,
+                    MemoryAccess)
 
 
 class TestX86ConcreteRegisterValue(unittest.TestCase):
@@ -148,6 +149,26 @@ class TestX86ConcreteMemoryValue(unittest.TestCase):
         setConcreteMemoryAreaValue(0x1006, [0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc])
         self.assertEqual(getConcreteMemoryAreaValue(0x1000, 12), "\x11\x22\x33\x44\x55\x66\x77\x88\x99\xaa\xbb\xcc")
 
+    def test_memory_pages(self):
+        """Check that the memory is mapped per page."""
+        setConcreteMemoryValue(0x10000, 0x41)
+        self.assertTrue(isMemoryMapped(0x10fff))
+        self.assertFalse(isMemoryMapped(0x11000))
+        self.assertEqual(getConcreteMemoryValue(0x10fff), 0)
+
+        # Accesses across two pages
+        setConcreteMemoryAreaValue(0x10ffe, "\x11\x22\x33\x44")
+        self.assertTrue(isMemoryMapped(0x10000, 0x2000))
+        self.assertEqual(getConcreteMemoryAreaValue(0x10ffe, 4), "\x11\x22\x33\x44")
+        self.assertEqual(getConcreteMemoryValue(MemoryAccess(0x10ffe, 4)), 0x44332211)
+
+        unmapMemory(0x10010)
+        self.assertFalse(isMemoryMapped(0x10000))
+        self.assertTrue(isMemoryMapped(0x11000))
+        self.assertEqual(getConcreteMemoryValue(0x10000), 0)
+        self.assertEqual(getConcreteMemoryValue(0x11001), 0x44)
+
+
 class TestX8664ConcreteMemoryValue(unittest.TestCase):
 
     """Testing the X86 concrete value api."""
@@ -175,3 +196,17 @@ class TestX8664ConcreteMemoryValue(unittest.TestCase):
         setConcreteMemoryAreaValue(0x1000, "\x11\x22\x33\x44\x55\x66")
         setConcreteMemoryAreaValue(0x1006, [0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc])
         self.assertEqual(getConcreteMemoryAreaValue(0x1000, 12), "\x11\x22\x33\x44\x55\x66\x77\x88\x99\xaa\xbb\xcc")
+
+    def test_memory_wrap(self):
+        """Check the unmap of a range which wraps around the address space."""
+        setConcreteMemoryValue(0xffffffffffffffff, 0x41)
+        setConcreteMemoryValue(0, 0x42)
+        setConcreteMemoryValue(0x1000, 0x43)
+        setConcreteMemoryValue(0xffffffffffffd000, 0x44)
+
+        unmapMemory(0xfffffffffffffff0, 0x20)
+        self.assertFalse(isMemoryMapped(0xffffffffffffffff))
+        self.assertFalse(isMemoryMapped(0))
+        self.assertTrue(isMemoryMapped(0x1000))
+        self.assertTrue(isMemoryMapped(0xffffffffffffd000))
+        self.assertEqual(getConcreteMemoryValue(0x1000), 0x43)
@@ -0,0 +1,74 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the ELF parser."""
+
+import os
+import unittest
+
+from triton import Elf, LOADER
+
+
+TABLES = {
+    "sections":  lambda b: [(s.getName(), s.getType(), s.getFlags(), s.getAddr(), s.getOffset(), s.getSize(), s.getLink(), s.getInfo())
+                            for s in b.getSectionHeaders()],
+    "symbols":   lambda b: [(s.getName(), s.getInfo(), s.getOther(), s.getShndx(), s.getValue(), s.getSize())
+                            for s in b.getSymbolsTable()],
+    "relocs":    lambda b: [(r.getOffset(), r.getInfo(), r.getSymidx(), r.getType(), r.isAddend(), r.getAddend())
+                            for r in b.getRelocationTable()],
+    "dynamic":   lambda b: [(d.getTag(), d.getValue()) for d in b.getDynamicTable()],
+    "libraries": lambda b: b.getSharedLibraries(),
+}
+
+
+class TestElf(unittest.TestCase):
+
+    """Testing the ELF parser with both loaders."""
+
+    def setUp(self):
+        """Define the path of the binary."""
+        self.path = os.path.join(os.path.dirname(__file__), "misc", "ir-test-suite.bin")
+
+    def tables(self, binary):
+        """Returns all the tables of a binary."""
+        return dict((name, table(binary)) for name, table in TABLES.items())
+
+    def test_loaders(self):
+        """Check that both loaders parse the same binary."""
+        mapped = Elf(self.path)
+        read   = Elf(self.path, LOADER.READ)
+
+        self.assertTrue(mapped.isMapped())
+        self.assertFalse(read.isMapped())
+        self.assertTrue(Elf(self.path, LOADER.MMAP).isMapped())
+
+        self.assertEqual(mapped.getSize(), os.path.getsize(self.path))
+        self.assertEqual(mapped.getRaw(), read.getRaw())
+        self.assertEqual(mapped.getHeader().getEntry(), read.getHeader().getEntry())
+        self.assertEqual([p.getVaddr() for p in mapped.getProgramHeaders()], [p.getVaddr() for p in read.getProgramHeaders()])
+
+        tables = self.tables(mapped)
+        self.assertEqual(tables, self.tables(read))
+        self.assertNotEqual(len(tables["sections"]), 0)
+        self.assertNotEqual(len(tables["symbols"]), 0)
+        self.assertNotEqual(len(tables["relocs"]), 0)
+        self.assertIn("libc.so.6", tables["libraries"])
+
+    def test_lazy(self):
+        """Check that each table is the same whichever is requested first."""
+        expected = self.tables(Elf(self.path, LOADER.READ))
+
+        for mode in [LOADER.MMAP, LOADER.READ]:
+            for name, table in TABLES.items():
+                binary = Elf(self.path, mode)
+                self.assertEqual(table(binary), expected[name])
+                # The tables parsed on first access are kept
+                self.assertEqual(self.tables(binary), expected)
+                self.assertEqual(self.tables(binary), expected)
+
+    def test_invalid(self):
+        """Check the errors."""
+        for mode in [LOADER.MMAP, LOADER.READ]:
+            with self.assertRaises(TypeError):
+                Elf(os.path.join(os.path.dirname(__file__), "misc", "nonexistent.bin"), mode)
+        with self.assertRaises(TypeError):
+            Elf(self.path, "read")
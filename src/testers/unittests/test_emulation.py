@@ -0,0 +1,66 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the native emulation."""
+
+import unittest
+
+from triton import (setArchitecture, ARCH, REG, EMULATION, Register, emulate,
+                    setConcreteMemoryAreaValue, setConcreteRegisterValue, getConcreteRegisterValue)
+
+
+CODE = [
+    (0x1000, "\x48\xc7\xc0\x01\x00\x00\x00"),   # mov rax, 1
+    (0x1007, "\x48\x01\xd8"),                   # add rax, rbx
+    (0x100a, "\x48\xff\xc0"),                   # inc rax
+    (0x100d, "\x0f\x05"),                       # syscall
+    (0x100f, "\x0f\x0b"),                       # ud2
+]
+
+
+class TestEmulation(unittest.TestCase):
+
+    """Testing the native emulation loop."""
+
+    def setUp(self):
+        """Define the arch and load the code."""
+        setArchitecture(ARCH.X86_64)
+        for addr, opcodes in CODE:
+            setConcreteMemoryAreaValue(addr, opcodes)
+        setConcreteRegisterValue(Register(REG.RBX, 2))
+
+    def test_unmapped(self):
+        """Check that the emulation stops on unmapped code."""
+        self.assertEqual(emulate(0x400000), EMULATION.UNMAPPED)
+        self.assertEqual(getConcreteRegisterValue(REG.RIP), 0x400000)
+
+    def test_syscall(self):
+        """Check that the emulation stops after a syscall and before an unsupported instruction."""
+        self.assertEqual(emulate(0x1000), EMULATION.SYSCALL)
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 4)
+        self.assertEqual(getConcreteRegisterValue(REG.RIP), 0x100f)
+
+        self.assertEqual(emulate(0x100f), EMULATION.UNSUPPORTED)
+        self.assertEqual(getConcreteRegisterValue(REG.RIP), 0x100f)
+
+    def test_max_instructions(self):
+        """Check the limit of instructions."""
+        self.assertEqual(emulate(0x1000, [], 2), EMULATION.MAX_INSTRUCTIONS)
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 3)
+        self.assertEqual(getConcreteRegisterValue(REG.RIP), 0x100a)
+
+    def test_breakpoint(self):
+        """Check that the emulation stops on breakpoints and can be resumed."""
+        self.assertEqual(emulate(0x1000, [0x100a]), EMULATION.BREAKPOINT)
+        self.assertEqual(getConcreteRegisterValue(REG.RIP), 0x100a)
+        self.assertEqual(emulate(0x100a, [0x100a]), EMULATION.SYSCALL)
+
+    def test_hooks(self):
+        """Check that hooks can redirect and stop the emulation."""
+        def skip(addr):
+            setConcreteRegisterValue(Register(REG.RIP, 0x100a))
+
+        self.assertEqual(emulate(0x1000, [], 0, {0x1007: skip}), EMULATION.SYSCALL)
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 2)
+
+        self.assertEqual(emulate(0x1000, [], 0, {0x100a: lambda addr: False}), EMULATION.HOOK)
+        self.assertEqual(getConcreteRegisterValue(REG.RIP), 0x100a)
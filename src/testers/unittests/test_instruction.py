@@ -5,7 +5,9 @@
 import unittest
 
 from triton import (setArchitecture, ARCH, REG, Instruction, Register,
-                    processing, PREFIX, OPCODE, setConcreteRegisterValue)
+                    processing, PREFIX, OPCODE, setConcreteRegisterValue,
+                    disassembly, flushDisassemblyCache,
+                    getDisassemblyCacheStats)
 
 
 class TestInstruction(unittest.TestCase):
@@ -141,6 +143,52 @@ class TestLoadAccess(unittest.TestCase):
         self.assertEqual(inst.getOperands()[1].getBitSize(), 16)
 
 
+class TestDisassemblyCache(unittest.TestCase):
+
+    """Testing the disassembly cache."""
+
+    def setUp(self):
+        """Define the architecture and flush the cache."""
+        setArchitecture(ARCH.X86_64)
+        flushDisassemblyCache()
+
+    def test_hit(self):
+        """Check that the same instruction is decoded once."""
+        for _ in range(4):
+            inst = Instruction("\x48\x01\xd8")  # add rax, rbx
+            inst.setAddress(0x400000)
+            inst.updateContext(Register(REG.RAX, 0x1234))
+            disassembly(inst)
+            self.assertEqual(inst.getDisassembly(), "add rax, rbx")
+            self.assertEqual(inst.getType(), OPCODE.ADD)
+            self.assertEqual(inst.getOperands()[0].getConcreteValue(), 0x1234)
+        stats = getDisassemblyCacheStats()
+        self.assertEqual(stats["entries"], 1)
+        self.assertEqual(stats["misses"], 1)
+        self.assertEqual(stats["hits"], 3)
+        self.assertEqual(stats["hitRate"], 75)
+
+    def test_self_modifying(self):
+        """Check that new opcodes at the same address are decoded again."""
+        inst = Instruction("\x48\x01\xd8")  # add rax, rbx
+        inst.setAddress(0x400000)
+        disassembly(inst)
+        inst = Instruction("\x48\x31\xd8")  # xor rax, rbx
+        inst.setAddress(0x400000)
+        disassembly(inst)
+        self.assertEqual(inst.getType(), OPCODE.XOR)
+        self.assertEqual(getDisassemblyCacheStats()["hits"], 0)
+
+    def test_flush(self):
+        """Check that the cache is empty after a flush."""
+        disassembly(Instruction("\x90"))
+        flushDisassemblyCache()
+        stats = getDisassemblyCacheStats()
+        self.assertEqual(stats["entries"], 0)
+        self.assertEqual(stats["hits"], 0)
+        self.assertEqual(stats["misses"], 0)
+
+
 class TestProcessing(unittest.TestCase):
 
     """Test processing for some error prone instruction."""
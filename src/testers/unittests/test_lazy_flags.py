@@ -0,0 +1,96 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the lazy flags."""
+
+import unittest
+
+from triton import (setArchitecture, ARCH, REG, MODE, Register, Instruction,
+                    enableMode, isModeEnabled, processing, setConcreteRegisterValue,
+                    getConcreteRegisterValue, convertRegisterToSymbolicVariable,
+                    isRegisterSymbolized, getSymbolicRegisterId, getFullAstFromId,
+                    getSymbolicExpressionFromId, getPathConstraints, takeSnapshot,
+                    restoreSnapshot, removeSymbolicExpression)
+
+
+class TestLazyFlags(unittest.TestCase):
+
+    """Testing the deferred symbolic expressions of the flags."""
+
+    def setUp(self):
+        """Define the arch and enable the mode."""
+        setArchitecture(ARCH.X86_64)
+        enableMode(MODE.LAZY_FLAGS, True)
+
+    def tearDown(self):
+        """Disable the mode."""
+        enableMode(MODE.LAZY_FLAGS, False)
+
+    def test_mode(self):
+        """Check the mode."""
+        self.assertTrue(isModeEnabled(MODE.LAZY_FLAGS))
+        enableMode(MODE.LAZY_FLAGS, False)
+        self.assertFalse(isModeEnabled(MODE.LAZY_FLAGS))
+
+    def test_deferred(self):
+        """Check that the flags are only built when they are read."""
+        setConcreteRegisterValue(Register(REG.RAX, 0xffffffffffffffff))
+        convertRegisterToSymbolicVariable(REG.RAX)
+
+        inst = Instruction("\x48\x83\xc0\x01")  # add rax, 1
+        processing(inst)
+        self.assertEqual(len(inst.getSymbolicExpressions()), 2)  # rax and rip
+        self.assertEqual(getConcreteRegisterValue(REG.ZF), 1)
+        self.assertEqual(getConcreteRegisterValue(REG.CF), 1)
+        self.assertEqual(getConcreteRegisterValue(REG.OF), 0)
+        self.assertTrue(isRegisterSymbolized(REG.ZF))
+
+        # The expression is built once queried
+        zfId = getSymbolicRegisterId(REG.ZF)
+        self.assertEqual(getSymbolicExpressionFromId(zfId).getComment(), "Zero flag")
+        self.assertEqual(getFullAstFromId(zfId).evaluate(), 1)
+        self.assertEqual(getSymbolicRegisterId(REG.ZF), zfId)
+
+    def test_read_by_instruction(self):
+        """Check that instructions reading the flags get their expressions."""
+        convertRegisterToSymbolicVariable(REG.AL)
+
+        inst = Instruction("\x3c\x41")  # cmp al, 0x41
+        inst.setAddress(0x1000)
+        processing(inst)
+        inst = Instruction("\x75\x00")  # jne 0x1004
+        inst.setAddress(0x1002)
+        processing(inst)
+        self.assertEqual(len(getPathConstraints()), 1)
+        self.assertTrue(getPathConstraints()[0].isMultipleBranches())
+
+    def test_removed_reference(self):
+        """Check that the flags referring to a removed expression are dropped."""
+        convertRegisterToSymbolicVariable(REG.RAX)
+        convertRegisterToSymbolicVariable(REG.RBX)
+        rbxId = getSymbolicRegisterId(REG.RBX)
+
+        inst = Instruction("\x48\x01\xd8")  # add rax, rbx
+        processing(inst)
+        self.assertTrue(isRegisterSymbolized(REG.CF))
+        self.assertTrue(isRegisterSymbolized(REG.ZF))
+
+        # CF is built over rbx, ZF only over the result
+        removeSymbolicExpression(rbxId)
+        self.assertFalse(isRegisterSymbolized(REG.RBX))
+        self.assertFalse(isRegisterSymbolized(REG.CF))
+        self.assertTrue(isRegisterSymbolized(REG.ZF))
+        self.assertEqual(getSymbolicExpressionFromId(getSymbolicRegisterId(REG.ZF)).getComment(), "Zero flag")
+
+    def test_snapshot(self):
+        """Check that the deferred flags are restored."""
+        convertRegisterToSymbolicVariable(REG.RAX)
+        inst = Instruction("\x48\x85\xc0")  # test rax, rax
+        processing(inst)
+        takeSnapshot()
+
+        inst = Instruction("\x48\x85\xdb")  # test rbx, rbx
+        processing(inst)
+        self.assertFalse(isRegisterSymbolized(REG.ZF))
+
+        restoreSnapshot()
+        self.assertTrue(isRegisterSymbolized(REG.ZF))
@@ -0,0 +1,95 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the loading of binaries into the concrete memory."""
+
+import os
+import unittest
+
+from triton import (setArchitecture, ARCH, ELF, Elf, loadBinary, resetEngines,
+                    setConcreteMemoryAreaValue, getConcreteMemoryAreaValue,
+                    setConcreteMemoryValue, getConcreteMemoryValue, isMemoryMapped,
+                    unmapMemory, takeSnapshot, restoreSnapshot, discardSnapshot)
+
+
+class TestLoadBinary(unittest.TestCase):
+
+    """Testing the copy-on-write pages backed by a binary file."""
+
+    def setUp(self):
+        """Define the arch and open the binary."""
+        setArchitecture(ARCH.X86_64)
+        self.binary = Elf(os.path.join(os.path.dirname(__file__), "misc", "ir-test-suite.bin"))
+        self.segments = [p for p in self.binary.getProgramHeaders() if p.getType() == ELF.PT_LOAD]
+
+    def tearDown(self):
+        """Discard the snapshot."""
+        discardSnapshot()
+
+    def test_content(self):
+        """Check that the memory is the same as with setConcreteMemoryAreaValue."""
+        raw = self.binary.getRaw()
+        expected = list()
+        for phdr in self.segments:
+            setConcreteMemoryAreaValue(phdr.getVaddr(), raw[phdr.getOffset():phdr.getOffset() + phdr.getFilesz()])
+        for phdr in self.segments:
+            expected.append(getConcreteMemoryAreaValue(phdr.getVaddr(), phdr.getMemsz()))
+
+        resetEngines()
+        loadBinary(self.binary)
+        for phdr, content in zip(self.segments, expected):
+            self.assertTrue(isMemoryMapped(phdr.getVaddr(), phdr.getMemsz()))
+            self.assertEqual(getConcreteMemoryAreaValue(phdr.getVaddr(), phdr.getMemsz()), content)
+
+    def test_bss(self):
+        """Check that the zero-filled part of the segments is mapped."""
+        loadBinary(self.binary)
+        for phdr in self.segments:
+            size = phdr.getMemsz() - phdr.getFilesz()
+            if size:
+                addr = phdr.getVaddr() + phdr.getFilesz()
+                self.assertTrue(isMemoryMapped(addr, size))
+                self.assertEqual(getConcreteMemoryAreaValue(addr, size), "\x00" * size)
+
+    def test_copy_on_write(self):
+        """Check that the writes do not modify the file and are restored by snapshots."""
+        phdr = self.segments[0]
+        addr = phdr.getVaddr() + 0x1000
+        loadBinary(self.binary)
+        original = getConcreteMemoryValue(addr)
+
+        takeSnapshot()
+        setConcreteMemoryValue(addr, original ^ 0xff)
+        self.assertEqual(getConcreteMemoryValue(addr), original ^ 0xff)
+        self.assertEqual(ord(self.binary.getRaw()[phdr.getOffset() + 0x1000]), original)
+
+        restoreSnapshot()
+        self.assertEqual(getConcreteMemoryValue(addr), original)
+
+        # The pages are kept even if the binary is destroyed
+        del self.binary
+        self.assertEqual(getConcreteMemoryValue(addr), original)
+
+        unmapMemory(addr)
+        self.assertFalse(isMemoryMapped(addr))
+
+    @unittest.skipUnless(os.path.exists("/proc/self/maps"), "requires /proc/self/maps")
+    def test_release(self):
+        """Check that the file is released once no page shares it."""
+        def mappings():
+            with open("/proc/self/maps") as f:
+                return [l for l in f if l.rstrip().endswith(os.path.basename(self.binary.getPath()))]
+
+        resetEngines()
+        unloaded = len(mappings())
+
+        loadBinary(self.binary)
+        self.assertEqual(len(mappings()), unloaded + 1)
+
+        # The snapshot keeps the unmapped pages
+        takeSnapshot()
+        for phdr in self.segments:
+            unmapMemory(phdr.getVaddr(), phdr.getMemsz())
+        self.assertEqual(len(mappings()), unloaded + 1)
+
+        discardSnapshot()
+        self.assertEqual(len(mappings()), unloaded)
@@ -0,0 +1,116 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test snapshots."""
+
+import unittest
+
+from triton import (setArchitecture, ARCH, REG, Register, Instruction, MemoryAccess, CPUSIZE,
+                    takeSnapshot, restoreSnapshot, discardSnapshot, isSnapshotEnabled,
+                    setConcreteMemoryValue, getConcreteMemoryValue, setConcreteMemoryAreaValue,
+                    getConcreteMemoryAreaValue, setConcreteRegisterValue, getConcreteRegisterValue,
+                    isMemoryMapped, unmapMemory, taintMemory, taintRegister, untaintMemory,
+                    isMemoryTainted, isRegisterTainted, convertRegisterToSymbolicVariable,
+                    convertMemoryToSymbolicVariable, getSymbolicRegisterId, getSymbolicMemoryId,
+                    isSymbolicExpressionIdExists, getSymbolicExpressions, processing,
+                    getPathConstraints, clearPathConstraints)
+
+
+class TestSnapshot(unittest.TestCase):
+
+    """Testing the snapshot of the concrete, taint and symbolic states."""
+
+    def setUp(self):
+        """Define the arch."""
+        setArchitecture(ARCH.X86_64)
+
+    def test_no_snapshot(self):
+        """Check that a snapshot must be taken before being restored."""
+        self.assertFalse(isSnapshotEnabled())
+        with self.assertRaises(TypeError):
+            restoreSnapshot()
+
+    def test_concrete_state(self):
+        """Check that the registers and the memory are restored."""
+        setConcreteMemoryAreaValue(0x1000, [0x11] * 0x2000)
+        setConcreteRegisterValue(Register(REG.RAX, 0x1234))
+        takeSnapshot()
+        self.assertTrue(isSnapshotEnabled())
+
+        for _ in range(2):
+            setConcreteMemoryValue(0x1800, 0x22)
+            setConcreteMemoryAreaValue(0x10000, [0x33] * 0x10)
+            unmapMemory(0x2000)
+            setConcreteRegisterValue(Register(REG.RAX, 0x5678))
+            setConcreteRegisterValue(Register(REG.ZF, 1))
+
+            restoreSnapshot()
+
+            self.assertEqual(getConcreteMemoryAreaValue(0x1000, 0x2000), "\x11" * 0x2000)
+            self.assertFalse(isMemoryMapped(0x10000))
+            self.assertTrue(isMemoryMapped(0x2000))
+            self.assertEqual(getConcreteRegisterValue(REG.RAX), 0x1234)
+            self.assertEqual(getConcreteRegisterValue(REG.ZF), 0)
+
+        discardSnapshot()
+        self.assertFalse(isSnapshotEnabled())
+
+        # Without snapshot, writes are kept
+        setConcreteMemoryValue(0x1800, 0x22)
+        self.assertEqual(getConcreteMemoryValue(0x1800), 0x22)
+
+    def test_taint_state(self):
+        """Check that the taint state is restored."""
+        taintMemory(MemoryAccess(0x1000, CPUSIZE.QWORD))
+        takeSnapshot()
+
+        untaintMemory(0x1000)
+        taintMemory(MemoryAccess(0x5000, CPUSIZE.DWORD))
+        taintRegister(REG.RBX)
+
+        restoreSnapshot()
+
+        self.assertTrue(isMemoryTainted(0x1000))
+        self.assertFalse(isMemoryTainted(MemoryAccess(0x5000, CPUSIZE.DWORD)))
+        self.assertFalse(isRegisterTainted(REG.RBX))
+
+    def test_symbolic_state(self):
+        """Check that the symbolic registers and memory are restored."""
+        convertRegisterToSymbolicVariable(REG.RAX)
+        raxId = getSymbolicRegisterId(REG.RAX)
+        takeSnapshot()
+
+        convertRegisterToSymbolicVariable(REG.RAX)
+        convertMemoryToSymbolicVariable(MemoryAccess(0x1000, CPUSIZE.BYTE))
+        newId = getSymbolicMemoryId(0x1000)
+        self.assertTrue(isSymbolicExpressionIdExists(newId))
+
+        restoreSnapshot()
+
+        self.assertEqual(getSymbolicRegisterId(REG.RAX), raxId)
+        self.assertEqual(getSymbolicMemoryId(0x1000), -1 & 0xffffffffffffffff)
+        self.assertFalse(isSymbolicExpressionIdExists(newId))
+        self.assertTrue(isSymbolicExpressionIdExists(raxId))
+
+    def test_path_constraints(self):
+        """Check that the path constraints are restored."""
+        convertRegisterToSymbolicVariable(REG.AL)
+
+        inst = Instruction("\x3c\x41")  # cmp al, 0x41
+        inst.setAddress(0x1000)
+        processing(inst)
+        inst = Instruction("\x75\x00")  # jne 0x1004
+        inst.setAddress(0x1002)
+        processing(inst)
+
+        takeSnapshot()
+        inst = Instruction("\x75\x00")  # jne 0x1006
+        inst.setAddress(0x1004)
+        processing(inst)
+        self.assertEqual(len(getPathConstraints()), 2)
+
+        restoreSnapshot()
+        self.assertEqual(len(getPathConstraints()), 1)
+
+        clearPathConstraints()
+        restoreSnapshot()
+        self.assertEqual(len(getPathConstraints()), 1)
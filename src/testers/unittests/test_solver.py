@@ -0,0 +1,209 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test Solver."""
+
+import unittest
+from triton     import *
+from triton.ast import *
+
+
+class TestSolverSession(unittest.TestCase):
+
+    """Testing the incremental solver session."""
+
+    def setUp(self):
+        """Define the arch and variables."""
+        setArchitecture(ARCH.X86_64)
+        self.x = variable(newSymbolicVariable(8))
+        self.y = variable(newSymbolicVariable(8))
+
+    def test_scopes(self):
+        """Check constraints only live in their scope."""
+        self.assertEqual(getNumberOfSolverScopes(), 0)
+        self.assertTrue(isSat(equal(self.x, bv(1, 8))))
+
+        pushSolverScope()
+        addSolverConstraint(bvugt(self.x, bv(10, 8)))
+        self.assertEqual(getNumberOfSolverScopes(), 1)
+        self.assertFalse(isSat(equal(self.x, bv(1, 8))))
+        self.assertTrue(isSat(equal(self.x, bv(11, 8))))
+
+        pushSolverScope()
+        addSolverConstraint(bvult(self.x, bv(12, 8)))
+        model = getModel(assert_(equal(self.y, self.x)))
+        self.assertEqual(model[0].getValue(), 11)
+        self.assertEqual(model[1].getValue(), 11)
+        popSolverScope()
+
+        self.assertTrue(isSat(equal(self.x, bv(200, 8))))
+        popSolverScope()
+
+        self.assertEqual(getNumberOfSolverScopes(), 0)
+        self.assertTrue(isSat(equal(self.x, bv(1, 8))))
+        self.assertRaises(TypeError, popSolverScope)
+
+    def test_models(self):
+        """Check several models on top of the session constraints."""
+        pushSolverScope()
+        addSolverConstraint(bvult(self.x, bv(4, 8)))
+        models = getModels(assert_(equal(self.y, bv(0, 8))), 10)
+        self.assertEqual(len(models), 4)
+        self.assertEqual(sorted(m[0].getValue() for m in models), [0, 1, 2, 3])
+        self.assertTrue(isSat())
+        resetSolverSession()
+        self.assertEqual(getNumberOfSolverScopes(), 0)
+        self.assertEqual(len(getModels(assert_(equal(self.y, self.x)), 300)), 256)
+
+    def test_not_logical(self):
+        """Check constraints must be logical nodes."""
+        self.assertRaises(TypeError, addSolverConstraint, bvadd(self.x, self.y))
+
+
+class TestSolverPartition(unittest.TestCase):
+
+    """Testing the split of queries into independent clusters."""
+
+    def setUp(self):
+        """Define the arch and variables."""
+        setArchitecture(ARCH.X86_64)
+        self.vars = [variable(newSymbolicVariable(8)) for _ in range(4)]
+
+    def test_independent(self):
+        """Check each cluster is solved and the models are merged."""
+        a, b, c, d = self.vars
+        pc = land(land(land(equal(bvtrue(), bvtrue()), equal(a, bv(1, 8))), equal(bvadd(b, c), bv(10, 8))), bvugt(c, bv(8, 8)))
+        model = getModel(assert_(land(pc, equal(d, bv(4, 8)))))
+        self.assertEqual(len(model), 4)
+        self.assertEqual(model[0].getValue(), 1)
+        self.assertEqual((model[1].getValue() + model[2].getValue()) & 0xff, 10)
+        self.assertTrue(model[2].getValue() > 8)
+        self.assertEqual(model[3].getValue(), 4)
+
+        # The same path with another branch
+        model = getModel(assert_(land(pc, equal(d, bv(5, 8)))))
+        self.assertEqual(model[0].getValue(), 1)
+        self.assertEqual(model[3].getValue(), 5)
+
+    def test_unsat(self):
+        """Check an unsat cluster makes the whole query unsat."""
+        a, b, c, d = self.vars
+        node = assert_(land(equal(a, bv(1, 8)), land(equal(b, bv(1, 8)), equal(b, bv(2, 8)))))
+        self.assertEqual(len(getModel(node)), 0)
+        self.assertFalse(isSat(node))
+        self.assertFalse(isSat(land(equal(a, bv(1, 8)), equal(bvfalse(), bvtrue()))))
+        self.assertTrue(isSat(land(equal(a, bv(1, 8)), equal(c, d))))
+
+
+class TestSolverCache(unittest.TestCase):
+
+    """Testing the cache of solver queries."""
+
+    def setUp(self):
+        """Define the arch and variables."""
+        setArchitecture(ARCH.X86_64)
+        flushSolverCache()
+        self.x = variable(newSymbolicVariable(8))
+        self.y = variable(newSymbolicVariable(8))
+
+    def test_same_query(self):
+        """Check a query built twice is solved once."""
+        model = getModel(assert_(equal(bvadd(self.x, self.y), bv(10, 8))))
+        self.assertEqual((model[0].getValue() + model[1].getValue()) & 0xff, 10)
+        self.assertEqual(getSolverCacheStats()['misses'], 1)
+
+        # Same formula, other nodes and operands swapped
+        model = getModel(assert_(equal(bv(10, 8), bvadd(self.y, self.x))))
+        self.assertEqual((model[0].getValue() + model[1].getValue()) & 0xff, 10)
+        self.assertEqual(getSolverCacheStats()['hits'], 1)
+        self.assertEqual(getSolverCacheStats()['misses'], 1)
+
+        # Unsat results are cached too
+        self.assertFalse(isSat(land(equal(self.x, bv(1, 8)), equal(self.x, bv(2, 8)))))
+        self.assertFalse(isSat(land(equal(self.x, bv(1, 8)), equal(self.x, bv(2, 8)))))
+        self.assertEqual(getSolverCacheStats()['hits'], 2)
+
+    def test_unsat_model(self):
+        """Check a query without model is solved once."""
+        query = assert_(land(equal(self.x, bv(1, 8)), equal(self.x, bv(2, 8))))
+        self.assertEqual(getModel(query), {})
+        self.assertEqual(getModel(query), {})
+        self.assertFalse(isSat(query))
+        self.assertEqual(getSolverCacheStats()['hits'], 2)
+        self.assertEqual(getSolverCacheStats()['misses'], 1)
+
+    def test_collision(self):
+        """Check a result without model is not returned for another query of the same hash."""
+        # The structural hashes of these queries collide
+        self.assertFalse(isSat(equal(zx(120, self.x), bv(2**64, 128))))
+        self.assertTrue(isSat(equal(zx(120, self.x), bv(1, 128))))
+        self.assertEqual(getSolverCacheStats()['hits'], 0)
+        self.assertEqual(getSolverCacheStats()['misses'], 2)
+
+        # The same query is still answered by the cache
+        self.assertTrue(isSat(equal(bv(1, 128), zx(120, self.x))))
+        self.assertEqual(getSolverCacheStats()['hits'], 1)
+
+    def test_counterexample(self):
+        """Check a recent model is reused if it satisfies the query."""
+        model = getModel(assert_(equal(self.x, bv(42, 8))))
+        self.assertEqual(model[0].getValue(), 42)
+
+        model = getModel(assert_(bvugt(self.x, bv(40, 8))))
+        self.assertEqual(model[0].getValue(), 42)
+        self.assertEqual(getSolverCacheStats()['counterexampleHits'], 1)
+
+        # The model does not satisfy this one
+        model = getModel(assert_(bvult(self.x, bv(40, 8))))
+        self.assertTrue(model[0].getValue() < 40)
+        self.assertEqual(getSolverCacheStats()['misses'], 2)
+
+        flushSolverCache()
+        self.assertEqual(getSolverCacheStats()['entries'], 0)
+
+
+class TestNegatedBranches(unittest.TestCase):
+
+    """Testing the models of the negated branches of a path."""
+
+    def setUp(self):
+        """Process two conditional jumps on symbolic registers."""
+        setArchitecture(ARCH.X86_64)
+        flushSolverCache()
+        self.al = convertRegisterToSymbolicVariable(REG.AL)
+        self.bl = convertRegisterToSymbolicVariable(REG.BL)
+        code = [
+            (0x1000, "\x3c\x41"),       # cmp al, 0x41
+            (0x1002, "\x75\x0c"),       # jne 0x1010
+            (0x1004, "\x80\xfb\x42"),   # cmp bl, 0x42
+            (0x1007, "\x74\x17"),       # je  0x1020
+            (0x1009, "\x74\x00"),       # je  0x100b
+        ]
+        for addr, opcodes in code:
+            inst = Instruction()
+            inst.setOpcodes(opcodes)
+            inst.setAddress(addr)
+            processing(inst)
+
+    def test_all_branches(self):
+        """Check each multiple branch is negated in order."""
+        models = getNegatedBranchModels()
+        self.assertEqual(len(models), 2)
+        self.assertEqual(models[0][self.al.getId()].getValue(), 0x41)
+        self.assertEqual(models[1][self.bl.getId()].getValue(), 0x42)
+        self.assertNotEqual(models[1][self.al.getId()].getValue(), 0x41)
+
+    def test_subset(self):
+        """Check a subset of branches with several threads and a timeout."""
+        models = getNegatedBranchModels([1, 0], 2, 1000)
+        self.assertEqual(len(models), 2)
+        self.assertEqual(models[0][self.bl.getId()].getValue(), 0x42)
+        self.assertEqual(models[1][self.al.getId()].getValue(), 0x41)
+        self.assertRaises(TypeError, getNegatedBranchModels, [3])
+
+    def test_all_taken(self):
+        """Check that a jump to the next instruction has no branch to negate."""
+        pc = getPathConstraints()[2]
+        self.assertTrue(pc.isMultipleBranches())
+        self.assertTrue(all(b['isTaken'] for b in pc.getBranchConstraints()))
+        self.assertEqual(len(getNegatedBranchModels()), 2)
+        self.assertRaises(TypeError, getNegatedBranchModels, [2])
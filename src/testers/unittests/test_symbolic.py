@@ -11,7 +11,8 @@ from triton import (setArchitecture, ARCH, processing, REG, Instruction,
                     getSymbolicExpressionFromId, getSymbolicMemoryId,
                     getSymbolicMemoryValue, assignSymbolicExpressionToMemory,
                     assignSymbolicExpressionToRegister, buildSymbolicImmediate,
-                    buildSymbolicRegister, Immediate)
+                    buildSymbolicRegister, Immediate, getFullAst,
+                    newSymbolicVariable)
 
 
 class TestSymbolic(unittest.TestCase):
@@ -132,3 +133,25 @@ class TestSymbolicBuilding(unittest.TestCase):
         node = buildSymbolicRegister(REG.AL)
         self.assertEqual(node.evaluate(), 0x88)
         self.assertEqual(node.getBitvectorSize(), CPUSIZE.BYTE_BIT)
+
+    def test_full_ast(self):
+        """Check the full AST does not modify the partial one."""
+        var   = ast.variable(newSymbolicVariable(8))
+        expr1 = newSymbolicExpression(ast.bvadd(var, ast.bv(1, 8)))
+        expr2 = newSymbolicExpression(ast.bvmul(ast.reference(expr1.getId()), ast.bv(2, 8)))
+        expr3 = newSymbolicExpression(ast.bvsub(ast.reference(expr2.getId()), ast.reference(expr1.getId())))
+
+        full = getFullAst(expr3.getAst())
+        self.assertEqual(str(full), "(bvsub (bvmul (bvadd SymVar_0 (_ bv1 8)) (_ bv2 8)) (bvadd SymVar_0 (_ bv1 8)))")
+        self.assertEqual(str(expr3.getAst()), "(bvsub ref!%d ref!%d)" % (expr2.getId(), expr1.getId()))
+        self.assertEqual(str(expr2.getAst()), "(bvmul ref!%d (_ bv2 8))" % (expr1.getId()))
+        self.assertEqual(full.evaluate(), expr3.getAst().evaluate())
+
+        # A reference is replaced as well
+        self.assertEqual(str(getFullAst(ast.reference(expr2.getId()))), "(bvmul (bvadd SymVar_0 (_ bv1 8)) (_ bv2 8))")
+
+        # A long chain of references does not overflow the stack
+        expr = expr1
+        for i in range(20000):
+            expr = newSymbolicExpression(ast.bvadd(ast.reference(expr.getId()), ast.bv(1, 8)))
+        self.assertEqual(getFullAst(expr.getAst()).evaluate(), 20001 % 256)
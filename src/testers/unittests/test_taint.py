@@ -13,7 +13,11 @@ from triton import (setArchitecture, ARCH, REG, taintRegister, processing,
                     taintUnionMemoryImmediate, taintUnionMemoryMemory,
                     taintUnionMemoryRegister, taintUnionRegisterImmediate,
                     taintUnionRegisterMemory, taintUnionRegisterRegister,
-                    getTaintedRegisters, getTaintedMemory)
+                    getTaintedRegisters, getTaintedMemory, enableSymbolicEngine,
+                    getSymbolicExpressions, getPathConstraints,
+                    getConcreteRegisterValue, taintMemoryArea,
+                    untaintMemoryArea, getTaintedMemoryRanges,
+                    setConcreteRegisterValue, Register)
 
 
 class TestTaint(unittest.TestCase):
@@ -421,3 +425,106 @@ class TestTaint(unittest.TestCase):
         self.assertTrue(0x4003 in m)
         self.assertFalse(0x5000 in m)
 
+    def test_taint_memory_area(self):
+        """Check tainting large memory areas."""
+        setArchitecture(ARCH.X86_64)
+
+        self.assertTrue(taintMemoryArea(0x10000, 0x10000))
+        self.assertTrue(isMemoryTainted(0x10000))
+        self.assertTrue(isMemoryTainted(0x1ffff))
+        self.assertFalse(isMemoryTainted(0xffff))
+        self.assertFalse(isMemoryTainted(0x20000))
+        self.assertTrue(isMemoryTainted(MemoryAccess(0xfff0, 32)))
+        self.assertEqual(getTaintedMemoryRanges(), {0x10000: 0x10000})
+
+        self.assertFalse(untaintMemoryArea(0x10ff8, 0x10))
+        self.assertFalse(isMemoryTainted(MemoryAccess(0x10ff8, 16)))
+        self.assertTrue(isMemoryTainted(MemoryAccess(0x10ff8, 32)))
+        self.assertEqual(getTaintedMemoryRanges(), {0x10000: 0xff8, 0x11008: 0xeff8})
+        self.assertEqual(getTaintedMemoryRanges(0x10ff0, 0x20), {0x10ff0: 8, 0x11008: 8})
+
+        untaintMemoryArea(0x10000, 0x10000)
+        self.assertEqual(getTaintedMemoryRanges(), {})
+        self.assertEqual(len(getTaintedMemory()), 0)
+
+    def test_taint_memory_wrap(self):
+        """Check memory areas which wrap around the address space."""
+        setArchitecture(ARCH.X86_64)
+
+        taintMemoryArea(0xfffffffffffffff8, 0x10)
+        self.assertTrue(isMemoryTainted(0xffffffffffffffff))
+        self.assertTrue(isMemoryTainted(0x7))
+        self.assertFalse(isMemoryTainted(0x8))
+        self.assertTrue(isMemoryTainted(MemoryAccess(0xfffffffffffffffc, 8)))
+        self.assertEqual(getTaintedMemoryRanges(0xfffffffffffffffc, 0x8), {0xfffffffffffffffc: 4, 0: 4})
+
+        untaintMemoryArea(0xfffffffffffffffc, 0x8)
+        self.assertFalse(isMemoryTainted(MemoryAccess(0xfffffffffffffffc, 8)))
+        self.assertEqual(getTaintedMemoryRanges(), {0x4: 4, 0xfffffffffffffff8: 4})
+
+        untaintMemoryArea(0xfffffffffffffff8, 0x10)
+        self.assertEqual(getTaintedMemoryRanges(), {})
+
+    def test_taint_only(self):
+        """Check the taint spreading when the symbolic engine is disabled."""
+        setArchitecture(ARCH.X86_64)
+        enableSymbolicEngine(False)
+
+        taintRegister(REG.RAX)
+        code = [
+            "\x48\xc7\xc4\x00\x10\x00\x00",  # mov rsp, 0x1000
+            "\x48\x89\xc3",                      # mov rbx, rax
+            "\x48\x83\xc3\x01",                  # add rbx, 1
+            "\x53",                               # push rbx
+            "\x59",                               # pop rcx
+            "\x48\xc7\xc0\x00\x00\x00\x00",  # mov rax, 0
+            "\x48\x85\xc9",                      # test rcx, rcx
+            "\x74\x00",                           # je +0
+        ]
+        for opcodes in code:
+            processing(Instruction(opcodes))
+
+        self.assertTrue(isRegisterTainted(REG.RBX))
+        self.assertTrue(isRegisterTainted(REG.RCX))
+        self.assertTrue(isRegisterTainted(REG.ZF))
+        self.assertTrue(isMemoryTainted(MemoryAccess(0xff8, 8)))
+        self.assertFalse(isRegisterTainted(REG.RAX))
+
+        # The concrete state is still computed
+        self.assertEqual(getConcreteRegisterValue(REG.RSP), 0x1000)
+        self.assertEqual(getConcreteRegisterValue(REG.RCX), 1)
+
+        # The symbolic state is untouched
+        self.assertEqual(len(getSymbolicExpressions()), 0)
+        self.assertEqual(len(getPathConstraints()), 0)
+
+    def test_taint_only_native(self):
+        """Check that the instructions handled natively do not build any AST when the symbolic engine is disabled."""
+        setArchitecture(ARCH.X86_64)
+        enableSymbolicEngine(False)
+        setConcreteRegisterValue(Register(REG.RAX, 1))
+        setConcreteRegisterValue(Register(REG.RBX, 2))
+        taintRegister(REG.RBX)
+
+        inst = Instruction("\x48\x01\xd8")    # add rax, rbx
+        processing(inst)
+        self.assertTrue(inst.isTainted())
+        self.assertTrue(isRegisterTainted(REG.RAX))
+        self.assertTrue(isRegisterTainted(REG.CF))
+        self.assertFalse(isRegisterTainted(REG.RIP))
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 3)
+        for _, ast in inst.getReadRegisters() + inst.getWrittenRegisters():
+            self.assertIsNone(ast)
+
+        inst = Instruction("\x48\x85\xc9")    # test rcx, rcx
+        processing(inst)
+        self.assertFalse(inst.isTainted())
+        self.assertFalse(isRegisterTainted(REG.ZF))
+
+        # Not handled natively, the full semantics are the fallback
+        inst = Instruction("\x48\xf7\xdb")    # neg rbx
+        processing(inst)
+        self.assertTrue(inst.isTainted())
+        self.assertTrue(isRegisterTainted(REG.RBX))
+        self.assertEqual(getConcreteRegisterValue(REG.RBX), 0xfffffffffffffffe)
+        self.assertEqual(len(getSymbolicExpressions()), 0)
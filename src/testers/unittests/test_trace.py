@@ -0,0 +1,115 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the binary trace format."""
+
+import os
+import tempfile
+import unittest
+
+from triton import (setArchitecture, ARCH, REG, Register, Instruction, MemoryAccess, CPUSIZE, processing,
+                    resetEngines, writeTrace, replayTrace, getConcreteRegisterValue, getConcreteMemoryValue,
+                    setConcreteMemoryValue)
+
+
+class TestTrace(unittest.TestCase):
+
+    """Testing the record and the replay of binary traces."""
+
+    def setUp(self):
+        """Define the arch and the trace file."""
+        setArchitecture(ARCH.X86_64)
+        fd, self.path = tempfile.mkstemp(suffix=".trace")
+        os.close(fd)
+
+    def tearDown(self):
+        """Remove the trace file."""
+        os.remove(self.path)
+
+    def test_empty_trace(self):
+        """Check that an empty trace replays nothing."""
+        writeTrace(self.path, [])
+        self.assertEqual(replayTrace(self.path), 0)
+
+    def test_invalid_trace(self):
+        """Check that invalid traces are rejected."""
+        with open(self.path, "wb") as f:
+            f.write("\x00" * 16)
+        with self.assertRaises(TypeError):
+            replayTrace(self.path)
+
+        with self.assertRaises(TypeError):
+            replayTrace(self.path + ".missing")
+
+    def test_replay(self):
+        """Check that the concrete context is replayed and the hooks are called."""
+        trace = [
+            ("\x48\x8b\x03", 0x1000),   # mov rax, qword ptr [rbx]
+            ("\x48\xff\xc0", 0x1003),   # inc rax
+            ("\x48\x01\xc3", 0x1006),   # add rbx, rax
+        ]
+        instructions = list()
+        for opcodes, addr in trace:
+            inst = Instruction(opcodes)
+            inst.setAddress(addr)
+            inst.updateContext(Register(REG.RBX, 0x5000))
+            instructions.append(inst)
+        instructions[0].updateContext(MemoryAccess(0x5000, CPUSIZE.QWORD, 0x41))
+        writeTrace(self.path, instructions)
+
+        hooked = list()
+
+        def hook(inst):
+            hooked.append(inst.getAddress())
+            self.assertEqual(getConcreteRegisterValue(REG.RAX), 0x42)
+
+        self.assertEqual(replayTrace(self.path, {0x1003: hook}), 3)
+        self.assertEqual(hooked, [0x1003])
+        self.assertEqual(getConcreteMemoryValue(MemoryAccess(0x5000, CPUSIZE.QWORD)), 0x41)
+        self.assertEqual(getConcreteRegisterValue(REG.RBX), 0x5042)
+
+        # A hook returning False stops the replay
+        self.assertEqual(replayTrace(self.path, {0x1000: lambda inst: False}), 1)
+
+    def test_replay_processed(self):
+        """Check that the memory loaded by processed instructions is recorded with its value before the execution."""
+        instructions = [
+            Instruction("\x48\xc7\xc3\x00\x50\x00\x00"),   # mov rbx, 0x5000
+            Instruction("\x48\x83\x03\x01"),                 # add qword ptr [rbx], 1
+            Instruction("\x48\x0f\xc1\x03"),                 # xadd qword ptr [rbx], rax
+        ]
+        setConcreteMemoryValue(MemoryAccess(0x5000, CPUSIZE.QWORD, 0x41))
+        for inst in instructions:
+            processing(inst)
+        self.assertEqual(getConcreteMemoryValue(MemoryAccess(0x5000, CPUSIZE.QWORD)), 0x42)
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 0x42)
+        writeTrace(self.path, instructions)
+
+        resetEngines()
+        self.assertEqual(replayTrace(self.path), 3)
+        self.assertEqual(getConcreteMemoryValue(MemoryAccess(0x5000, CPUSIZE.QWORD)), 0x42)
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 0x42)
+
+    def test_replay_threads(self):
+        """Check that the skipped registers are restored after thread switches and unsupported instructions."""
+        trace = [
+            ("\xf4",         0x1000, 1, 0x10),   # hlt (not supported)
+            ("\x48\xff\xc0", 0x2000, 2, 0x20),   # inc rax
+            ("\x48\xff\xc0", 0x1001, 1, 0x10),   # inc rax (RAX is not recorded again)
+        ]
+        instructions = list()
+        for opcodes, addr, tid, rax in trace:
+            inst = Instruction(opcodes)
+            inst.setAddress(addr)
+            inst.setThreadId(tid)
+            inst.updateContext(Register(REG.RAX, rax))
+            instructions.append(inst)
+        writeTrace(self.path, instructions)
+
+        values = dict()
+
+        def hook(inst):
+            values[inst.getAddress()] = getConcreteRegisterValue(REG.RAX)
+
+        hooks = {addr: hook for _, addr, _, _ in trace}
+        self.assertEqual(replayTrace(self.path, hooks), 3)
+        self.assertEqual(values, {0x1000: 0x10, 0x2000: 0x21, 0x1001: 0x11})